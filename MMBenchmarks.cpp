@@ -0,0 +1,147 @@
+/*
+ * MMBenchmarks:
+ *    Exercise MultiMon's hot paths on the device and record the results
+ *    in PerfStats.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  WebThing Includes
+#include <ESP_FS.h>
+#include <gui/ScreenMgr.h>
+//                                  Local Includes
+#include "MultiMonApp.h"
+#include "MMBenchmarks.h"
+#include "MMWebUI.h"
+#include "MMLog.h"
+#include "src/util/PerfStats.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace MMBenchmarks {
+  namespace Internal {
+    static constexpr const char* ConfigTemplatePath = "/ConfigPrinters.html";
+    static constexpr uint8_t MaxKeyLength = 32;
+
+    uint8_t lastIterations = 0;
+
+    // Expand a template in the same way as ESPTemplateProcessor, but rather
+    // than sending the output to a web client, simply count the bytes that
+    // would have been sent. Returns 0 if the template can't be read.
+    uint32_t expandTemplate(const char* path, std::function<void(const String&, String&)> mapper) {
+      File f = ESP_FS::open(path, "r");
+      if (!f) {
+        MM_LOG_WARNING(F("Benchmark: unable to open %s"), path);
+        return 0;
+      }
+
+      uint32_t outputBytes = 0;
+      char buf[128];
+      char key[MaxKeyLength+1];
+      int  keyLen = -1;      // -1 => not currently collecting a key
+      bool escaped = false;
+      String val;
+
+      int n;
+      while ((n = f.read((uint8_t*)buf, sizeof(buf))) > 0) {
+        for (int i = 0; i < n; i++) {
+          char c = buf[i];
+          if (keyLen >= 0) {
+            if (c == '%') {
+              key[keyLen] = '\0';
+              val = "";
+              mapper(String(key), val);
+              outputBytes += val.length();
+              keyLen = -1;
+            } else if (keyLen < MaxKeyLength) {
+              key[keyLen++] = c;
+            }
+          } else if (escaped) {
+            outputBytes++;
+            escaped = false;
+          } else if (c == '\\') {
+            escaped = true;
+          } else if (c == '%') {
+            keyLen = 0;
+          } else {
+            outputBytes++;
+          }
+        }
+      }
+      f.close();
+      return outputBytes;
+    }
+
+    int firstActivePrinter() {
+      for (int i = 0; i < MultiMonApp::MaxPrinters; i++) {
+        if (mmSettings->printer[i].isActive && mmApp->printerSnapshot(i).active) return i;
+      }
+      return -1;
+    }
+
+    bool onlyMockPrinters() {
+      for (int i = 0; i < MultiMonApp::MaxPrinters; i++) {
+        if (mmSettings->printer[i].isActive && !mmSettings->printer[i].mock) return false;
+      }
+      return true;
+    }
+  } // ----- END: MMBenchmarks::Internal
+
+
+  void run(long requested) {
+    using PerfStats::Case;
+    using PerfStats::Scope;
+
+    // Clamp before narrowing so that out of range requests don't wrap
+    uint8_t iterations = constrain(requested, 1L, (long)MaxIterations);
+    Internal::lastIterations = iterations;
+    PerfStats::reset();
+
+    int detailIndex = Internal::firstActivePrinter();
+    DynamicJsonDocument doc(mmSettings->maxFileSize);
+
+    for (uint8_t i = 0; i < iterations; i++) {
+      // Screen renders record their own timing
+      mmApp->homeScreen->display(true);
+      if (detailIndex >= 0) {
+        mmApp->detailScreen->setIndex(detailIndex);
+        mmApp->detailScreen->display(true);
+      }
+
+      { Scope s(Case::PluginRender); wtAppImpl->pluginMgr.displayPlugin(0); }
+
+      { Scope s(Case::PrinterInfo); String info; MMWebUI::printerInfo(info); }
+
+      doc.clear();
+      { Scope s(Case::SettingsToJSON); mmSettings->toJSON(doc); }
+      { Scope s(Case::SettingsFromJSON); mmSettings->fromJSON(doc); }
+
+      {
+        Scope s(Case::ConfigTemplate);
+        Internal::expandTemplate(Internal::ConfigTemplatePath, MMWebUI::printerConfigMapper);
+      }
+
+      // The poll cycle is recorded by the app's printer activity callback
+#if defined(MM_NETWORK_TASK)
+      // Only the network task may refresh the printers; ask it to
+      mmApp->app_conditionalUpdate(true);
+#else
+      mmApp->printerGroup->refreshPrinterData(true);
+#endif
+      yield();
+    }
+
+    ScreenMgr.displayHomeScreen();
+  }
+
+  void describeRun(JsonObject info) {
+    info[F("iterations")] = Internal::lastIterations;
+    info[F("mockOnly")] = Internal::onlyMockPrinters();
+    info[F("freeHeap")] = ESP.getFreeHeap();
+  }
+};
+// ----- END: MMBenchmarks
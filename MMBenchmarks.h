@@ -0,0 +1,39 @@
+/*
+ * MMBenchmarks:
+ *    Exercise MultiMon's hot paths on the device and record the results
+ *    in PerfStats.
+ *
+ * NOTES:
+ * o The suite is run on demand from the Web UI (/perf?run=N). It redraws
+ *   the display while running and returns to the home screen when done.
+ * o The polling case performs a forced refresh of all active printers. For
+ *   repeatable numbers, mark the printers as mock printers in the /dev page.
+ *
+ */
+
+#ifndef MMBenchmarks_h
+#define MMBenchmarks_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  WebThing Includes
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace MMBenchmarks {
+  static constexpr uint8_t MaxIterations = 20;
+
+  // Reset PerfStats, run each benchmark case `requested` times (clamped
+  // to 1..MaxIterations), and leave the results in PerfStats
+  void run(long requested);
+
+  // Describe the conditions of the most recent run (iterations, whether
+  // the polling case only involved mock printers, free heap, etc.)
+  void describeRun(JsonObject info);
+};
+
+#endif  // MMBenchmarks_h
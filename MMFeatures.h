@@ -0,0 +1,102 @@
+/*
+ * MMFeatures.h
+ *    Select the optional parts of MultiMon that are built into the firmware
+ *
+ * NOTES:
+ * o Each MM_FEATURE_ is on (1) unless it has already been defined as 0,
+ *   either below or with a compiler flag such as -DMM_FEATURE_MOONRAKER=0.
+ * o A profile turns off several features at once. Uncomment at most one,
+ *   or define it with a compiler flag. Features that a profile leaves on
+ *   can still be turned off individually.
+ * o Code for a feature that is off is never referenced, so the linker
+ *   leaves it (and any library only it uses) out of the firmware.
+ * o The OctoPrint, Duet3D, and mock clients are created by PrinterGroup
+ *   and are always linked. The printer types that can be turned off are
+ *   those implemented by this app. Turning off MM_FEATURE_OCTOPRINT hands
+ *   OctoPrint printers back to PrinterGroup's client.
+ * o tools/size_report.py shows where the flash goes in a build.
+ * o MM_NETWORK_TASK is not a feature but is set here for the same reason:
+ *   every file that includes this one sees the same value.
+ * o MM_LOG_LEVEL is the most detailed level of logging that is built in.
+ *   See MMLog.h.
+ *
+ */
+
+#ifndef MMFeatures_h
+#define MMFeatures_h
+
+// ----- Profiles
+// #define MM_PROFILE_OCTO_ONLY   // OctoPrint printers only
+// #define MM_PROFILE_DUET_ONLY   // Duet3D and RRF3 printers only
+// #define MM_PROFILE_NO_PLUGINS  // Every printer type, but no plugins
+
+#if defined(MM_PROFILE_OCTO_ONLY)
+  #define MM_FEATURE_RRF3 0
+  #define MM_FEATURE_MOONRAKER 0
+  #define MM_FEATURE_DUET_SPLASH 0
+#elif defined(MM_PROFILE_DUET_ONLY)
+  #define MM_FEATURE_OCTOPRINT 0
+  #define MM_FEATURE_OCTO_PUSH 0
+  #define MM_FEATURE_MOONRAKER 0
+  #define MM_FEATURE_OCTO_SPLASH 0
+#elif defined(MM_PROFILE_NO_PLUGINS)
+  #define MM_FEATURE_PLUGINS 0
+#endif
+
+// ----- Features
+
+// RRF3 printers, and the job thumbnails they provide
+#if !defined(MM_FEATURE_RRF3)
+  #define MM_FEATURE_RRF3 1
+#endif
+
+// Moonraker (Klipper) printers. With MM_FEATURE_OCTO_PUSH, this is all
+// that uses the WebSockets library.
+#if !defined(MM_FEATURE_MOONRAKER)
+  #define MM_FEATURE_MOONRAKER 1
+#endif
+
+// OctoPrint printers polled by this app's client, which asks for less and
+// parses less than PrinterGroup's (see OctoPrintClient.h)
+#if !defined(MM_FEATURE_OCTOPRINT)
+  #define MM_FEATURE_OCTOPRINT 1
+#endif
+
+// The push connection to OctoPrint printers (see MMSettings::octoPush)
+#if !defined(MM_FEATURE_OCTO_PUSH)
+  #define MM_FEATURE_OCTO_PUSH 1
+#endif
+
+// The Generic and AIO plugins
+#if !defined(MM_FEATURE_PLUGINS)
+  #define MM_FEATURE_PLUGINS 1
+#endif
+
+// The artwork on the splash screen
+#if !defined(MM_FEATURE_OCTO_SPLASH)
+  #define MM_FEATURE_OCTO_SPLASH 1
+#endif
+#if !defined(MM_FEATURE_DUET_SPLASH)
+  #define MM_FEATURE_DUET_SPLASH 1
+#endif
+
+// ----- Threading
+
+// On the ESP32, run the network side of the app in a task of its own on
+// core 0 (see MultiMonApp.h). It changes the layout of MultiMonApp, so
+// every file must see the same setting: define it here or with a compiler
+// flag that applies to the whole build. A #define in MultiMon.ino is not
+// seen by the other files.
+// #define MM_NETWORK_TASK
+
+// ----- Logging
+
+// Calls to MM_LOG_ macros for more detailed levels than this are compiled
+// out entirely, along with their format strings and arguments. Use one of
+// ArduinoLog's LOG_LEVEL_ values (0-6). The levels below it still obey the
+// level set at runtime.
+#if !defined(MM_LOG_LEVEL)
+  #define MM_LOG_LEVEL 5    // LOG_LEVEL_TRACE
+#endif
+
+#endif  // MMFeatures_h
@@ -0,0 +1,95 @@
+/*
+ * MMLog.h
+ *    Logging for MultiMon: ArduinoLog output plus a record in the LogBuffer
+ *
+ * NOTES:
+ * o Use MM_LOG_ERROR, MM_LOG_WARNING, MM_LOG_NOTICE, MM_LOG_TRACE, and
+ *   MM_LOG_VERBOSE in place of the corresponding Log methods. They take
+ *   the same format strings and arguments.
+ * o A macro for a level more detailed than MM_LOG_LEVEL (see MMFeatures.h)
+ *   expands to nothing, so its arguments aren't evaluated and its format
+ *   string isn't in the firmware.
+ * o Enabled messages are added to the LogBuffer whatever the runtime log
+ *   level, and are available from the /logs endpoint. Only those at or
+ *   below the runtime level are formatted and sent to Serial.
+ * o Messages logged by the libraries go straight to ArduinoLog and aren't
+ *   in the LogBuffer.
+ *
+ */
+
+#ifndef MMLog_h
+#define MMLog_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+//                                  Third Party Libraries
+#include <ArduinoLog.h>
+//                                  Local Includes
+#include "MMFeatures.h"
+#include "src/util/LogBuffer.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace MMLog {
+  template<typename F, typename... Args>
+  void error(F format, const Args&... args) {
+    LogBuffer::add(LOG_LEVEL_ERROR, format, args...);
+    Log.error(format, args...);
+  }
+
+  template<typename F, typename... Args>
+  void warning(F format, const Args&... args) {
+    LogBuffer::add(LOG_LEVEL_WARNING, format, args...);
+    Log.warning(format, args...);
+  }
+
+  template<typename F, typename... Args>
+  void notice(F format, const Args&... args) {
+    LogBuffer::add(LOG_LEVEL_NOTICE, format, args...);
+    Log.notice(format, args...);
+  }
+
+  template<typename F, typename... Args>
+  void trace(F format, const Args&... args) {
+    LogBuffer::add(LOG_LEVEL_TRACE, format, args...);
+    Log.trace(format, args...);
+  }
+
+  template<typename F, typename... Args>
+  void verbose(F format, const Args&... args) {
+    LogBuffer::add(LOG_LEVEL_VERBOSE, format, args...);
+    Log.verbose(format, args...);
+  }
+};
+
+#if MM_LOG_LEVEL >= LOG_LEVEL_ERROR
+  #define MM_LOG_ERROR(...) MMLog::error(__VA_ARGS__)
+#else
+  #define MM_LOG_ERROR(...) do { } while (0)
+#endif
+
+#if MM_LOG_LEVEL >= LOG_LEVEL_WARNING
+  #define MM_LOG_WARNING(...) MMLog::warning(__VA_ARGS__)
+#else
+  #define MM_LOG_WARNING(...) do { } while (0)
+#endif
+
+#if MM_LOG_LEVEL >= LOG_LEVEL_NOTICE
+  #define MM_LOG_NOTICE(...) MMLog::notice(__VA_ARGS__)
+#else
+  #define MM_LOG_NOTICE(...) do { } while (0)
+#endif
+
+#if MM_LOG_LEVEL >= LOG_LEVEL_TRACE
+  #define MM_LOG_TRACE(...) MMLog::trace(__VA_ARGS__)
+#else
+  #define MM_LOG_TRACE(...) do { } while (0)
+#endif
+
+#if MM_LOG_LEVEL >= LOG_LEVEL_VERBOSE
+  #define MM_LOG_VERBOSE(...) MMLog::verbose(__VA_ARGS__)
+#else
+  #define MM_LOG_VERBOSE(...) do { } while (0)
+#endif
+
+#endif  // MMLog_h
@@ -9,10 +9,10 @@
 //                                  Core Libraries
 #include <Arduino.h>
 //                                  Third Party Libraries
-#include <ArduinoLog.h>
 #include <ArduinoJson.h>
 //                                  Local Includes
 #include "MMSettings.h"
+#include "MMLog.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -37,6 +37,7 @@ void MMSettings::fromJSON(const JsonDocument &doc) {
   }
   printerRefreshInterval = doc[F("printerRefreshInterval")];
   if (printerRefreshInterval == 0) printerRefreshInterval = 30; // Sanity check
+  octoPush = doc[F("octoPush")] | false;
 
   WTAppSettings::fromJSON(doc);
   logSettings();
@@ -48,17 +49,23 @@ void MMSettings::toJSON(JsonDocument &doc) {
     printer[i].toJSON(printerSettings.createNestedObject());
   }
   doc[F("printerRefreshInterval")] = printerRefreshInterval;
+  doc[F("octoPush")] = octoPush;
 
   WTAppSettings::toJSON(doc);
 }
 
 void MMSettings::logSettings() {
+  // A verbose-level dump. When that level isn't built in, leave out the
+  // parts logged by the base classes as well.
+#if MM_LOG_LEVEL >= LOG_LEVEL_VERBOSE
   for (int i = 0; i < MaxPrinters; i++) {
-    Log.verbose(F("Printer Settings %d"), i);
+    MM_LOG_VERBOSE(F("Printer Settings %d"), i);
     printer[i].logSettings();
   }
-  Log.verbose(F("Printer refresh interval: %d"), printerRefreshInterval);
+  MM_LOG_VERBOSE(F("Printer refresh interval: %d"), printerRefreshInterval);
+  MM_LOG_VERBOSE(F("OctoPrint push updates: %T"), octoPush);
   WTAppSettings::logSettings();
+#endif
 }
 
 
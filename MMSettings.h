@@ -29,6 +29,7 @@ public:
   static constexpr uint8_t MaxPrinters = 4;
   PrinterSettings printer[MaxPrinters];
   uint32_t printerRefreshInterval = 10;
+  bool octoPush = false;    // Use OctoPrint's push API to learn of changes sooner
 
 private:
   // ----- Constants -----
@@ -7,7 +7,6 @@
 //--------------- Begin:  Includes ---------------------------------------------
 //                                  Core Libraries
 //                                  Third Party Libraries
-#include <ArduinoLog.h>
 //                                  WebThing Includes
 #include <WebThing.h>
 #include <WebUI.h>
@@ -16,6 +15,13 @@
 //                                  Local Includes
 #include "MultiMonApp.h"
 #include "MMWebUI.h"
+#include "MMBenchmarks.h"
+#include "MMLog.h"
+#include "src/clients/MoonrakerClient.h"
+#include "src/clients/RRF3Client.h"
+#include "src/printers/CompletionQueue.h"
+#include "src/util/LogBuffer.h"
+#include "src/util/PerfStats.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -38,39 +44,99 @@ namespace MMWebUI {
       printer->user =  WebUI::arg(prefix + "user");
       printer->nickname =  WebUI::arg(prefix + "nick");
       printer->type =  WebUI::arg(prefix + "type");
-      if (printer->type.equals("Duet3D")) {
+      if (printer->type.equals("Duet3D") || printer->type.equals(RRF3Client::TypeName)) {
         printer->pass =  WebUI::arg(prefix + "duet_pass");
       } else {
         printer->pass =  WebUI::arg(prefix + "pass");
       }
+      if (WebThing::settings.showDevMenu) printer->mock = WebUI::hasArg(prefix + "mock");
+    }
+
+    // Describe the upcoming completions, soonest first
+    void completionsToJSON(JsonArray entries, uint8_t maxEntries) {
+      const CompletionQueue::Entry* next[CompletionQueue::MaxPrinters];
+      uint8_t n = CompletionQueue::next(next, min(maxEntries, CompletionQueue::MaxPrinters));
+      for (int k = 0; k < n; k++) {
+        JsonObject entry = entries.createNestedObject();
+        entry[F("i")] = next[k]->index;
+        entry[F("name")] = mmSettings->printer[next[k]->index].nickname;
+        entry[F("completesAt")] = (uint32_t)next[k]->completesAt;
+        entry[F("completeAt")] = next[k]->formatted();
+        entry[F("remaining")] = next[k]->remaining();
+      }
     }
   } // ----- END: MMWebUI::Internal
 
 
+  void printerInfo(String& info) {
+    DynamicJsonDocument doc(1024);
+    JsonArray printers = doc.to<JsonArray>();
+    for (int i = 0; i < MultiMonApp::MaxPrinters; i++) {
+      JsonObject entry = printers.createNestedObject();
+      const PrinterSettings& ps = mmSettings->printer[i];
+      if (!ps.isActive) continue;
+      const PrinterSnapshot& snapshot = mmApp->printerSnapshot(i);
+
+      entry[F("name")] = ps.nickname.isEmpty() ? ps.server : ps.nickname;
+      // Moonraker's port serves its API. Its web front end is on the usual port.
+      String url = "http://" + ps.server;
+      bool apiPort = ps.type.equalsIgnoreCase(MoonrakerClient::TypeName);
+      if (ps.port != 0 && ps.port != 80 && !apiPort) { url += ':'; url += ps.port; }
+      entry[F("url")] = url;
+      // The page offers to acknowledge a completed job when pct is 100
+      if (snapshot.state == PrintClient::State::Complete) {
+        entry[F("pct")] = 100;
+        entry[F("file")] = snapshot.filename;
+      } else if (snapshot.state == PrintClient::State::Printing) {
+        entry[F("pct")] = min((int)snapshot.pct, 99);
+        entry[F("file")] = snapshot.filename;
+      }
+    }
+    serializeJson(doc, info);
+  }
+
+  void printerConfigMapper(const String& key, String& val) {
+    if (key.startsWith("_P")) {
+      int i = (key.charAt(2) - '0');
+      PrinterSettings* printer = &(mmSettings->printer[i]);
+      const char* subkey = &(key.c_str()[4]); // Get rid of the prefix; e.g. _P1_
+      String type = "T_" + printer->type;
+      if (strcmp(subkey, "ENABLED") == 0) val = WebUIHelper::checkedOrNot[printer->isActive];
+      else if (strcmp(subkey, "KEY") == 0) val = printer->apiKey;
+      else if (strcmp(subkey, "HOST") == 0) val =  printer->server;
+      else if (strcmp(subkey, "PORT") == 0) val.concat(printer->port);
+      else if (strcmp(subkey, "USER") == 0) val = printer->user;
+      else if (strcmp(subkey, "PASS") == 0) val = printer->pass;
+      else if (strcmp(subkey, "NICK") == 0) val = printer->nickname;
+      else if (strcmp(subkey, "MOCK") == 0)  val = WebUIHelper::checkedOrNot[printer->mock];
+      else if (type.equals(subkey)) { val = "selected"; }
+      else if (strncmp(subkey, "T_", 2) == 0 && SnapshotClient::omitted(subkey + 2)) {
+        val = "disabled"; // Not in this build
+      }
+    }
+    else if (key.equals("SHOW_DEV")) val = WebThing::settings.showDevMenu ? "true" : "false";
+    else if (key.equals(F("RFRSH"))) val.concat(mmSettings->printerRefreshInterval);
+    else if (key.equals(F("OCTO_PUSH"))) val = WebUIHelper::checkedOrNot[mmSettings->octoPush];
+  }
+
+
   // ----- BEGIN: MMWebUI::Endpoints
   namespace Endpoints {
     void ackPrinterDone() {
       auto action = [&]() {
-        if (!mmApp->printerGroup) {
-          Log.warning("ackPrinterDone: printerGroup is null");
-          WebUI::sendStringContent("text/plain", "printer index out of range", "400 Bad Request");
-          return;
-        }
-
         int printerIndex = WebUI::arg("pi").toInt();
-        if (printerIndex < 0 || printerIndex >= mmApp->printerGroup->numberOfPrinters()) {
-          Log.warning("ackPrinterDone: index out of range: %d vs %d",
-            printerIndex, mmApp->printerGroup->numberOfPrinters());
+        if (printerIndex < 0 || printerIndex >= MultiMonApp::MaxPrinters) {
+          MM_LOG_WARNING("ackPrinterDone: index out of range: %d vs %d",
+            printerIndex, MultiMonApp::MaxPrinters);
           WebUI::sendStringContent("text/plain", "printer index out of range", "400 Bad Request");
           return;
         }
 
-        auto printer = mmApp->printerGroup->getPrinter(printerIndex);
-        if (printer) {
-          printer->acknowledgeCompletion();
+        if (mmApp->printerSnapshot(printerIndex).active) {
+          mmApp->acknowledgeCompletion(printerIndex);
           WebUI::sendStringContent("text/plain", "Printer Completion Acknowledged");
         } else {
-          Log.warning("ackPrinterDone: no printer for index %d", printerIndex);
+          MM_LOG_WARNING("ackPrinterDone: no printer for index %d", printerIndex);
           WebUI::sendStringContent("text/plain", "printer index out of range", "400 Bad Request");
         }
       };
@@ -80,31 +146,104 @@ namespace MMWebUI {
     
     void updatePrinterConfig() {
       auto action = []() {
-        for (int i = 0; i < 4; i++) {
-          PrinterSettings* printer = &(mmSettings->printer[i]);
-          bool wasActive = printer->isActive;
+        bool octoPush = WebUI::hasArg(F("octoPush"));
+        uint32_t refreshInterval = WebUI::arg(F("refreshInterval")).toInt();
+        bool reconnect = (octoPush != mmSettings->octoPush);
+        bool changed = reconnect || (refreshInterval != mmSettings->printerRefreshInterval);
+        mmSettings->octoPush = octoPush;
+        // Takes effect with the next refresh
+        mmSettings->printerRefreshInterval = refreshInterval;
+
+        // Only do as much as each printer's changes require. Printers whose
+        // settings are unchanged keep their connections, history, and state.
+        MultiMonApp::Reconfigure what[MultiMonApp::MaxPrinters];
+        for (int i = 0; i < MultiMonApp::MaxPrinters; i++) {
+          PrinterSettings before = mmSettings->printer[i];
           Internal::updateSinglePrinter(i);
-          if (!wasActive && printer->isActive) mmApp->printerWasActivated(i);
+          what[i] = MultiMonApp::reconfigurationFor(before, mmSettings->printer[i]);
+          if (reconnect && what[i] < MultiMonApp::Reconfigure::Reconnect) {
+            what[i] = MultiMonApp::Reconfigure::Reconnect;
+          }
+          if (what[i] != MultiMonApp::Reconfigure::None) changed = true;
         }
-        mmSettings->printerRefreshInterval = WebUI::arg(F("refreshInterval")).toInt();
-
-        if (WebThing::settings.showDevMenu) {
-          PrinterSettings* printer = &(mmSettings->printer[0]);
-          printer[0].mock = WebUI::hasArg(F("_p0_mock"));
-          printer[1].mock = WebUI::hasArg(F("_p1_mock"));
-          printer[2].mock = WebUI::hasArg(F("_p2_mock"));
-          printer[3].mock = WebUI::hasArg(F("_p3_mock"));
+
+        // The network side must have the new settings before it is asked
+        // to act on them
+        if (changed) mmApp->publishSettings();
+        for (int i = 0; i < MultiMonApp::MaxPrinters; i++) {
+          if (what[i] == MultiMonApp::Reconfigure::None) continue;
+          MM_LOG_TRACE(F("Printer %d: reconfigure (%d)"), i, (int)what[i]);
+          mmApp->printerSettingsChanged(i, what[i]);
         }
 
-        // Act on changed settings...
-        wtAppImpl->configMayHaveChanged();
-        wtApp->settings->write();
+        // Nothing else on this page affects the rest of the app, so there
+        // is no need for wtAppImpl->configMayHaveChanged()
+        if (changed) wtApp->settings->write();
         WebUI::redirectHome();
       };
   
       WebUI::wrapWebAction("/updatePrinterConfig", action);
     }
 
+    // Return the accumulated PerfStats and TaskScheduler statistics as JSON. Arguments:
+    //   run=N: Reset the stats and run the benchmark suite N times first (1-20)
+    //   reset: Reset the stats without running the suite
+    void perfStats() {
+      auto action = []() {
+        DynamicJsonDocument doc(4096);
+        if (WebUI::hasArg(F("run"))) {
+          MMBenchmarks::run(WebUI::arg(F("run")).toInt());
+          MMBenchmarks::describeRun(doc.createNestedObject(F("run")));
+        } else if (WebUI::hasArg(F("reset"))) {
+          PerfStats::reset();
+        }
+        PerfStats::toJSON(doc.createNestedObject(F("cases")));
+        PerfStats::bootToJSON(doc.createNestedObject(F("boot")));
+        mmApp->scheduler.toJSON(doc.createNestedObject(F("tasks")));
+#if defined(MM_NETWORK_TASK)
+        mmApp->networkScheduler.toJSON(doc.createNestedObject(F("networkTasks")));
+#endif
+        mmApp->requests.toJSON(doc.createNestedObject(F("requests")));
+
+        String result;
+        serializeJson(doc, result);
+        WebUI::sendStringContent("application/json", result);
+      };
+
+      WebUI::wrapWebAction("/perf", action);
+    }
+
+    // Return the upcoming print completions, soonest first. Arguments:
+    //   n=N: Return at most N completions (default: all)
+    void completions() {
+      auto action = []() {
+        uint8_t maxEntries = CompletionQueue::MaxPrinters;
+        if (WebUI::hasArg(F("n"))) maxEntries = constrain(WebUI::arg(F("n")).toInt(), 0, maxEntries);
+
+        DynamicJsonDocument doc(768);
+        Internal::completionsToJSON(doc.createNestedArray(F("completions")), maxEntries);
+
+        String result;
+        serializeJson(doc, result);
+        WebUI::sendStringContent("application/json", result);
+      };
+
+      WebUI::wrapWebAction("/completions", action);
+    }
+
+    // Return the messages in the LogBuffer as text, oldest first. Arguments:
+    //   clear: Clear the buffer after returning its contents
+    void logs() {
+      auto action = []() {
+        String result;
+        result.reserve(LogBuffer::Capacity * 64);
+        LogBuffer::toText(result);
+        if (WebUI::hasArg(F("clear"))) LogBuffer::clear();
+        WebUI::sendStringContent("text/plain", result);
+      };
+
+      WebUI::wrapWebAction("/logs", action);
+    }
   }   // ----- END: MMWebUI::Endpoints
 
 
@@ -113,7 +252,14 @@ namespace MMWebUI {
       auto mapper =[](const String& key, String& val) -> void {
         // ----- Printer-related items
         if (key.equals(F("PRINTER_INFO"))) {
-          mmApp->printerGroup->printerInfo(val);
+          PerfStats::Scope timer(PerfStats::Case::PrinterInfo);
+          printerInfo(val);
+          return;
+        }
+        if (key.equals(F("COMPLETIONS"))) {
+          DynamicJsonDocument doc(768);
+          Internal::completionsToJSON(doc.to<JsonArray>(), CompletionQueue::MaxPrinters);
+          serializeJson(doc, val);
           return;
         }
 
@@ -130,27 +276,7 @@ namespace MMWebUI {
     }
 
     void presentPrinterConfig() {
-      auto mapper =[](const String& key, String& val) -> void {
-        if (key.startsWith("_P")) {
-          int i = (key.charAt(2) - '0');
-          PrinterSettings* printer = &(mmSettings->printer[i]);
-          const char* subkey = &(key.c_str()[4]); // Get rid of the prefix; e.g. _P1_
-          String type = "T_" + printer->type;
-          if (strcmp(subkey, "ENABLED") == 0) val = WebUIHelper::checkedOrNot[printer->isActive];
-          else if (strcmp(subkey, "KEY") == 0) val = printer->apiKey;
-          else if (strcmp(subkey, "HOST") == 0) val =  printer->server;
-          else if (strcmp(subkey, "PORT") == 0) val.concat(printer->port);
-          else if (strcmp(subkey, "USER") == 0) val = printer->user;
-          else if (strcmp(subkey, "PASS") == 0) val = printer->pass;
-          else if (strcmp(subkey, "NICK") == 0) val = printer->nickname;
-          else if (strcmp(subkey, "MOCK") == 0)  val = WebUIHelper::checkedOrNot[printer->mock];
-          else if (type.equals(subkey)) { val = "selected"; } 
-        }
-        else if (key.equals("SHOW_DEV")) val = WebThing::settings.showDevMenu ? "true" : "false";
-        else if (key.equals(F("RFRSH"))) val.concat(mmSettings->printerRefreshInterval);
-      };
-
-      WebUI::wrapWebPage("/presentPrinterConfig", "/ConfigPrinters.html", mapper);
+      WebUI::wrapWebPage("/presentPrinterConfig", "/ConfigPrinters.html", printerConfigMapper);
     }
   }   // ----- END: MMWebUI::Pages
 
@@ -162,6 +288,9 @@ namespace MMWebUI {
     WebUI::registerHandler("/presentPrinterConfig",   Pages::presentPrinterConfig);
     WebUI::registerHandler("/updatePrinterConfig",    Endpoints::updatePrinterConfig);
     WebUI::registerHandler("/ackPrinterDone",         Endpoints::ackPrinterDone);
+    WebUI::registerHandler("/perf",                   Endpoints::perfStats);
+    WebUI::registerHandler("/completions",            Endpoints::completions);
+    WebUI::registerHandler("/logs",                   Endpoints::logs);
   }
 
 }
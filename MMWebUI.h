@@ -18,6 +18,13 @@
 
 namespace MMWebUI {
   void init();
+
+  // The key/value mapper used to expand the ConfigPrinters.html template
+  void printerConfigMapper(const String& key, String& val);
+
+  // Describe the printers for the home page: a JSON array with an entry per
+  // printer, built from their snapshots. Inactive printers are empty objects.
+  void printerInfo(String& info);
 }
 
 #endif  // MMWebUI_h
\ No newline at end of file
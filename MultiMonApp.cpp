@@ -8,7 +8,6 @@
 //--------------- Begin:  Includes ---------------------------------------------
 //                                  Core Libraries
 //                                  Third Party Libraries
-#include <ArduinoLog.h>
 #include <BPA_PrintClient.h>
 #include <BPA_DuetClient.h>
 #include <BPA_MockPrintClient.h>
@@ -16,6 +15,8 @@
 //                                  WebThing Includes
 #include <WebUI.h>
 #include <DataBroker.h>
+#include <WebThing.h>
+#include <gui/Display.h>
 #include <gui/ScreenMgr.h>
 #include <plugins/PluginMgr.h>
 #include <plugins/common/GenericPlugin.h>
@@ -23,9 +24,15 @@
 #include <plugins/common/CryptoPlugin.h>
 //                                  Local Includes
 #include "MultiMonApp.h"
+#include "MMFeatures.h"
+#include "MMLog.h"
 #include "MMSettings.h"
 #include "MMWebUI.h"
+#include "src/printers/CompletionQueue.h"
+#include "src/printers/PrinterStateCache.h"
 #include "src/screens/AppTheme.h"
+#include "src/util/PerfStats.h"
+#include "src/util/TimeFormat.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -39,14 +46,48 @@ static constexpr const char* AppPrefix = "MM-";
  *
  *----------------------------------------------------------------------------*/
 
+#if MM_FEATURE_PLUGINS
+// PluginMgr refreshes every plugin on each pass, and each plugin decides for
+// itself whether a refresh is due. Calls that return in less than
+// MinRequestMicros made no requests, so only the others are recorded: the
+// count is of refreshes that went to the network, with their latency.
+template <class P>
+class TimedPlugin : public P {
+public:
+  TimedPlugin(PerfStats::Case c) : _case(c) { }
+  void refresh(bool force = false) override {
+    uint32_t start = micros();
+    P::refresh(force);
+    uint32_t elapsed = micros() - start;
+    if (elapsed >= MinRequestMicros) PerfStats::record(_case, elapsed);
+  }
+private:
+  static constexpr uint32_t MinRequestMicros = 1000;
+  PerfStats::Case _case;
+};
+
+// Plugins are created in the order PluginMgr loads them, which is the order
+// of their PerfStats cases
+static uint8_t pluginsCreated = 0;
+
+template <class P>
+Plugin* newTimedPlugin() {
+  uint8_t index = pluginsCreated++;
+  if (index >= PerfStats::MaxTimedPlugins) return new P();
+  return new TimedPlugin<P>(PerfStats::pluginRefresh(index));
+}
+#endif
+
 Plugin* pluginFactory(const String& type) {
   Plugin *p = NULL;
-  if      (type.equalsIgnoreCase("generic")) { p = new GenericPlugin(); }
-  else if (type.equalsIgnoreCase("aio")) { p = new AIOPlugin(); }
+#if MM_FEATURE_PLUGINS
+  if      (type.equalsIgnoreCase("generic")) { p = newTimedPlugin<GenericPlugin>(); }
+  else if (type.equalsIgnoreCase("aio")) { p = newTimedPlugin<AIOPlugin>(); }
   // else if (type.equalsIgnoreCase("crypto"))  { p = new CryptoPlugin();  }
+#endif
   
   if (p == NULL) {
-    Log.warning("Unrecognized plugin type: %s", type.c_str());
+    MM_LOG_WARNING("Unrecognized plugin type: %s", type.c_str());
   }
   return p;
 }
@@ -78,9 +119,84 @@ MultiMonApp::MultiMonApp(MMSettings* settings) :
     // Nothing to do here...
 }
 
-void MultiMonApp::printerWasActivated(int index) {
-  // TO DO: May need to cache the IP!!!
-  printerGroup->activatePrinter(index);
+MultiMonApp::Reconfigure MultiMonApp::reconfigurationFor(
+    const PrinterSettings& before, const PrinterSettings& after)
+{
+  if (before.isActive != after.isActive || before.mock != after.mock ||
+      !before.type.equals(after.type)) {
+    return Reconfigure::Reactivate;
+  }
+  // The rest are picked up when an inactive printer is activated
+  bool relabel = !before.nickname.equals(after.nickname);
+  if (!after.isActive || after.mock) return relabel ? Reconfigure::Relabel : Reconfigure::None;
+  if (!before.server.equals(after.server) || before.port != after.port) return Reconfigure::Resolve;
+  if (!before.apiKey.equals(after.apiKey) || !before.user.equals(after.user) ||
+      !before.pass.equals(after.pass)) {
+    return Reconfigure::Reauthenticate;
+  }
+  return relabel ? Reconfigure::Relabel : Reconfigure::None;
+}
+
+void MultiMonApp::printerSettingsChanged(int index, Reconfigure what) {
+  if (what == Reconfigure::None) return;
+
+  if (what >= Reconfigure::Resolve) {
+    // This may be a different printer now. Until it responds, show its cached state.
+    printerLive[index] = false;
+    eta[index].reset();
+    if (!mmSettings->printer[index].isActive) CompletionQueue::remove(index);
+  }
+  // The printer's name or the set of active printers changed
+  if (what == Reconfigure::Relabel || what == Reconfigure::Reactivate) homeScreen->printersChanged();
+
+#if defined(MM_NETWORK_TASK)
+  pendingReconfigurations |= (1UL << (index * 8 + (uint8_t)what));
+#else
+  reconfigurePrinter(index, what);
+#endif
+}
+
+void MultiMonApp::acknowledgeCompletion(int index) {
+#if defined(MM_NETWORK_TASK)
+  pendingAcknowledgements |= (1 << index);
+#else
+  acknowledgePrinter(index);
+#endif
+}
+
+void MultiMonApp::publishSettings() {
+#if defined(MM_NETWORK_TASK)
+  NetworkSettings& copy = networkSettings.back();
+#else
+  NetworkSettings& copy = networkSettings;
+#endif
+  for (int i = 0; i < MaxPrinters; i++) copy.printer[i] = mmSettings->printer[i];
+  copy.refreshInterval = mmSettings->printerRefreshInterval;
+  copy.octoPush = mmSettings->octoPush;
+#if defined(MM_NETWORK_TASK)
+  networkSettings.publish();
+#endif
+}
+
+bool MultiMonApp::usesSnapshotClient(const PrinterSettings& ps) {
+  return ps.isActive && !ps.mock && SnapshotClient::handles(ps.type);
+}
+
+uint32_t MultiMonApp::printTimeLeft(int index) {
+  uint32_t secondsLeft;
+  if (eta[index].timeLeft(millis()/1000, secondsLeft)) return secondsLeft;
+  return snapshots[index].current().timeLeft;
+}
+
+void MultiMonApp::nextCompletion(String& printerName, String& formattedTime, uint32_t& delta) {
+  const CompletionQueue::Entry* next;
+  if (CompletionQueue::next(&next, 1) == 0) {
+    printerName = ""; formattedTime = ""; delta = 0;
+    return;
+  }
+  printerName = mmSettings->printer[next->index].nickname;
+  formattedTime = next->formatted();
+  delta = next->remaining();
 }
 
 
@@ -91,45 +207,86 @@ void MultiMonApp::printerWasActivated(int index) {
  *----------------------------------------------------------------------------*/
 
 void MultiMonApp::app_loop() {
-  // Add app-specific code here...
+  static uint32_t lastLoop = 0;
+  uint32_t loopStart = micros();
+  if (lastLoop != 0) PerfStats::record(PerfStats::Case::LoopGap, loopStart - lastLoop);
+  lastLoop = loopStart;
+
+#if !defined(MM_NETWORK_TASK)
+  requests.beginPass();
+#endif
+  scheduler.runDue(LoopBudget);
 }
 
 void MultiMonApp::app_registerDataSuppliers() {
   DataBroker::registerMapper(
-      [this](const String& key,String& val) { this->printerGroup->dataSupplier(key, val); },
+      [this](const String& key,String& val) { this->printerDataSupplier(key, val); },
       PrinterGroup::DataProviderPrefix);
 }
 
 void MultiMonApp::app_initWebUI() {
   MMWebUI::init();
+  PerfStats::markBoot(PerfStats::BootPhase::WebUIReady);
 }
 
 void MultiMonApp::app_initClients() {
+  publishSettings();
+#if defined(MM_NETWORK_TASK)
+  // The network task hasn't been started, so take them up here
+  networkSettings.update();
+#endif
+
+  // Host names are resolved as each printer is activated
+  for (int i = 0; i < MaxPrinters; i++) { syncClientSettings(i, false); }
+
   printerGroup = new PrinterGroup(
-    MaxPrinters, mmSettings->printer,
-    mmSettings->printerRefreshInterval,
+    MaxPrinters, clientSettings,
+    netSettings().refreshInterval,
     // std::bind(&MultiMonApp::showPrinterActivity, this, std::placeholders::_1));
     [this](bool busy){this->showPrinterActivity(busy);});
-  for (int i = 0; i < MaxPrinters; i++) {
-    printerGroup->activatePrinter(i);
-  }
+
+  // Printer refreshes come first. The two periodic kinds are given
+  // different phases so they don't come due together.
+  using RequestClass = RequestScheduler::Class;
+  pollRequests = requests.addSource("printerPoll", RequestClass::Printer, PollBudget, true);
+  clientRequests = requests.addSource("printerClients", RequestClass::Printer, ClientRefreshBudget, true);
+  activationRequests = requests.addSource("activation", RequestClass::Printer, 0);
+  lookupRequests = requests.addSource("hostLookup", RequestClass::Lookup, LookupBudget);
+  thumbnailRequests = requests.addSource("thumbnails", RequestClass::Background, ThumbnailBudget);
+
+  // Activation is deferred to the scheduler. See activateNextPrinter()
+  nextPrinterToActivate = 0;
+  scheduleTasks();
+#if defined(MM_NETWORK_TASK)
+  xTaskCreatePinnedToCore(
+    runNetworkTask, "network", NetworkTaskStack, this, 1, &networkTask, NetworkTaskCore);
+#endif
+  PerfStats::markBoot(PerfStats::BootPhase::ClientsReady);
 }
 
 void MultiMonApp::app_conditionalUpdate(bool force) {
-  printerGroup->refreshPrinterData(force);
+  // The refresh itself is done by the "poll" task. See pollPrinters()
+  if (force) forceRefresh = true;
 }
 
 Screen* MultiMonApp::app_registerScreens() {
   detailScreen = new DetailScreen();
+  graphScreen = new GraphScreen();
   splashScreen = new SplashScreen();
   homeScreen = new HomeScreen();
 
   ScreenMgr.registerScreen("Detail", detailScreen);
+  ScreenMgr.registerScreen("Graph", graphScreen);
   ScreenMgr.registerScreen("Splash", splashScreen);
   ScreenMgr.registerScreen("Time", homeScreen);
 
   ScreenMgr.setAsHomeScreen(homeScreen);
 
+  PerfStats::markBoot(PerfStats::BootPhase::ScreensRegistered);
+
+  // If we know what the printers were doing before we booted, go straight
+  // to the HomeScreen. It will mark the cached data as stale.
+  if (PrinterStateCache::load()) return homeScreen;
   return splashScreen;
 }
 
@@ -141,7 +298,488 @@ Screen* MultiMonApp::app_registerScreens() {
  *----------------------------------------------------------------------------*/
 
 void MultiMonApp::showPrinterActivity(bool busy) {
- if (busy) ScreenMgr.showActivityIcon(AppTheme::Color_UpdatingPrinter);
- else ScreenMgr.hideActivityIcon();
+  static uint32_t refreshStart = 0;
+  if (busy) {
+    refreshStart = micros();
+  } else {
+    PerfStats::record(PerfStats::Case::PollCycle, micros() - refreshStart);
+    lastRefreshCompleted = millis();
+    // Every printer PrinterGroup handles has now answered (or failed to)
+    for (int i = 0; i < MaxPrinters; i++) {
+      if (clientSettings[i].isActive) printerPolled[i] = true;
+    }
+  }
+
+#if defined(MM_NETWORK_TASK)
+  // This is called on the network core, which must not touch the display.
+  // The "refreshResults" task passes the news on to the UI.
+  networkBusy = busy;
+#else
+  if (busy) ScreenMgr.showActivityIcon(AppTheme::Color_UpdatingPrinter);
+  else ScreenMgr.hideActivityIcon();
+#endif
+
+  if (!busy) publishSnapshots();
+}
+
+#if defined(MM_NETWORK_TASK)
+void MultiMonApp::runNetworkTask(void* param) {
+  MultiMonApp* app = static_cast<MultiMonApp*>(param);
+  for (;;) {
+    app->requests.beginPass();
+    app->networkScheduler.runDue(LoopBudget);
+    // Give the idle task on this core a chance to feed the watchdog
+    vTaskDelay(1);
+  }
+}
+#endif
+
+void MultiMonApp::scheduleTasks() {
+  using Priority = TaskScheduler::Priority;
+
+#if defined(MM_NETWORK_TASK)
+  TaskScheduler& network = networkScheduler;
+
+  // Pick up the results of refreshes done by the network task
+  scheduler.add("refreshResults", Priority::Normal, 0, 10*1000L, [this]() {
+    bool busy = networkBusy;
+    if (busy != activityShown) {
+      activityShown = busy;
+      if (busy) ScreenMgr.showActivityIcon(AppTheme::Color_UpdatingPrinter);
+      else ScreenMgr.hideActivityIcon();
+    }
+    if (refreshPublished.exchange(false)) printerDataRefreshed();
+    return false;
+  });
+
+  // Apply changes requested by the UI. The highest level requested for a
+  // printer covers the others. The settings are published before the
+  // requests are made, so taking them after the requests means they are
+  // at least as new.
+  network.add("reconfigure", Priority::Normal, 0, 500*1000L, [this]() {
+    uint32_t reconfigurations = pendingReconfigurations.exchange(0);
+    uint8_t acknowledgements = pendingAcknowledgements.exchange(0);
+    networkSettings.update();
+    for (int i = 0; i < MaxPrinters; i++) {
+      uint8_t levels = (reconfigurations >> (i * 8)) & 0xFF;
+      uint8_t highest = 0;
+      while (levels >>= 1) highest++;
+      reconfigurePrinter(i, (Reconfigure)highest);
+      if (acknowledgements & (1 << i)) acknowledgePrinter(i);
+    }
+    return false;
+  });
+#else
+  TaskScheduler& network = scheduler;
+#endif
+
+#if MM_FEATURE_OCTO_PUSH
+  network.add("pushClients", Priority::High, 0, 2000L, [this]() {
+    for (int i = 0; i < MaxPrinters; i++) {
+      if (pushClients[i]) pushClients[i]->loop();
+    }
+    return false;
+  });
+#endif
+
+  // Each run activates one printer, so they are spaced by the interval
+  network.add("activation", Priority::Normal, PrinterActivationStagger, 500*1000L, [this]() {
+    if (nextPrinterToActivate < MaxPrinters && !deferForTouch()) activateNextPrinter();
+    return false;
+  });
+
+  // Runs often to service connections. Refreshes are done on the usual interval.
+  network.add("snapshotClients", Priority::Normal, 0, 1000*1000L, [this]() {
+    serviceSnapshotClients();
+    return false;
+  });
+
+  // A refresh blocks until every printer has responded
+  network.add("poll", Priority::Normal, 0, 1000*1000L, [this]() {
+    pollPrinters();
+    return false;
+  });
+
+  // Each run checks one printer
+  network.add("hostLookup", Priority::Low, 1000L, 100*1000L, [this]() {
+    if (nextPrinterToActivate == MaxPrinters) refreshHostAddresses();
+    return false;
+  });
+}
+
+void MultiMonApp::pollPrinters() {
+  // Don't refresh until every printer has been activated
+  if (nextPrinterToActivate < MaxPrinters) return;
+
+  bool force = forceRefresh;
+  // Pushed state changes are handled right away. Pushed progress updates
+  // are handled no more often than the normal refresh interval.
+  uint32_t sinceLastRefresh = millis() - lastRefreshCompleted;
+  uint32_t refreshInterval = netSettings().refreshInterval * 1000L;
+  if (pushRefreshUrgent) force = true;
+  else if (pushRefreshWanted && sinceLastRefresh >= refreshInterval) force = true;
+
+  // While every printer is pushing its changes, polling is just a fallback
+  uint32_t pollInterval = refreshInterval;
+  if (allPrintersPushing(false)) pollInterval *= PushPollMultiplier;
+  if (!force && !requests.due(pollRequests, pollInterval)) return;
+
+  // Only check for a touch when a refresh is due; it costs an SPI transaction
+  if (deferForTouch()) return;
+  RequestScheduler::Request request(requests, pollRequests, force);
+  if (!request) return;
+  if (force) {
+    pushRefreshUrgent = pushRefreshWanted = false;
+    forceRefresh = false;
+  }
+  // The request scheduler decides when a refresh is due rather than PrinterGroup
+  printerGroup->refreshPrinterData(true);
+}
+
+void MultiMonApp::activateNextPrinter() {
+  // Inactive printers cost nothing to "activate", so skip past them
+  // without waiting. Active printers are spaced out.
+  while (nextPrinterToActivate < MaxPrinters) {
+    int i = nextPrinterToActivate;
+    bool isActive = netSettings().printer[i].isActive;
+    // Activating a printer looks up its host, so it waits its turn
+    if (isActive && !requests.acquire(activationRequests)) return;
+    nextPrinterToActivate++;
+    if (isActive) syncClientSettings(i, true);
+    printerPolled[i] = false;
+    printerGroup->activatePrinter(i);
+    if (isActive) {
+      updatePushClient(i);
+      updateSnapshotClient(i);
+      requests.release(activationRequests);
+      break;
+    }
+  }
+
+  if (nextPrinterToActivate == MaxPrinters) {
+    PerfStats::markBoot(PerfStats::BootPhase::PrintersActivated);
+  }
+}
+
+void MultiMonApp::reconfigurePrinter(int index, Reconfigure what) {
+  switch (what) {
+    case Reconfigure::None:
+      return;
+    case Reconfigure::Relabel:
+      // PrinterGroup reports the nickname from its copy of the settings
+      clientSettings[index].nickname = netSettings().printer[index].nickname;
+      return;
+    case Reconfigure::Reconnect:
+      updatePushClient(index);
+      return;
+    default:
+      break;
+  }
+
+  // Everything else replaces the printer's client. A new server is looked up first.
+  bool resolve = what >= Reconfigure::Resolve && netSettings().printer[index].isActive;
+  syncClientSettings(index, resolve);
+  printerPolled[index] = false;
+  printerGroup->activatePrinter(index);
+  updatePushClient(index);
+  updateSnapshotClient(index);
+  forceRefresh = true;
 }
 
+void MultiMonApp::acknowledgePrinter(int index) {
+  if (snapshotClients[index]) {
+    snapshotClients[index]->acknowledgeCompletion();
+  } else {
+    PrintClient* printer = printerGroup->getPrinter(index);
+    if (printer == nullptr) return;
+    printer->acknowledgeCompletion();
+  }
+
+  // Show the change right away rather than after the next refresh
+  publishSnapshots();
+}
+
+void MultiMonApp::publishSnapshots() {
+  snapshotVersion++;
+  for (int i = 0; i < MaxPrinters; i++) {
+    PrinterSnapshot& snapshot = snapshots[i].back();
+    if (snapshotClients[i]) {
+      snapshotClients[i]->capture(snapshot);
+      snapshot.refreshed = snapshotClients[i]->hasRefreshed();
+    } else {
+      snapshot.capture(printerGroup->getPrinter(i), clientSettings[i].isActive);
+      snapshot.refreshed = printerPolled[i];
+    }
+    snapshot.version = snapshotVersion;
+    snapshots[i].publish();
+  }
+  lastClientPublish = millis();
+  clientProgressPending = false;
+
+#if defined(MM_NETWORK_TASK)
+  refreshPublished = true;    // Picked up by the "refreshResults" task
+#else
+  printerDataRefreshed();
+#endif
+}
+
+void MultiMonApp::printerDataRefreshed() {
+  bool anyLive = false;
+  for (int i = 0; i < MaxPrinters; i++) {
+    snapshots[i].update();
+    const PrinterSnapshot& printer = snapshots[i].current();
+    if (!printer.active) {
+      CompletionQueue::remove(i);
+      continue;
+    }
+    // A snapshot may be published (e.g. for another printer) before this
+    // printer has answered. Until it has, keep showing its cached state.
+    printerLive[i] = printer.refreshed;
+    if (!printer.refreshed) continue;
+    anyLive = true;
+    PrinterStateCache::update(i, printer);
+    if (printer.state == PrintClient::State::Printing) {
+      uint32_t uptime = millis()/1000;
+      eta[i].addSample(uptime, printer.pct, printer.timeLeft);
+      recordHistory(i, printer, uptime);
+      CompletionQueue::update(i, now() + printTimeLeft(i));
+    } else {
+      eta[i].reset();
+      CompletionQueue::remove(i);
+    }
+  }
+  PrinterStateCache::saveIfNeeded();
+  if (anyLive) PerfStats::markBoot(PerfStats::BootPhase::FirstLivePoll);
+
+  homeScreen->requestUpdate();
+}
+
+void MultiMonApp::recordHistory(int index, const PrinterSnapshot& printer, uint32_t now) {
+  PrintHistory& h = history[index];
+  // A drop in progress means a new job has started. The history of the
+  // previous job is kept until then so it can be reviewed after completion.
+  if (h.size() != 0 && printer.pct + 1.0f < h.newest().pct()) h.reset();
+
+  h.record(now, printer.bedActual, printer.toolActual, printer.pct);
+}
+
+void MultiMonApp::syncClientSettings(int index, bool resolve) {
+  PrinterSettings& ps = clientSettings[index];
+  ps = netSettings().printer[index];
+  if (ps.mock) return;
+
+  CachedHost& host = printerHosts[index];
+  host.setHost(ps.server);
+  if (resolve && host.needsRefresh()) host.refresh();
+  ps.server = host.address();
+
+  // Keep PrinterGroup from creating a client of its own for printers
+  // handled by a SnapshotClient. See updateSnapshotClient().
+  if (SnapshotClient::handles(ps.type)) ps.isActive = false;
+  else if (SnapshotClient::omitted(ps.type)) {
+    MM_LOG_WARNING(F("Printer %d: %s printers aren't supported by this build"), index, ps.type.c_str());
+    ps.isActive = false;
+  }
+}
+
+void MultiMonApp::refreshHostAddresses() {
+  // Check at most one printer per call so a slow lookup doesn't stall the loop
+  int i = nextHostToCheck;
+  nextHostToCheck = (nextHostToCheck + 1) % MaxPrinters;
+
+  bool isActive = clientSettings[i].isActive || snapshotClients[i];
+  if (!isActive || clientSettings[i].mock) return;
+  CachedHost& host = printerHosts[i];
+  if (!host.needsRefresh() || deferForTouch()) return;
+  RequestScheduler::Request request(requests, lookupRequests);
+  if (!request) {
+    nextHostToCheck = i;    // Try this host again next time
+    return;
+  }
+
+  if (host.refresh()) {
+    // The printer's client was set up with the old address; rebuild it
+    MM_LOG_TRACE(F("Printer %d: %s is now at %s"), i, host.getHost().c_str(), host.address().c_str());
+    clientSettings[i].server = host.address();
+    printerPolled[i] = false;
+    printerGroup->activatePrinter(i);
+    updatePushClient(i);
+    updateSnapshotClient(i);
+  }
+}
+
+void MultiMonApp::updatePushClient(int index) {
+#if MM_FEATURE_OCTO_PUSH
+  // clientSettings marks printers with a SnapshotClient inactive, so the
+  // printer's own settings decide, but the resolved address is used
+  const PrinterSettings& printer = netSettings().printer[index];
+  const PrinterSettings& ps = clientSettings[index];
+  bool wantPush =
+    netSettings().octoPush && printer.isActive && !printer.mock && printer.type.equalsIgnoreCase("OctoPrint");
+
+  if (!wantPush) {
+    if (pushClients[index]) {
+      pushClients[index]->end();
+      delete pushClients[index];
+      pushClients[index] = nullptr;
+    }
+    return;
+  }
+
+  if (!pushClients[index]) pushClients[index] = new OctoPushClient();
+  bool viaClient = usesSnapshotClient(printer);
+  pushClients[index]->begin(ps.server, ps.port, ps.apiKey, [this, viaClient](bool urgent) {
+    if (viaClient) (urgent ? this->clientPushUrgent : this->clientPushWanted) = true;
+    else (urgent ? this->pushRefreshUrgent : this->pushRefreshWanted) = true;
+  });
+#endif
+}
+
+void MultiMonApp::updateSnapshotClient(int index) {
+  const PrinterSettings& ps = clientSettings[index];
+  SnapshotClient*& client = snapshotClients[index];
+  bool wanted = usesSnapshotClient(netSettings().printer[index]);
+
+  if (client && (!wanted || !ps.type.equalsIgnoreCase(client->type()))) {
+    delete client;
+    client = nullptr;
+  }
+  if (!wanted) return;
+
+  if (!client) client = SnapshotClient::create(ps.type);
+  client->begin(ps);
+}
+
+void MultiMonApp::serviceSnapshotClients() {
+  bool anyClients = false;
+  for (int i = 0; i < MaxPrinters; i++) { if (snapshotClients[i]) anyClients = true; }
+  if (!anyClients) return;
+
+  // Pushed changes are handled as they are in pollPrinters()
+  uint32_t refreshInterval = netSettings().refreshInterval * 1000L;
+  bool force = forceRefresh || clientPushUrgent ||
+      (clientPushWanted && (millis() - lastClientRefresh) >= refreshInterval);
+  uint32_t pollInterval = refreshInterval;
+  if (allPrintersPushing(true)) pollInterval *= PushPollMultiplier;
+  bool refreshDue = force || requests.due(clientRequests, pollInterval);
+  if (refreshDue && deferForTouch()) refreshDue = false;
+  // Refreshes block, so they take their turn with other requests
+  if (refreshDue && !requests.acquire(clientRequests, force)) refreshDue = false;
+  if (refreshDue) {
+    clientPushUrgent = clientPushWanted = false;
+    lastClientRefresh = millis();
+  }
+
+  // Thumbnails are fetched a request at a time, in passes with no refresh
+  if (!refreshDue && !deferForTouch()) fetchNextThumbnail();
+
+  bool stateChanged = false;
+  for (int i = 0; i < MaxPrinters; i++) {
+    SnapshotClient* client = snapshotClients[i];
+    if (client == nullptr) continue;
+    client->loop();
+    if (refreshDue) client->refresh();
+    switch (client->takeChange()) {
+      case SnapshotClient::Change::State: stateChanged = true; break;
+      case SnapshotClient::Change::Progress: clientProgressPending = true; break;
+      default: break;
+    }
+  }
+  if (refreshDue) requests.release(clientRequests);
+
+  // State changes are published right away. Progress is rate limited.
+  if (stateChanged ||
+      (clientProgressPending && (millis() - lastClientPublish) >= MinClientPublishInterval)) {
+    publishSnapshots();
+  }
+}
+
+void MultiMonApp::fetchNextThumbnail() {
+  for (int i = 0; i < MaxPrinters; i++) {
+    SnapshotClient* client = snapshotClients[i];
+    if (client == nullptr || !client->thumbnailPending()) continue;
+    RequestScheduler::Request request(requests, thumbnailRequests);
+    if (request) client->fetchThumbnail();
+    return;
+  }
+}
+
+void MultiMonApp::printerDataSupplier(const String& key, String& val) {
+  // Every value comes from the printers' snapshots rather than PrinterGroup,
+  // whose clients may be in the middle of a refresh.
+  if (key.equals(F("next"))) {
+    String printerName, formattedTime;
+    uint32_t delta;
+    nextCompletion(printerName, formattedTime, delta);
+    if (printerName.isEmpty()) return;
+    val = printerName;
+    val += F(": ");
+    val += formattedTime;
+    return;
+  }
+
+  // Per-printer keys are of the form "N.subkey" with N from 1 to 4
+  int index = key.charAt(0) - '1';
+  if (key.charAt(1) != '.' || index < 0 || index >= MaxPrinters) return;
+
+  const PrinterSettings& ps = mmSettings->printer[index];
+  const PrinterSnapshot& printer = printerSnapshot(index);
+  bool printing = (printer.active && printer.state == PrintClient::State::Printing);
+  const char* subkey = key.c_str() + 2;
+
+  if (strcmp(subkey, "name") == 0) {
+    val = ps.nickname.isEmpty() ? ps.server : ps.nickname;
+  } else if (strcmp(subkey, "pct") == 0) {
+    if (printing) val.concat((int)printer.pct);
+  } else if (strcmp(subkey, "next") == 0) {
+    if (printing) TimeFormat::appendDayAndTime(now() + printTimeLeft(index), val);
+  } else if (strcmp(subkey, "remaining") == 0) {
+    if (printing) val = WebThing::formattedInterval(printTimeLeft(index));
+  } else if (strcmp(subkey, "status") == 0) {
+    // "pct|status", with an empty status while printing
+    if (!printing) val = "100|";
+    else val = String((int)printer.pct) + "|";
+    if (!printer.active) val += "Offline";
+    else switch (printer.state) {
+      case PrintClient::State::Offline: val += "Offline"; break;
+      case PrintClient::State::Operational: val += "Online"; break;
+      case PrintClient::State::Complete: val += "Complete"; break;
+      default: break;
+    }
+  }
+}
+
+bool MultiMonApp::allPrintersPushing(bool viaSnapshotClients) {
+  // Printers are refreshed as a group, so polling can only be slowed down
+  // if every active printer in the group is covered by a push connection
+#if MM_FEATURE_OCTO_PUSH
+  bool anyActive = false;
+  for (int i = 0; i < MaxPrinters; i++) {
+    bool inGroup = viaSnapshotClients
+        ? snapshotClients[i] != nullptr
+        : clientSettings[i].isActive && !clientSettings[i].mock;
+    if (!inGroup) continue;
+    anyActive = true;
+    if (!pushClients[i] || !pushClients[i]->isConnected()) return false;
+  }
+  return anyActive;
+#else
+  return false;
+#endif
+}
+
+bool MultiMonApp::deferForTouch() {
+  // With MM_NETWORK_TASK the blocking work is on the other core, which must
+  // not use the SPI bus shared with the display
+#if defined(TOUCH_CS) && !defined(MM_NETWORK_TASK)
+  if (Display.tft.getTouchRawZ() <= TouchPressureThreshold) {
+    touchDeferralStart = 0;
+    return false;
+  }
+  if (touchDeferralStart == 0) touchDeferralStart = millis();
+  // Don't let a finger resting on the screen stop refreshes altogether
+  return (millis() - touchDeferralStart) < MaxTouchDeferral;
+#else
+  return false;
+#endif
+}
@@ -15,6 +15,13 @@
  * o Macros are provided to easily get the app and settings in their
  *   specialized forms.
  *
+ * o On the ESP32, defining MM_NETWORK_TASK (see MMFeatures.h) moves the network side of the
+ *   app (printer activation and polling, push connections, and host name
+ *   lookups) to a FreeRTOS task on core 0. The UI stays on core 1 and
+ *   never waits on the network. The two sides share nothing but the
+ *   printer snapshots, a copy of the settings, and a few atomic request
+ *   flags.
+ *
  * Customization:
  * o To add a new screen to the app, declare it here and instantiate it
  *   in the associated .cpp file.
@@ -26,15 +33,27 @@
 
 //--------------- Begin:  Includes ---------------------------------------------
 //                                  Core Libraries
+#include <atomic>
 //                                  Third Party Libraries
 #include <BPA_PrinterGroup.h>
 //                                  WebThing Includes
 #include <WTAppImpl.h>
 //                                  Local Includes
+#include "MMFeatures.h"
 #include "MMSettings.h"
+#include "src/clients/CachedHost.h"
+#include "src/clients/OctoPushClient.h"
+#include "src/clients/SnapshotClient.h"
+#include "src/printers/EtaEstimator.h"
+#include "src/printers/PrintHistory.h"
+#include "src/printers/PrinterSnapshot.h"
 #include "src/screens/DetailScreen.h"
+#include "src/screens/GraphScreen.h"
 #include "src/screens/SplashScreen.h"
 #include "src/screens/HomeScreen.h"
+#include "src/util/RequestScheduler.h"
+#include "src/util/SnapshotBuffer.h"
+#include "src/util/TaskScheduler.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -52,11 +71,17 @@ public:
 
   // CUSTOM: Screens implemented by this app
   DetailScreen*	  detailScreen;
+  GraphScreen*    graphScreen;
   SplashScreen*   splashScreen;
   HomeScreen*     homeScreen;
 
   // CUSTOM: Data defined by this app which is available to the whole app
-  PrinterGroup*   printerGroup;
+  PrinterGroup*   printerGroup = nullptr;
+  TaskScheduler   scheduler;
+#if defined(MM_NETWORK_TASK)
+  TaskScheduler   networkScheduler;   // Run by the network task on core 0
+#endif
+  RequestScheduler requests;          // Paces the blocking requests of the network side
   
   // ----- Functions that *must* be provided by subclasses
   virtual void app_registerDataSuppliers() override;
@@ -66,12 +91,167 @@ public:
   virtual void app_conditionalUpdate(bool force = false) override;
   virtual void app_loop() override;
 
+  // What a change to a printer's settings requires, from least to most work.
+  // Each level includes whatever the levels below it do.
+  enum class Reconfigure : uint8_t {
+    None,
+    Relabel,          // Only the nickname changed
+    Reconnect,        // Restart the push connection (octoPush changed)
+    Reauthenticate,   // The credentials changed: rebuild the client
+    Resolve,          // The server or port changed: look it up and rebuild the client
+    Reactivate        // The type, active, or mock setting changed
+  };
+  static Reconfigure reconfigurationFor(const PrinterSettings& before, const PrinterSettings& after);
+
   // ----- Public functions
   MultiMonApp(MMSettings* settings);
-  void printerWasActivated(int index);
+  // Hand the network side a copy of the printer settings. Call this after
+  // changing them and before the calls to printerSettingsChanged().
+  void publishSettings();
+  void printerSettingsChanged(int index, Reconfigure what);
+  void acknowledgeCompletion(int index);
+
+  // The state of a printer as of its last refresh. Screens and the Web UI
+  // use this rather than the PrintClient, which may be in the middle of a
+  // refresh. The snapshot doesn't change until printerDataRefreshed() takes
+  // up the next one, so a reference may be held while drawing.
+  const PrinterSnapshot& printerSnapshot(int index) const { return snapshots[index].current(); }
+
+  // Has printer data been refreshed since the printer was activated? Until
+  // it has, screens may show the (stale) state from the PrinterStateCache
+  bool isPrinterLive(int index) { return printerLive[index]; }
+
+  // The time remaining for a printer's current job, smoothed by its
+  // EtaEstimator. Screens should use these rather than asking the
+  // PrintClient directly.
+  uint32_t printTimeLeft(int index);
+  void nextCompletion(String& printerName, String& formattedTime, uint32_t& delta);
+
+  // Temperature and progress history for a printer's current or last job
+  const PrintHistory& printHistory(int index) { return history[index]; }
 
  private:
+  // The app's own work is run by the scheduler from app_loop. Lower
+  // priority tasks wait for the next loop once LoopBudget is used up
+  static constexpr uint32_t LoopBudget = 20 * 1000L;  // micros
+  std::atomic<bool> forceRefresh{false};
+
+  // The network side publishes a snapshot of every printer at the end of
+  // each refresh. The UI side takes them in printerDataRefreshed().
+  SnapshotBuffer<PrinterSnapshot> snapshots[MaxPrinters];
+  uint32_t snapshotVersion = 0;
+
+  // The settings the network side works from. It never reads mmSettings,
+  // whose Strings the UI side may be rewriting. See publishSettings().
+  struct NetworkSettings {
+    PrinterSettings printer[MaxPrinters];
+    uint32_t refreshInterval = 0;   // seconds
+    bool     octoPush = false;
+  };
+#if defined(MM_NETWORK_TASK)
+  // Taken up by the "reconfigure" task
+  SnapshotBuffer<NetworkSettings> networkSettings;
+  const NetworkSettings& netSettings() const { return networkSettings.current(); }
+#else
+  NetworkSettings networkSettings;
+  const NetworkSettings& netSettings() const { return networkSettings; }
+#endif
+
+#if defined(MM_NETWORK_TASK)
+  static constexpr uint32_t NetworkTaskStack = 12 * 1024;   // bytes
+  static constexpr uint8_t  NetworkTaskCore = 0;
+  TaskHandle_t networkTask = nullptr;
+  // Requests from the UI side. Reconfigurations have a byte per printer
+  // with one bit per Reconfigure level. Acknowledgements have a bit per printer.
+  std::atomic<uint32_t> pendingReconfigurations{0};
+  std::atomic<uint8_t> pendingAcknowledgements{0};
+  // Results from the network side
+  std::atomic<bool> networkBusy{false};
+  std::atomic<bool> refreshPublished{false};
+  bool activityShown = false;
+
+  static void runNetworkTask(void* param);
+#endif
+
+  // Printers are activated one at a time by a scheduled task rather than all
+  // at once in app_initClients so that the GUI stays responsive during boot
+  static constexpr uint32_t PrinterActivationStagger = 500;  // millis
+  uint8_t  nextPrinterToActivate = MaxPrinters;
+  bool     printerLive[MaxPrinters] = {false};
+  EtaEstimator eta[MaxPrinters];
+  PrintHistory history[MaxPrinters];
+
+  // The settings handed to the PrinterGroup. They are a copy of the user's
+  // settings except that the server name is replaced by its cached IP address
+  PrinterSettings clientSettings[MaxPrinters];
+  CachedHost      printerHosts[MaxPrinters];
+  // Has PrinterGroup refreshed the printer since it was last activated?
+  bool            printerPolled[MaxPrinters] = {false};
+  uint8_t         nextHostToCheck = 0;
+
+  // Optional push connections to OctoPrint printers. While every active
+  // printer has a live push connection, polling is slowed down by
+  // PushPollMultiplier and pushed changes trigger a refresh instead. This
+  // applies separately to PrinterGroup and to the SnapshotClients, since
+  // OctoPrint printers may be handled by either (see MM_FEATURE_OCTOPRINT).
+  static constexpr uint8_t PushPollMultiplier = 6;
+  OctoPushClient* pushClients[MaxPrinters] = {nullptr};
+
+  // Clients for printer types that PrinterGroup doesn't handle. They are
+  // refreshed on the same interval, but on their own schedule. Progress
+  // they report is published at most every MinClientPublishInterval.
+  static constexpr uint32_t MinClientPublishInterval = 2000;  // millis
+  SnapshotClient* snapshotClients[MaxPrinters] = {nullptr};
+  uint32_t lastClientPublish = 0;
+  bool     clientProgressPending = false;
+  bool     pushRefreshUrgent = false;
+  bool     pushRefreshWanted = false;
+  bool     clientPushUrgent = false;
+  bool     clientPushWanted = false;
+  uint32_t lastRefreshCompleted = 0;
+  uint32_t lastClientRefresh = 0;
+
+  // Sources of network requests (see RequestScheduler). Budgets are in
+  // milliseconds per minute; urgent refreshes ignore them, so an offline
+  // printer can't take up most of the loop with timeouts.
+  static constexpr uint32_t PollBudget = 20 * 1000L;
+  static constexpr uint32_t ClientRefreshBudget = 15 * 1000L;
+  static constexpr uint32_t LookupBudget = 5 * 1000L;
+  static constexpr uint32_t ThumbnailBudget = 5 * 1000L;
+  int8_t pollRequests = -1;
+  int8_t clientRequests = -1;
+  int8_t activationRequests = -1;
+  int8_t lookupRequests = -1;
+  int8_t thumbnailRequests = -1;
+
+  // Printer refreshes and DNS lookups block the loop. While the screen is
+  // being touched they are put off (for at most MaxTouchDeferral) so the
+  // GUI can respond to the tap first.
+  static constexpr uint16_t TouchPressureThreshold = 600;
+  static constexpr uint32_t MaxTouchDeferral = 2000;  // millis
+  uint32_t touchDeferralStart = 0;
+
+  // Is the printer monitored by one of the app's own clients rather than
+  // by PrinterGroup? See SnapshotClient.
+  static bool usesSnapshotClient(const PrinterSettings& ps);
   void showPrinterActivity(bool busy);
+  void scheduleTasks();
+  void pollPrinters();
+  void activateNextPrinter();
+  void reconfigurePrinter(int index, Reconfigure what);
+  void acknowledgePrinter(int index);
+  void publishSnapshots();
+  void printerDataRefreshed();
+  void recordHistory(int index, const PrinterSnapshot& snapshot, uint32_t now);
+  void syncClientSettings(int index, bool resolve);
+  void refreshHostAddresses();
+  void updatePushClient(int index);
+  void updateSnapshotClient(int index);
+  void serviceSnapshotClients();
+  void fetchNextThumbnail();
+  void printerDataSupplier(const String& key, String& val);
+  bool allPrintersPushing(bool viaSnapshotClients);
+  bool deferForTouch();
 };
 
 
@@ -85,4 +265,8 @@ public:
   #error ERROR: DEVICE_TYPE must be DEVICE_TYPE_TOUCH
 #endif
 
+#if defined(MM_NETWORK_TASK) && !defined(ESP32)
+  #error ERROR: MM_NETWORK_TASK requires an ESP32
+#endif
+
 #endif	// MultiMonApp_h
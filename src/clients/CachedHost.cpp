@@ -0,0 +1,63 @@
+/*
+ * CachedHost
+ *    Resolve a hostname once and reuse the resulting IP address until a
+ *    time-to-live expires.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+  #include <WiFi.h>
+#endif
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "CachedHost.h"
+#include "../util/PerfStats.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+void CachedHost::setHost(const String& host) {
+  if (host == _host) return;
+  _host = host;
+  _resolved = _attempted = false;
+  _isLiteral = _ip.fromString(_host);
+}
+
+String CachedHost::address() const {
+  if (_isLiteral || !_resolved) return _host;
+  return _ip.toString();
+}
+
+bool CachedHost::needsRefresh() const {
+  if (_isLiteral || _host.isEmpty()) return false;
+  if (!_attempted) return true;
+  return (millis() - _lastAttempt) >= (_resolved ? TTL : RetryInterval);
+}
+
+bool CachedHost::refresh() {
+  if (_isLiteral || _host.isEmpty()) return false;
+
+  String previous = address();
+  IPAddress ip;
+  bool found;
+  {
+    PerfStats::Scope timer(PerfStats::Case::HostLookup);
+    found = WiFi.hostByName(_host.c_str(), ip);
+  }
+  _attempted = true;
+  _lastAttempt = millis();
+
+  if (found) {
+    _ip = ip;
+    _resolved = true;
+  } else {
+    // Keep using the last good address (if any) until the next attempt
+    MM_LOG_WARNING(F("CachedHost: unable to resolve %s"), _host.c_str());
+  }
+  return address() != previous;
+}
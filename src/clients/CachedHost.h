@@ -0,0 +1,56 @@
+/*
+ * CachedHost
+ *    Resolve a hostname once and reuse the resulting IP address until a
+ *    time-to-live expires, rather than resolving it on every request.
+ *
+ * NOTES:
+ * o If the host is already given as an IP address, no lookup is performed.
+ * o If a lookup fails (which is common for mDNS names such as foo.local),
+ *   address() returns the hostname so that the caller behaves exactly as
+ *   it would have without the cache. The lookup is retried after a short
+ *   interval.
+ *
+ */
+
+#ifndef CachedHost_h
+#define CachedHost_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <IPAddress.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class CachedHost {
+public:
+  static constexpr uint32_t TTL = 30 * 60 * 1000L;          // 30 minutes
+  static constexpr uint32_t RetryInterval = 60 * 1000L;     // 1 minute
+
+  // Set the host to be resolved. If it differs from the current host, any
+  // cached address is discarded.
+  void setHost(const String& host);
+  const String& getHost() const { return _host; }
+
+  // The address that should be used to reach the host. This is the cached
+  // IP address if there is one, otherwise the hostname itself
+  String address() const;
+
+  // Is a lookup required (never resolved, TTL expired, or retry due)?
+  bool needsRefresh() const;
+
+  // Look up the host. Returns true if the result of address() changed
+  bool refresh();
+
+private:
+  String    _host;
+  IPAddress _ip;
+  bool      _isLiteral = false;
+  bool      _resolved = false;
+  bool      _attempted = false;
+  uint32_t  _lastAttempt = 0;
+};
+
+#endif  // CachedHost_h
@@ -0,0 +1,306 @@
+/*
+ * MoonrakerClient
+ *    Monitor a Klipper printer through Moonraker's websocket API
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "MoonrakerClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constants and Utility Functions
+ *
+ *----------------------------------------------------------------------------*/
+
+static constexpr const char* WebsocketPath = "/websocket";
+
+// The printer objects and fields to subscribe to
+static const char* SubscribeParams =
+  "\"params\":{\"objects\":{"
+    "\"print_stats\":[\"state\",\"filename\",\"print_duration\"],"
+    "\"display_status\":[\"progress\"],"
+    "\"heater_bed\":[\"temperature\",\"target\"],"
+    "\"extruder\":[\"temperature\",\"target\"]}}";
+
+// The filter is built with F() keys, which ArduinoJson copies into the
+// filter document, so its size is its slots plus its keys. A key used in
+// more than one place is only copied once.
+static constexpr size_t StatusFilterSize =
+    JSON_OBJECT_SIZE(4) +                               // {print_stats, display_status, heater_bed, extruder}
+    JSON_OBJECT_SIZE(3) + JSON_OBJECT_SIZE(1) +         // print_stats, display_status
+    JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(2);          // heater_bed, extruder
+static constexpr size_t StatusFilterKeys =
+    sizeof("print_stats") + sizeof("state") + sizeof("filename") + sizeof("print_duration") +
+    sizeof("display_status") + sizeof("progress") + sizeof("heater_bed") + sizeof("extruder") +
+    sizeof("temperature") + sizeof("target");
+static constexpr size_t MessageFilterSize =
+    JSON_OBJECT_SIZE(5) +                               // {method, id, error, result, params}
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(1) +         // error: {message}, result: {status}
+    JSON_ARRAY_SIZE(1) +                                // params: [status]
+    2 * StatusFilterSize + StatusFilterKeys +
+    sizeof("method") + sizeof("id") + sizeof("error") + sizeof("message") +
+    sizeof("result") + sizeof("status") + sizeof("params");
+
+// Mirror the subscription in a deserialization filter
+static void addStatusFilter(JsonObject status) {
+  JsonObject printStats = status.createNestedObject(F("print_stats"));
+  printStats[F("state")] = true;
+  printStats[F("filename")] = true;
+  printStats[F("print_duration")] = true;
+  status[F("display_status")][F("progress")] = true;
+  status[F("heater_bed")][F("temperature")] = true;
+  status[F("heater_bed")][F("target")] = true;
+  status[F("extruder")][F("temperature")] = true;
+  status[F("extruder")][F("target")] = true;
+}
+
+// Merge a temperature if it was sent. Returns true if it moved noticeably.
+static bool mergeTemp(JsonObjectConst heater, const __FlashStringHelper* field, float& value) {
+  JsonVariantConst v = heater[field];
+  if (v.isNull()) return false;
+  float previous = value;
+  value = v.as<float>();
+  return fabsf(value - previous) >= MoonrakerClient::TempChangeThreshold;
+}
+
+// The filter for every message, built on first use. Moonraker also sends
+// notifications we didn't ask for (e.g. gcode responses and proc_stat
+// updates). Only materialize what we need.
+static const JsonDocument& messageFilter() {
+  static StaticJsonDocument<MessageFilterSize> filter;
+  if (filter.isNull()) {
+    filter[F("method")] = true;
+    filter[F("id")] = true;
+    filter[F("error")][F("message")] = true;
+    addStatusFilter(filter[F("result")].createNestedObject(F("status")));
+    addStatusFilter(filter[F("params")][0].to<JsonObject>());
+  }
+  return filter;
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+void MoonrakerClient::begin(const PrinterSettings& ps) {
+  uint16_t port = ps.port ? ps.port : DefaultPort;
+  if (_running && ps.server == _host && port == _port && ps.apiKey == _apiKey) return;
+
+  end();
+  _host = ps.server;
+  _port = port;
+  _apiKey = ps.apiKey;
+  _unansweredRefreshes = 0;
+  setRefreshed(false);
+  if (_host.isEmpty()) return;
+
+  if (!_apiKey.isEmpty()) {
+    String header = F("X-Api-Key: ");
+    header += _apiKey;
+    _ws.setExtraHeaders(header.c_str());
+  } else {
+    _ws.setExtraHeaders();
+  }
+  _ws.onEvent([this](WStype_t type, uint8_t* payload, size_t length) {
+    this->handleEvent(type, payload, length);
+  });
+  _ws.setReconnectInterval(ReconnectInterval);
+  _ws.begin(_host, _port, WebsocketPath);
+  _running = true;
+}
+
+void MoonrakerClient::end() {
+  if (!_running) return;
+  _ws.disconnect();
+  _running = _connected = _subscribed = false;
+  _printState[0] = '\0';
+  updateState();
+}
+
+void MoonrakerClient::loop() {
+  if (_running) _ws.loop();
+}
+
+void MoonrakerClient::refresh() {
+  // Updates arrive on their own. Only retry a subscription that failed
+  // (or was never answered), e.g. because Klipper wasn't ready.
+  if (_connected && !_subscribed) subscribe();
+  // A printer that hasn't answered in that long is offline
+  if (!hasRefreshed() && ++_unansweredRefreshes >= MaxUnansweredRefreshes) setRefreshed(true);
+}
+
+void MoonrakerClient::capture(PrinterSnapshot& snapshot) const {
+  snapshot.active = true;
+  snapshot.state = _state;
+  snapshot.pct = (_state == PrintClient::State::Complete) ? 100 : _progress * 100;
+  snapshot.timeLeft = timeLeft();
+  snapshot.elapsed = _elapsed;
+  snapshot.bedActual = _bedActual;
+  snapshot.bedTarget = _bedTarget;
+  snapshot.toolActual = _toolActual;
+  snapshot.toolTarget = _toolTarget;
+  memcpy(snapshot.filename, _filename, sizeof(_filename));
+  snapshot.thumbnail = false;
+}
+
+void MoonrakerClient::acknowledgeCompletion() {
+  if (_state != PrintClient::State::Complete) return;
+  _acknowledged = true;
+  updateState();
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+void MoonrakerClient::subscribe() {
+  // Any answer to an earlier request is ignored from here on
+  _subscribeId = _nextRequestId++;
+  String msg = F("{\"jsonrpc\":\"2.0\",\"method\":\"printer.objects.subscribe\",");
+  msg += SubscribeParams;
+  msg += F(",\"id\":");
+  msg += _subscribeId;
+  msg += '}';
+  _ws.sendTXT(msg);
+}
+
+void MoonrakerClient::handleEvent(WStype_t type, uint8_t* payload, size_t length) {
+  switch (type) {
+    case WStype_CONNECTED:
+      _connected = true;
+      MM_LOG_TRACE(F("MoonrakerClient: connected to %s"), _host.c_str());
+      subscribe();
+      break;
+    case WStype_DISCONNECTED:
+      if (_connected) MM_LOG_TRACE(F("MoonrakerClient: disconnected from %s"), _host.c_str());
+      _connected = _subscribed = false;
+      _printState[0] = '\0';
+      updateState();
+      setRefreshed(true);
+      break;
+    case WStype_TEXT:
+      handleMessage(payload, length);
+      break;
+    default:
+      break;
+  }
+}
+
+void MoonrakerClient::handleMessage(uint8_t* payload, size_t length) {
+  StaticJsonDocument<768> doc;
+  DeserializationError err =
+    deserializeJson(doc, (const char*)payload, length, DeserializationOption::Filter(messageFilter()));
+  if (err) return;
+
+  const char* method = doc[F("method")];
+  if (method == nullptr) {
+    // A response. The only requests sent are subscriptions.
+    if ((doc[F("id")] | 0UL) != _subscribeId) return;
+    if (doc.containsKey(F("error"))) {
+      MM_LOG_WARNING(F("MoonrakerClient: %s: subscription failed: %s"),
+          _host.c_str(), doc[F("error")][F("message")] | "");
+      _subscribed = false;
+      _printState[0] = '\0';
+      updateState();
+      setRefreshed(true);
+      return;
+    }
+    _subscribed = true;
+    setRefreshed(true);
+    // The response holds the full value of every field
+    merge(doc[F("result")][F("status")]);
+    noteChange(Change::State);
+    return;
+  }
+
+  if (strcmp(method, "notify_status_update") == 0) {
+    if (_subscribed) merge(doc[F("params")][0]);
+  } else if (strcmp(method, "notify_klippy_ready") == 0) {
+    subscribe();
+  } else if (strcmp(method, "notify_klippy_shutdown") == 0 ||
+             strcmp(method, "notify_klippy_disconnected") == 0) {
+    // Moonraker drops the subscription along with Klipper
+    _subscribed = false;
+    _printState[0] = '\0';
+    updateState();
+  }
+}
+
+void MoonrakerClient::merge(JsonObjectConst status) {
+  bool changed = false;
+
+  JsonObjectConst printStats = status[F("print_stats")];
+  const char* printState = printStats[F("state")];
+  if (printState) {
+    strncpy(_printState, printState, sizeof(_printState)-1);
+    _printState[sizeof(_printState)-1] = '\0';
+  }
+  const char* name = printStats[F("filename")];
+  if (name) {
+    strncpy(_filename, name, PrinterSnapshot::MaxFilenameLength);
+    _filename[PrinterSnapshot::MaxFilenameLength] = '\0';
+    changed = true;
+  }
+  _elapsed = printStats[F("print_duration")] | (float)_elapsed;
+
+  JsonVariantConst progress = status[F("display_status")][F("progress")];
+  if (!progress.isNull()) {
+    float previous = _progress;
+    _progress = progress.as<float>();
+    changed = changed || (int)(previous * 100) != (int)(_progress * 100);
+  }
+
+  JsonObjectConst bed = status[F("heater_bed")];
+  JsonObjectConst tool = status[F("extruder")];
+  // Evaluate every merge; don't let || skip any
+  changed = mergeTemp(bed, F("temperature"), _bedActual) || changed;
+  changed = mergeTemp(bed, F("target"), _bedTarget) || changed;
+  changed = mergeTemp(tool, F("temperature"), _toolActual) || changed;
+  changed = mergeTemp(tool, F("target"), _toolTarget) || changed;
+
+  if (changed) noteChange(Change::Progress);
+  updateState();
+}
+
+void MoonrakerClient::updateState() {
+  PrintClient::State state;
+  if (!_subscribed || _printState[0] == '\0') {
+    state = PrintClient::State::Offline;
+  } else if (strcmp(_printState, "printing") == 0 || strcmp(_printState, "paused") == 0) {
+    state = PrintClient::State::Printing;
+    _acknowledged = false;
+  } else if (strcmp(_printState, "complete") == 0 && !_acknowledged) {
+    state = PrintClient::State::Complete;
+  } else {
+    // standby, cancelled, error, or an acknowledged completion
+    state = PrintClient::State::Operational;
+  }
+  setState(state);
+}
+
+void MoonrakerClient::setState(PrintClient::State state) {
+  if (state == _state) return;
+  _state = state;
+  noteChange(Change::State);
+}
+
+uint32_t MoonrakerClient::timeLeft() const {
+  // Moonraker doesn't estimate the time left. Extrapolate from the progress
+  // so far; the app's ETA estimator smooths this out.
+  if (_state != PrintClient::State::Printing || _progress <= 0.0f || _progress >= 1.0f) return 0;
+  return (uint32_t)(_elapsed / _progress - _elapsed);
+}
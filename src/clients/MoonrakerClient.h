@@ -0,0 +1,92 @@
+/*
+ * MoonrakerClient
+ *    Monitor a Klipper printer through Moonraker's websocket API. The client
+ *    subscribes to the printer objects it needs and is then sent only the
+ *    fields that change.
+ *
+ * NOTES:
+ * o The subscription covers print_stats, display_status, heater_bed, and
+ *   extruder, and asks for just the fields used here. The response to the
+ *   subscription carries their full values. After that, Moonraker sends
+ *   notify_status_update messages that hold only the fields that changed.
+ *   Those fields are merged into the state kept here.
+ * o Moonraker batches notifications (about every 250ms). Temperatures
+ *   change in nearly every one, so they are merged without reporting a
+ *   change unless they move by at least TempChangeThreshold.
+ * o Klipper may restart or shut down while Moonraker stays up. Its objects
+ *   can't be subscribed to until it is ready again, so the subscription is
+ *   renewed on notify_klippy_ready, or on the next refresh() if it failed.
+ * o If Moonraker requires authorization, the printer's API key is sent in
+ *   the X-Api-Key header of the websocket request.
+ * o Klipper keeps reporting "complete" until the next print starts. Once
+ *   acknowledgeCompletion() is called, that is reported as Operational.
+ *
+ */
+
+#ifndef MoonrakerClient_h
+#define MoonrakerClient_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+#include <WebSocketsClient.h>
+//                                  Local Includes
+#include "SnapshotClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+class MoonrakerClient : public SnapshotClient {
+public:
+  static constexpr const char* TypeName = "Moonraker";
+  static constexpr uint16_t DefaultPort = 7125;
+  static constexpr uint32_t ReconnectInterval = 30 * 1000L;
+  static constexpr float TempChangeThreshold = 1.0f;   // degrees
+  // Until the printer answers it is treated as offline once this many
+  // refreshes have passed. The first may come right after begin().
+  static constexpr uint8_t MaxUnansweredRefreshes = 2;
+
+  ~MoonrakerClient() { end(); }
+
+  const char* type() const override { return TypeName; }
+  void begin(const PrinterSettings& ps) override;
+  void loop() override;
+  void refresh() override;
+  void capture(PrinterSnapshot& snapshot) const override;
+  void acknowledgeCompletion() override;
+
+  void end();
+
+private:
+  WebSocketsClient _ws;
+  String   _host;
+  uint16_t _port = 0;
+  String   _apiKey;
+  bool     _running = false;
+  bool     _connected = false;
+  bool     _subscribed = false;
+  uint32_t _nextRequestId = 1;
+  uint32_t _subscribeId = 0;     // The id of the outstanding subscription request
+  uint8_t  _unansweredRefreshes = 0;
+
+  // The merged printer objects
+  PrintClient::State _state = PrintClient::State::Offline;
+  bool     _acknowledged = false;
+  char     _printState[12] = "";  // print_stats.state
+  float    _progress = 0;         // display_status.progress: 0.0 to 1.0
+  uint32_t _elapsed = 0;          // print_stats.print_duration
+  float    _bedActual = 0, _bedTarget = 0;
+  float    _toolActual = 0, _toolTarget = 0;
+  char     _filename[PrinterSnapshot::MaxFilenameLength+1] = "";
+
+  void subscribe();
+  void handleEvent(WStype_t type, uint8_t* payload, size_t length);
+  void handleMessage(uint8_t* payload, size_t length);
+  void merge(JsonObjectConst status);
+  void updateState();
+  void setState(PrintClient::State state);
+  uint32_t timeLeft() const;
+};
+
+#endif  // MoonrakerClient_h
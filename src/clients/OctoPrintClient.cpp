@@ -0,0 +1,230 @@
+/*
+ * OctoPrintClient
+ *    Monitor an OctoPrint server through its REST API
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#if defined(ESP8266)
+  #include <ESP8266HTTPClient.h>
+#elif defined(ESP32)
+  #include <HTTPClient.h>
+#endif
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "OctoPrintClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constants and Utility Functions
+ *
+ *----------------------------------------------------------------------------*/
+
+// /api/printer answers with this while OctoPrint isn't connected to the printer
+static constexpr int HttpConflict = 409;
+
+// The filters are built with F() keys, which ArduinoJson copies into the
+// filter document, so each filter's size is its slots plus its keys. A key
+// used in more than one place is only copied once.
+static constexpr size_t PrinterFilterSize =
+    JSON_OBJECT_SIZE(2) +                               // {state, temperature}
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(6) +         // state: {flags: {operational, error, printing...}}
+    JSON_OBJECT_SIZE(2) +                               // temperature: {bed, tool0}
+    JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(2) +         // bed, tool0: {actual, target}
+    sizeof("state") + sizeof("flags") + sizeof("operational") + sizeof("error") +
+    sizeof("printing") + sizeof("pausing") + sizeof("paused") + sizeof("cancelling") +
+    sizeof("temperature") + sizeof("bed") + sizeof("tool0") + sizeof("actual") + sizeof("target");
+static constexpr size_t JobFilterSize =
+    JSON_OBJECT_SIZE(2) +                               // {job, progress}
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(1) +         // job: {file: {name}}
+    JSON_OBJECT_SIZE(3) +                               // progress: {completion, printTime, printTimeLeft}
+    sizeof("job") + sizeof("file") + sizeof("name") + sizeof("progress") +
+    sizeof("completion") + sizeof("printTime") + sizeof("printTimeLeft");
+
+// What the filters keep, the keys copied with it, and room for the longest
+// key the filters drop, which is read before it is discarded
+static constexpr size_t PrinterDocSize = 512;
+static constexpr size_t JobDocSize = 512;
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+void OctoPrintClient::begin(const PrinterSettings& ps) {
+  uint16_t port = ps.port ? ps.port : 80;
+  if (ps.server == _host && port == _port && ps.apiKey == _apiKey) return;
+
+  _host = ps.server;
+  _port = port;
+  _apiKey = ps.apiKey;
+  _busy = false;
+  _pct = 0;
+  _elapsed = _timeLeft = 0;
+  _filename[0] = '\0';
+  setState(PrintClient::State::Offline);
+  setRefreshed(false);
+}
+
+void OctoPrintClient::refresh() {
+  if (_host.isEmpty()) return;
+  _refreshBytes = _parseMicros = 0;
+
+  bool wasBusy = _busy;
+  bool ok = pollPrinter();
+  // The job is only of interest while it runs, and when it ends
+  bool online = ok && _state != PrintClient::State::Offline;
+  if (online && (_busy || wasBusy)) ok = pollJob();
+
+  if (!ok) {
+    setState(PrintClient::State::Offline);
+    _busy = false;
+  } else if (_busy) {
+    setState(PrintClient::State::Printing);
+  } else if (_state != PrintClient::State::Offline) {
+    // Just finished, or finished earlier and not yet acknowledged
+    bool completed = (wasBusy && _pct >= 100) || _state == PrintClient::State::Complete;
+    setState(completed ? PrintClient::State::Complete : PrintClient::State::Operational);
+  }
+
+  _lastRefreshBytes = _refreshBytes;
+  _lastParseMicros = _parseMicros;
+  setRefreshed(true);
+  MM_LOG_VERBOSE(F("OctoPrintClient: %s: %d bytes, %d us"), _host.c_str(), _lastRefreshBytes, _lastParseMicros);
+}
+
+void OctoPrintClient::capture(PrinterSnapshot& snapshot) const {
+  snapshot.active = true;
+  snapshot.state = _state;
+  snapshot.pct = (_state == PrintClient::State::Complete) ? 100 : _pct;
+  snapshot.timeLeft = _timeLeft;
+  snapshot.elapsed = _elapsed;
+  snapshot.bedActual = _bedActual;
+  snapshot.bedTarget = _bedTarget;
+  snapshot.toolActual = _toolActual;
+  snapshot.toolTarget = _toolTarget;
+  memcpy(snapshot.filename, _filename, sizeof(_filename));
+  snapshot.thumbnail = false;
+}
+
+void OctoPrintClient::acknowledgeCompletion() {
+  if (_state == PrintClient::State::Complete) setState(PrintClient::State::Operational);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+// Returns the response's status code, or 0 if a 200 response couldn't be parsed
+int OctoPrintClient::request(const String& path, const JsonDocument& filter, JsonDocument& doc) {
+  WiFiClient client;
+  HTTPClient http;
+
+  http.setTimeout(RequestTimeout);
+  http.begin(client, _host, _port, path);
+  http.addHeader(F("X-Api-Key"), _apiKey);
+  int code = http.GET();
+  if (code != HTTP_CODE_OK) {
+    if (code != HttpConflict) {
+      MM_LOG_WARNING(F("OctoPrintClient: %s%s failed (%d)"), _host.c_str(), path.c_str(), code);
+    }
+    http.end();
+    return code;
+  }
+
+  int size = http.getSize();
+  if (size > 0) _refreshBytes += size;
+  uint32_t start = micros();
+  DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+  _parseMicros += micros() - start;
+  http.end();
+  if (err) {
+    MM_LOG_WARNING(F("OctoPrintClient: bad response from %s: %s"), _host.c_str(), err.c_str());
+    return 0;
+  }
+  return code;
+}
+
+bool OctoPrintClient::pollPrinter() {
+  StaticJsonDocument<PrinterFilterSize> filter;
+  JsonObject flags = filter.createNestedObject(F("state")).createNestedObject(F("flags"));
+  flags[F("operational")] = true;
+  flags[F("error")] = true;
+  flags[F("printing")] = true;
+  flags[F("pausing")] = true;
+  flags[F("paused")] = true;
+  flags[F("cancelling")] = true;
+  JsonObject temps = filter.createNestedObject(F("temperature"));
+  temps[F("bed")][F("actual")] = true;
+  temps[F("bed")][F("target")] = true;
+  temps[F("tool0")][F("actual")] = true;
+  temps[F("tool0")][F("target")] = true;
+
+  DynamicJsonDocument doc(PrinterDocSize);
+  int code = request(F("/api/printer?exclude=sd,history"), filter, doc);
+  if (code == HttpConflict) {
+    // The server is up, but the printer isn't connected to it
+    _busy = false;
+    _bedActual = _bedTarget = _toolActual = _toolTarget = 0;
+    setState(PrintClient::State::Offline);
+    return true;
+  }
+  if (code != HTTP_CODE_OK) return false;
+
+  JsonObjectConst f = doc[F("state")][F("flags")];
+  if (!(f[F("operational")] | false) || (f[F("error")] | false)) {
+    _busy = false;
+    setState(PrintClient::State::Offline);
+    return true;
+  }
+  _busy = (f[F("printing")] | false) || (f[F("pausing")] | false) ||
+          (f[F("paused")] | false) || (f[F("cancelling")] | false);
+  // Offline until now; refresh() settles on the state from here
+  if (_state == PrintClient::State::Offline) setState(PrintClient::State::Operational);
+
+  JsonObjectConst t = doc[F("temperature")];
+  _bedActual = t[F("bed")][F("actual")] | 0.0f;
+  _bedTarget = t[F("bed")][F("target")] | 0.0f;
+  _toolActual = t[F("tool0")][F("actual")] | 0.0f;
+  _toolTarget = t[F("tool0")][F("target")] | 0.0f;
+  return true;
+}
+
+bool OctoPrintClient::pollJob() {
+  StaticJsonDocument<JobFilterSize> filter;
+  filter[F("job")][F("file")][F("name")] = true;
+  JsonObject progress = filter.createNestedObject(F("progress"));
+  progress[F("completion")] = true;
+  progress[F("printTime")] = true;
+  progress[F("printTimeLeft")] = true;
+
+  DynamicJsonDocument doc(JobDocSize);
+  if (request(F("/api/job"), filter, doc) != HTTP_CODE_OK) return false;
+
+  const char* name = doc[F("job")][F("file")][F("name")];
+  strncpy(_filename, name ? name : "", PrinterSnapshot::MaxFilenameLength);
+  _filename[PrinterSnapshot::MaxFilenameLength] = '\0';
+  // Each of these is null until OctoPrint knows it
+  JsonObjectConst p = doc[F("progress")];
+  _pct = min(100.0f, p[F("completion")] | 0.0f);
+  _elapsed = p[F("printTime")] | 0;
+  _timeLeft = p[F("printTimeLeft")] | 0;
+  noteChange(Change::Progress);
+  return true;
+}
+
+void OctoPrintClient::setState(PrintClient::State state) {
+  if (state == _state) return;
+  _state = state;
+  noteChange(Change::State);
+}
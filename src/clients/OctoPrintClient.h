@@ -0,0 +1,75 @@
+/*
+ * OctoPrintClient
+ *    Monitor an OctoPrint server with the smallest requests its REST API
+ *    allows, rather than with PrinterGroup's client.
+ *
+ * NOTES:
+ * o Each refresh asks for /api/printer with the sd and history sub-trees
+ *   excluded. The response is parsed through a filter that keeps only the
+ *   state flags and the bed and tool0 temperatures.
+ * o /api/job is only requested while a print is underway, and once more
+ *   when it ends to learn whether it reached the end of its file.
+ * o OctoPrint answers /api/printer with 409 while it isn't connected to
+ *   the printer. The server is up, but the printer is reported as Offline.
+ * o OctoPrint doesn't send ETag or Last-Modified headers for these
+ *   endpoints, so every request is unconditional. The filters keep what
+ *   is parsed (and stored) small even though the responses aren't.
+ * o OctoPrint has no notion of an acknowledged completion. After a print
+ *   that reached the end of its file, the printer is reported as Complete
+ *   until acknowledgeCompletion() is called or another print starts.
+ *
+ */
+
+#ifndef OctoPrintClient_h
+#define OctoPrintClient_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+#include "SnapshotClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+class OctoPrintClient : public SnapshotClient {
+public:
+  static constexpr const char* TypeName = "OctoPrint";
+  static constexpr uint16_t RequestTimeout = 5000;   // millis
+
+  const char* type() const override { return TypeName; }
+  void begin(const PrinterSettings& ps) override;
+  void refresh() override;
+  void capture(PrinterSnapshot& snapshot) const override;
+  void acknowledgeCompletion() override;
+
+  // The number of response bytes received by the last refresh, and the
+  // time spent reading and parsing them
+  uint32_t lastRefreshBytes() const { return _lastRefreshBytes; }
+  uint32_t lastParseMicros() const { return _lastParseMicros; }
+
+private:
+  String   _host;
+  uint16_t _port = 0;
+  String   _apiKey;
+
+  PrintClient::State _state = PrintClient::State::Offline;
+  bool     _busy = false;   // Printing, paused, etc.
+  float    _pct = 0;
+  uint32_t _elapsed = 0;
+  uint32_t _timeLeft = 0;
+  float    _bedActual = 0, _bedTarget = 0;
+  float    _toolActual = 0, _toolTarget = 0;
+  char     _filename[PrinterSnapshot::MaxFilenameLength+1] = "";
+
+  uint32_t _refreshBytes = 0, _parseMicros = 0;
+  uint32_t _lastRefreshBytes = 0, _lastParseMicros = 0;
+
+  int  request(const String& path, const JsonDocument& filter, JsonDocument& doc);
+  bool pollPrinter();
+  bool pollJob();
+  void setState(PrintClient::State state);
+};
+
+#endif  // OctoPrintClient_h
@@ -0,0 +1,209 @@
+/*
+ * OctoPushClient
+ *    Subscribe to OctoPrint's push API and report interesting changes
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#if defined(ESP8266)
+  #include <ESP8266HTTPClient.h>
+#elif defined(ESP32)
+  #include <HTTPClient.h>
+#endif
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "OctoPushClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constants
+ *
+ *----------------------------------------------------------------------------*/
+
+static constexpr const char* PushPath = "/sockjs/websocket";
+static constexpr const char* LoginPath = "/api/login";
+
+// Events that indicate a change in the printer's state
+static const char* const StateEvents[] = {
+  "PrintStarted", "PrintDone", "PrintFailed", "PrintCancelled",
+  "PrintPaused", "PrintResumed", "Connected", "Disconnected", "Error"
+};
+
+// The message filter is built with F() keys, which ArduinoJson copies into
+// the filter document, so its size is its slots plus its keys
+static constexpr size_t MessageFilterSize =
+    JSON_OBJECT_SIZE(2) +                               // {current, event}
+    JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(1) +         // current: {state: {flags}, progress}
+    JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(1) +         // flags: {printing, operational}, progress: {completion}
+    JSON_OBJECT_SIZE(1) +                               // event: {type}
+    sizeof("current") + sizeof("state") + sizeof("flags") + sizeof("printing") +
+    sizeof("operational") + sizeof("progress") + sizeof("completion") + sizeof("event") + sizeof("type");
+
+// A "current" message keeps the same fields. Each key the filter drops is
+// still read into the document's free space, so leave room for the longest
+// (e.g. progress.printTimeLeftOrigin).
+static constexpr size_t MaxDroppedKeyLength = 32;
+static constexpr size_t MessageDocSize =
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(1) +
+    JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(1) +
+    sizeof("current") + sizeof("state") + sizeof("flags") + sizeof("printing") +
+    sizeof("operational") + sizeof("progress") + sizeof("completion") + MaxDroppedKeyLength;
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+void OctoPushClient::begin(const String& host, uint16_t port, const String& apiKey, ChangeCallback cb) {
+  _cb = cb;
+  if (_running && host == _host && port == _port && apiKey == _apiKey) return;
+
+  end();
+  _host = host;
+  _port = port;
+  _apiKey = apiKey;
+  _lastPrinting = _lastOperational = -1;
+  _lastPct = -1;
+
+  _ws.onEvent([this](WStype_t type, uint8_t* payload, size_t length) {
+    this->handleEvent(type, payload, length);
+  });
+  _ws.setReconnectInterval(ReconnectInterval);
+  _ws.begin(_host, _port, PushPath);
+  _running = true;
+}
+
+void OctoPushClient::end() {
+  if (!_running) return;
+  _ws.disconnect();
+  _running = false;
+  _authenticated = false;
+}
+
+void OctoPushClient::loop() {
+  if (_running) _ws.loop();
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+bool OctoPushClient::login(String& auth) {
+  WiFiClient client;
+  HTTPClient http;
+
+  http.begin(client, _host, _port, LoginPath);
+  http.addHeader(F("X-Api-Key"), _apiKey);
+  http.addHeader(F("Content-Type"), F("application/json"));
+  int code = http.POST(F("{\"passive\":true}"));
+  if (code != HTTP_CODE_OK) {
+    MM_LOG_WARNING(F("OctoPushClient: login to %s failed (%d)"), _host.c_str(), code);
+    http.end();
+    return false;
+  }
+
+  StaticJsonDocument<64> filter;
+  filter[F("name")] = true;
+  filter[F("session")] = true;
+  DynamicJsonDocument doc(256);
+  DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+  http.end();
+  if (err) {
+    MM_LOG_WARNING(F("OctoPushClient: bad login response from %s: %s"), _host.c_str(), err.c_str());
+    return false;
+  }
+
+  auth = doc[F("name")].as<String>();
+  auth += ':';
+  auth += doc[F("session")].as<String>();
+  return true;
+}
+
+void OctoPushClient::handleEvent(WStype_t type, uint8_t* payload, size_t length) {
+  switch (type) {
+    case WStype_CONNECTED: {
+      String auth;
+      if (!login(auth)) {
+        // The library will reconnect (and we'll try again) after ReconnectInterval
+        _ws.disconnect();
+        return;
+      }
+      String msg = "{\"auth\":\"" + auth + "\"}";
+      _ws.sendTXT(msg);
+      msg = "{\"throttle\":" + String(Throttle) + "}";
+      _ws.sendTXT(msg);
+      // Supported by OctoPrint 1.8+. Ignored by older versions.
+      _ws.sendTXT("{\"subscribe\":{\"state\":{\"logs\":false,\"messages\":false},\"events\":true,\"plugins\":false}}");
+      _authenticated = true;
+      MM_LOG_TRACE(F("OctoPushClient: connected to %s"), _host.c_str());
+      // We may have missed something while disconnected
+      if (_cb) _cb(true);
+      break;
+    }
+    case WStype_DISCONNECTED:
+      if (_authenticated) MM_LOG_TRACE(F("OctoPushClient: disconnected from %s"), _host.c_str());
+      _authenticated = false;
+      break;
+    case WStype_TEXT:
+      handleMessage(payload, length);
+      break;
+    default:
+      break;
+  }
+}
+
+void OctoPushClient::handleMessage(uint8_t* payload, size_t length) {
+  // "current" messages can be several KB. Only materialize what we need.
+  StaticJsonDocument<MessageFilterSize> filter;
+  JsonObject current = filter.createNestedObject(F("current"));
+  JsonObject flags = current[F("state")].createNestedObject(F("flags"));
+  flags[F("printing")] = true;
+  flags[F("operational")] = true;
+  current[F("progress")][F("completion")] = true;
+  filter[F("event")][F("type")] = true;
+
+  StaticJsonDocument<MessageDocSize> doc;
+  if (deserializeJson(doc, (const char*)payload, length, DeserializationOption::Filter(filter))) return;
+
+  if (doc.containsKey(F("event"))) {
+    const char* eventType = doc[F("event")][F("type")];
+    if (eventType == nullptr) return;
+    for (const char* stateEvent : StateEvents) {
+      if (strcmp(eventType, stateEvent) == 0) {
+        if (_cb) _cb(true);
+        return;
+      }
+    }
+    return;
+  }
+
+  JsonObjectConst state = doc[F("current")][F("state")][F("flags")].as<JsonObjectConst>();
+  if (state.isNull()) return;
+
+  int8_t printing = state[F("printing")].as<bool>() ? 1 : 0;
+  int8_t operational = state[F("operational")].as<bool>() ? 1 : 0;
+  float completion = doc[F("current")][F("progress")][F("completion")] | -1.0f;
+  int16_t pct = (completion < 0) ? -1 : (int16_t)completion;
+
+  // The first message after connecting just establishes a baseline. The
+  // app was already told to refresh when the connection was established.
+  bool first = (_lastPrinting == -1);
+  bool urgent = (printing != _lastPrinting || operational != _lastOperational);
+  bool progressed = (pct != _lastPct);
+  _lastPrinting = printing;
+  _lastOperational = operational;
+  _lastPct = pct;
+
+  if (!first && (urgent || progressed) && _cb) _cb(urgent);
+}
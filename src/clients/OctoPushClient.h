@@ -0,0 +1,74 @@
+/*
+ * OctoPushClient
+ *    Subscribe to OctoPrint's push API (the SockJS endpoint, used here as a
+ *    plain websocket) and report when something interesting happens so that
+ *    the app can refresh the printer immediately rather than waiting for
+ *    the next poll.
+ *
+ * NOTES:
+ * o This client does not replace the polling client. It only tells the app
+ *   *when* to poll. The app polls much less often while the push connection
+ *   is up and falls back to normal polling if it drops.
+ * o Authentication uses a passive login with the printer's API key to get a
+ *   session, which is then sent over the socket as an "auth" message.
+ * o OctoPrint is asked to throttle "current" messages. Events such as
+ *   PrintDone are not throttled, so completion is reported promptly.
+ *
+ */
+
+#ifndef OctoPushClient_h
+#define OctoPushClient_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <functional>
+//                                  Third Party Libraries
+#include <WebSocketsClient.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class OctoPushClient {
+public:
+  // urgent is true for state changes (a print started, finished, failed, etc.)
+  // and false for progress updates which may be handled at a slower pace
+  using ChangeCallback = std::function<void(bool urgent)>;
+
+  // Throttle multiplier for "current" messages. OctoPrint's base rate is
+  // one message every 500ms, so this yields one every 2 seconds.
+  static constexpr uint8_t Throttle = 4;
+  static constexpr uint32_t ReconnectInterval = 30 * 1000L;
+
+  // Start (or restart) the connection. If the client is already running
+  // with the same parameters, this does nothing.
+  void begin(const String& host, uint16_t port, const String& apiKey, ChangeCallback cb);
+  void end();
+
+  // Must be called frequently to service the socket
+  void loop();
+
+  bool isRunning() const { return _running; }
+  bool isConnected() const { return _running && _authenticated; }
+
+private:
+  WebSocketsClient _ws;
+  ChangeCallback _cb;
+  String   _host;
+  uint16_t _port = 0;
+  String   _apiKey;
+  bool     _running = false;
+  bool     _authenticated = false;
+  uint32_t _nextLoginAttempt = 0;
+
+  // The last values reported so that only changes generate callbacks
+  int8_t   _lastPrinting = -1;
+  int8_t   _lastOperational = -1;
+  int16_t  _lastPct = -1;
+
+  bool login(String& auth);
+  void handleEvent(WStype_t type, uint8_t* payload, size_t length);
+  void handleMessage(uint8_t* payload, size_t length);
+};
+
+#endif  // OctoPushClient_h
@@ -0,0 +1,426 @@
+/*
+ * RRF3Client
+ *    Monitor a RepRapFirmware 3 printer using its object model
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#if defined(ESP8266)
+  #include <ESP8266HTTPClient.h>
+#elif defined(ESP32)
+  #include <HTTPClient.h>
+#endif
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "RRF3Client.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constants and Utility Functions
+ *
+ *----------------------------------------------------------------------------*/
+
+// Values of state.status while a job is underway
+static const char* const BusyStates[] = {
+  "processing", "simulating", "pausing", "paused", "resuming", "cancelling"
+};
+
+// rr_thumbnail returns up to about 1K of base64 text at a time
+static constexpr size_t ThumbnailChunkDocSize = 1536;
+
+// The filters are built with F() keys, which ArduinoJson copies into the
+// filter document, so each filter's size is its slots plus its keys
+static constexpr size_t ConnectFilterSize =
+    JSON_OBJECT_SIZE(2) +                               // {err, sessionKey}
+    sizeof("err") + sizeof("sessionKey");
+static constexpr size_t StatusFilterSize =
+    JSON_OBJECT_SIZE(1) +                               // {result}
+    sizeof("result");
+static constexpr size_t LiveFilterSize =
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(4) +         // {result: {state, heat, job, seqs}}
+    JSON_OBJECT_SIZE(1) +                               // state: {status}
+    JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(1) +  // heat: {heaters: [{current}]}
+    JSON_OBJECT_SIZE(3) +                               // job: {duration, filePosition, timesLeft}
+    JSON_OBJECT_SIZE(2) +                               // seqs: {job, heat}
+    sizeof("result") + sizeof("state") + sizeof("status") + sizeof("heat") + sizeof("heaters") +
+    sizeof("current") + sizeof("job") + sizeof("duration") + sizeof("filePosition") +
+    sizeof("timesLeft") + sizeof("seqs");
+static constexpr size_t JobFilterSize =
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(4) +         // {result: {file, lastFile...}}
+    JSON_OBJECT_SIZE(2) +                               // file: {fileName, size}
+    sizeof("result") + sizeof("file") + sizeof("fileName") + sizeof("size") +
+    sizeof("lastFileName") + sizeof("lastFileAborted") + sizeof("lastFileCancelled");
+static constexpr size_t HeatFilterSize =
+    JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(2) +         // {result: {bedHeaters, heaters}}
+    JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(1) +          // heaters: [{active}]
+    sizeof("result") + sizeof("bedHeaters") + sizeof("heaters") + sizeof("active");
+static constexpr size_t FileInfoFilterSize =
+    JSON_OBJECT_SIZE(2) +                               // {err, thumbnails}
+    JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(5) +          // thumbnails: [{width, height, fmt, format, offset}]
+    sizeof("err") + sizeof("thumbnails") + sizeof("width") + sizeof("height") +
+    sizeof("fmt") + sizeof("format") + sizeof("offset");
+static constexpr size_t ThumbnailFilterSize =
+    JSON_OBJECT_SIZE(3) +                               // {err, data, next}
+    sizeof("err") + sizeof("data") + sizeof("next");
+
+static void appendEncoded(String& s, const String& value) {
+  static const char* Hex = "0123456789ABCDEF";
+  for (unsigned int i = 0; i < value.length(); i++) {
+    char c = value.charAt(i);
+    if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') { s += c; continue; }
+    s += '%';
+    s += Hex[(c >> 4) & 0x0F];
+    s += Hex[c & 0x0F];
+  }
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+RRF3Client::~RRF3Client() {
+  delete _thumbnailWriter;
+}
+
+void RRF3Client::begin(const PrinterSettings& ps) {
+  uint16_t port = ps.port ? ps.port : 80;
+  if (ps.server == _host && port == _port && ps.pass == _password) return;
+
+  _host = ps.server;
+  _port = port;
+  _password = ps.pass;
+  _sessionKey = "";
+  _jobSeq = _heatSeq = -1;
+  _busy = false;
+  endThumbnail(Thumbnail::None);
+  _jobPath = "";
+  setState(PrintClient::State::Offline);
+  setRefreshed(false);
+}
+
+void RRF3Client::refresh() {
+  if (_host.isEmpty()) return;
+  _refreshBytes = 0;
+
+  bool wasBusy = _busy;
+  bool ok = wasBusy ? pollLive() : pollStatus();
+  // A print has just started; get its details right away
+  if (ok && _busy && !wasBusy) ok = pollLive();
+
+  if (!ok) {
+    setState(PrintClient::State::Offline);
+    _busy = false;
+    _jobSeq = _heatSeq = -1;
+  }
+  _lastRefreshBytes = _refreshBytes;
+  setRefreshed(true);
+  MM_LOG_VERBOSE(F("RRF3Client: %s: %d bytes"), _host.c_str(), _lastRefreshBytes);
+}
+
+void RRF3Client::capture(PrinterSnapshot& snapshot) const {
+  snapshot.active = true;
+  snapshot.state = _state;
+  snapshot.pct = (_state == PrintClient::State::Complete) ? 100 : pct();
+  snapshot.timeLeft = _timeLeft;
+  snapshot.elapsed = _elapsed;
+  snapshot.bedActual = _bedActual;
+  snapshot.bedTarget = _bedTarget;
+  snapshot.toolActual = _toolActual;
+  snapshot.toolTarget = _toolTarget;
+  memcpy(snapshot.filename, _filename, sizeof(_filename));
+  snapshot.thumbnail = (_thumbnail == Thumbnail::Ready);
+}
+
+void RRF3Client::acknowledgeCompletion() {
+  if (_state == PrintClient::State::Complete) setState(PrintClient::State::Operational);
+}
+
+bool RRF3Client::thumbnailPending() const {
+  return (_thumbnail == Thumbnail::Wanted || _thumbnail == Thumbnail::Fetching) &&
+         _state != PrintClient::State::Offline;
+}
+
+void RRF3Client::fetchThumbnail() {
+  // A request that fails leaves the state as it was, so it is retried
+  if (_thumbnail == Thumbnail::Wanted) findThumbnail();
+  else if (_thumbnail == Thumbnail::Fetching) fetchThumbnailData();
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+bool RRF3Client::connect() {
+  String path = F("/rr_connect?password=");
+  appendEncoded(path, _password.isEmpty() ? String(DefaultPassword) : _password);
+
+  StaticJsonDocument<ConnectFilterSize> filter;
+  filter[F("err")] = true;
+  filter[F("sessionKey")] = true;
+  StaticJsonDocument<64> doc;
+  _sessionKey = "";
+  if (!request(path, filter, doc, false)) return false;
+
+  // 1: wrong password, 2: no more sessions available
+  int err = doc[F("err")] | 1;
+  if (err != 0) {
+    MM_LOG_WARNING(F("RRF3Client: unable to connect to %s (err %d)"), _host.c_str(), err);
+    return false;
+  }
+  if (doc.containsKey(F("sessionKey"))) _sessionKey = String(doc[F("sessionKey")].as<long>());
+  return true;
+}
+
+bool RRF3Client::request(
+    const String& path, const JsonDocument& filter, JsonDocument& doc, bool mayConnect)
+{
+  WiFiClient client;
+  HTTPClient http;
+
+  http.setTimeout(RequestTimeout);
+  http.begin(client, _host, _port, path);
+  if (!_sessionKey.isEmpty()) http.addHeader(F("X-Session-Key"), _sessionKey);
+  int code = http.GET();
+  if (code == HTTP_CODE_UNAUTHORIZED && mayConnect) {
+    // No session, or it timed out
+    http.end();
+    return connect() && request(path, filter, doc, false);
+  }
+  if (code != HTTP_CODE_OK) {
+    MM_LOG_WARNING(F("RRF3Client: %s%s failed (%d)"), _host.c_str(), path.c_str(), code);
+    http.end();
+    return false;
+  }
+
+  int size = http.getSize();
+  if (size > 0) _refreshBytes += size;
+  DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+  http.end();
+  if (err) {
+    MM_LOG_WARNING(F("RRF3Client: bad response from %s: %s"), _host.c_str(), err.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool RRF3Client::pollStatus() {
+  StaticJsonDocument<StatusFilterSize> filter;
+  filter[F("result")] = true;
+  StaticJsonDocument<128> doc;
+  if (!request(F("/rr_model?key=state.status&flags=d99fn"), filter, doc)) return false;
+
+  setStatus(doc[F("result")] | "");
+  return true;
+}
+
+bool RRF3Client::pollLive() {
+  StaticJsonDocument<LiveFilterSize> filter;
+  JsonObject result = filter.createNestedObject(F("result"));
+  result[F("state")][F("status")] = true;
+  result[F("heat")][F("heaters")][0][F("current")] = true;
+  JsonObject job = result.createNestedObject(F("job"));
+  job[F("duration")] = true;
+  job[F("filePosition")] = true;
+  job[F("timesLeft")] = true;
+  result[F("seqs")][F("job")] = true;
+  result[F("seqs")][F("heat")] = true;
+
+  DynamicJsonDocument doc(1024);
+  if (!request(F("/rr_model?flags=d99fn"), filter, doc)) return false;
+  JsonObjectConst r = doc[F("result")];
+
+  JsonObjectConst liveJob = r[F("job")];
+  _elapsed = liveJob[F("duration")] | 0;
+  _filePosition = liveJob[F("filePosition")] | 0;
+  // Prefer the slicer's estimate, then those based on file and filament usage
+  JsonObjectConst timesLeft = liveJob[F("timesLeft")];
+  _timeLeft = timesLeft[F("slicer")] | 0;
+  if (_timeLeft == 0) _timeLeft = timesLeft[F("file")] | 0;
+  if (_timeLeft == 0) _timeLeft = timesLeft[F("filament")] | 0;
+
+  JsonArrayConst heaters = r[F("heat")][F("heaters")];
+  if (_bedHeater >= 0) _bedActual = heaters[_bedHeater][F("current")] | 0.0f;
+  _toolActual = heaters[_toolHeater][F("current")] | 0.0f;
+  noteChange(Change::Progress);
+
+  // Only fetch the sub-trees whose non-live values have changed. A failed
+  // fetch leaves the old sequence number so it is retried next time.
+  int32_t jobSeq = r[F("seqs")][F("job")] | -1;
+  int32_t heatSeq = r[F("seqs")][F("heat")] | -1;
+  if ((jobSeq != _jobSeq || jobSeq == -1) && fetchJob()) _jobSeq = jobSeq;
+  if ((heatSeq != _heatSeq || heatSeq == -1) && fetchHeat()) _heatSeq = heatSeq;
+
+  // The job's outcome may have just been fetched, so the status comes last
+  setStatus(r[F("state")][F("status")] | "");
+  return true;
+}
+
+bool RRF3Client::fetchJob() {
+  StaticJsonDocument<JobFilterSize> filter;
+  JsonObject result = filter.createNestedObject(F("result"));
+  result[F("file")][F("fileName")] = true;
+  result[F("file")][F("size")] = true;
+  result[F("lastFileName")] = true;
+  result[F("lastFileAborted")] = true;
+  result[F("lastFileCancelled")] = true;
+
+  DynamicJsonDocument doc(512);
+  if (!request(F("/rr_model?key=job&flags=d99vn"), filter, doc)) return false;
+  JsonObjectConst r = doc[F("result")];
+
+  const char* name = r[F("file")][F("fileName")];
+  if (name == nullptr) name = r[F("lastFileName")];
+  if (name != nullptr) {
+    const char* path = name;
+    const char* slash = strrchr(name, '/');   // e.g. 0:/gcodes/part.gcode
+    if (slash) name = slash + 1;
+    strncpy(_filename, name, PrinterSnapshot::MaxFilenameLength);
+    _filename[PrinterSnapshot::MaxFilenameLength] = '\0';
+    setJobPath(path);
+  }
+  _fileSize = r[F("file")][F("size")] | _fileSize;
+  _lastJobCompleted = !(r[F("lastFileAborted")] | false) && !(r[F("lastFileCancelled")] | false);
+  return true;
+}
+
+bool RRF3Client::fetchHeat() {
+  StaticJsonDocument<HeatFilterSize> filter;
+  JsonObject result = filter.createNestedObject(F("result"));
+  result[F("bedHeaters")] = true;
+  result[F("heaters")][0][F("active")] = true;
+
+  DynamicJsonDocument doc(512);
+  if (!request(F("/rr_model?key=heat&flags=d99vn"), filter, doc)) return false;
+  JsonObjectConst r = doc[F("result")];
+
+  // The first heater that doesn't belong to the bed is taken to be the tool's
+  _bedHeater = r[F("bedHeaters")][0] | -1;
+  _toolHeater = (_bedHeater == 0) ? 1 : 0;
+  JsonArrayConst heaters = r[F("heaters")];
+  _bedTarget = (_bedHeater >= 0) ? (heaters[_bedHeater][F("active")] | 0.0f) : 0.0f;
+  _toolTarget = heaters[_toolHeater][F("active")] | 0.0f;
+  return true;
+}
+
+void RRF3Client::setJobPath(const char* path) {
+  if (_jobPath == path) return;
+  _jobPath = path;
+  // Thumbnails are cached under the name shown for the job
+  endThumbnail(ThumbnailCache::contains(_filename) ? Thumbnail::Ready : Thumbnail::Wanted);
+}
+
+void RRF3Client::findThumbnail() {
+  String path = F("/rr_fileinfo?name=");
+  appendEncoded(path, _jobPath);
+
+  StaticJsonDocument<FileInfoFilterSize> filter;
+  filter[F("err")] = true;
+  JsonObject entry = filter[F("thumbnails")].createNestedObject();
+  entry[F("width")] = true;
+  entry[F("height")] = true;
+  entry[F("fmt")] = true;
+  entry[F("format")] = true;
+  entry[F("offset")] = true;
+
+  DynamicJsonDocument doc(1024);
+  if (!request(path, filter, doc)) return;
+  if ((doc[F("err")] | 1) != 0) { endThumbnail(Thumbnail::None); return; }
+
+  uint32_t offset = 0;
+  uint16_t chosenSize = 0;
+  for (JsonObjectConst t : doc[F("thumbnails")].as<JsonArrayConst>()) {
+    const char* format = t[F("fmt")] | (t[F("format")] | "");
+    if (strcasecmp(format, "qoi") != 0) continue;
+    uint16_t size = max(t[F("width")] | 0, t[F("height")] | 0);
+    // The smallest that needn't be scaled up, or else the largest
+    bool better = (chosenSize == 0) || (chosenSize < ThumbnailCache::Size
+        ? size > chosenSize
+        : size >= ThumbnailCache::Size && size < chosenSize);
+    if (size && better) { chosenSize = size; offset = t[F("offset")] | 0; }
+  }
+  if (chosenSize == 0) {
+    MM_LOG_TRACE(F("RRF3Client: %s: no QOI thumbnail for %s"), _host.c_str(), _jobPath.c_str());
+    endThumbnail(Thumbnail::None);
+    return;
+  }
+
+  _thumbnailWriter = new ThumbnailCache::Writer(_filename);
+  _thumbnailOffset = offset;
+  _thumbnail = Thumbnail::Fetching;
+}
+
+void RRF3Client::fetchThumbnailData() {
+  String path = F("/rr_thumbnail?name=");
+  appendEncoded(path, _jobPath);
+  path += F("&offset=");
+  path += _thumbnailOffset;
+
+  StaticJsonDocument<ThumbnailFilterSize> filter;
+  filter[F("err")] = true;
+  filter[F("data")] = true;
+  filter[F("next")] = true;
+
+  DynamicJsonDocument doc(ThumbnailChunkDocSize);
+  if (!request(path, filter, doc)) return;
+
+  const char* data = doc[F("data")];
+  uint32_t next = doc[F("next")] | 0;
+  if ((doc[F("err")] | 1) != 0 || data == nullptr || !_thumbnailWriter->addBase64(data)) {
+    MM_LOG_WARNING(F("RRF3Client: %s: unable to read the thumbnail"), _host.c_str());
+    endThumbnail(Thumbnail::None);
+  } else if (next == 0) {
+    endThumbnail(_thumbnailWriter->finish() ? Thumbnail::Ready : Thumbnail::None);
+  } else if (next <= _thumbnailOffset) {
+    endThumbnail(Thumbnail::None);
+  } else {
+    _thumbnailOffset = next;
+  }
+}
+
+void RRF3Client::endThumbnail(Thumbnail result) {
+  delete _thumbnailWriter;
+  _thumbnailWriter = nullptr;
+  if (result == Thumbnail::Ready && _thumbnail != Thumbnail::Ready) noteChange(Change::Progress);
+  _thumbnail = result;
+}
+
+void RRF3Client::setStatus(const char* status) {
+  bool busy = false;
+  for (const char* busyState : BusyStates) {
+    if (strcmp(status, busyState) == 0) { busy = true; break; }
+  }
+
+  PrintClient::State state;
+  if (busy) state = PrintClient::State::Printing;
+  else if (*status == '\0' || strcmp(status, "halted") == 0 || strcmp(status, "disconnected") == 0) {
+    state = PrintClient::State::Offline;
+  }
+  else if (_busy && _lastJobCompleted) state = PrintClient::State::Complete;  // Just finished
+  else if (_state == PrintClient::State::Complete) state = PrintClient::State::Complete;
+  else state = PrintClient::State::Operational;
+
+  _busy = busy;
+  setState(state);
+}
+
+void RRF3Client::setState(PrintClient::State state) {
+  if (state == _state) return;
+  _state = state;
+  noteChange(Change::State);
+}
+
+float RRF3Client::pct() const {
+  if (_fileSize == 0) return 0;
+  return min(100.0f, 100.0f * _filePosition / _fileSize);
+}
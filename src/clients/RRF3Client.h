@@ -0,0 +1,109 @@
+/*
+ * RRF3Client
+ *    Monitor a printer running RepRapFirmware 3 using its object model
+ *    (rr_model) rather than full status requests.
+ *
+ * NOTES:
+ * o While the printer is idle, each refresh asks for nothing but
+ *   state.status, which is a response of a few dozen bytes.
+ * o While printing, each refresh asks for the frequently changing ("live")
+ *   values of the model with flags=d99fn. That response also carries the
+ *   seqs counters. The rest of the job and heat sub-trees (the file name,
+ *   file size, and heater set points) is only fetched when its counter
+ *   changes, and is merged into the state kept here.
+ * o The state sub-tree is tracked through state.status, which is a live
+ *   value, so it never needs to be fetched on its own.
+ * o RRF ends a session after a few seconds without requests. When a
+ *   request is refused, the client reconnects and tries once more.
+ * o The job's thumbnail is found with rr_fileinfo and read with
+ *   rr_thumbnail, which returns it as base64 text about 1K at a time. Only
+ *   QOI thumbnails can be decoded (see ThumbnailCache). The one chosen is
+ *   the smallest that is at least ThumbnailCache::Size, or else the largest.
+ * o RRF has no notion of an acknowledged completion. After a print that
+ *   reached the end of its file, the printer is reported as Complete until
+ *   acknowledgeCompletion() is called or another print starts.
+ *
+ */
+
+#ifndef RRF3Client_h
+#define RRF3Client_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+#include "SnapshotClient.h"
+#include "../printers/ThumbnailCache.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+class RRF3Client : public SnapshotClient {
+public:
+  static constexpr const char* TypeName = "RRF3";
+  static constexpr const char* DefaultPassword = "reprap";
+  static constexpr uint16_t RequestTimeout = 5000;   // millis
+
+  ~RRF3Client();
+
+  const char* type() const override { return TypeName; }
+  void begin(const PrinterSettings& ps) override;
+  void refresh() override;
+  void capture(PrinterSnapshot& snapshot) const override;
+  void acknowledgeCompletion() override;
+  bool thumbnailPending() const override;
+  void fetchThumbnail() override;
+
+  // The number of response bytes received by the last refresh
+  uint32_t lastRefreshBytes() const { return _lastRefreshBytes; }
+
+private:
+  String   _host;
+  uint16_t _port = 0;
+  String   _password;
+  String   _sessionKey;     // Only sent by RRF 3.5 and later
+
+  // The merged object model. Sequence numbers of -1 force a fetch.
+  int32_t  _jobSeq = -1;
+  int32_t  _heatSeq = -1;
+  PrintClient::State _state = PrintClient::State::Offline;
+  bool     _busy = false;   // Printing, paused, etc.
+  bool     _lastJobCompleted = false;
+  uint32_t _fileSize = 0;
+  uint32_t _filePosition = 0;
+  uint32_t _elapsed = 0;
+  uint32_t _timeLeft = 0;
+  int8_t   _bedHeater = 0;
+  int8_t   _toolHeater = 1;
+  float    _bedActual = 0, _bedTarget = 0;
+  float    _toolActual = 0, _toolTarget = 0;
+  char     _filename[PrinterSnapshot::MaxFilenameLength+1] = "";
+
+  // The job's thumbnail. Wanted until rr_fileinfo has been read, then
+  // Fetching until the last piece has been written to the cache.
+  enum class Thumbnail : uint8_t { None, Wanted, Fetching, Ready };
+  Thumbnail _thumbnail = Thumbnail::None;
+  String   _jobPath;        // e.g. 0:/gcodes/part.gcode
+  uint32_t _thumbnailOffset = 0;
+  ThumbnailCache::Writer* _thumbnailWriter = nullptr;
+
+  uint32_t _refreshBytes = 0;
+  uint32_t _lastRefreshBytes = 0;
+
+  bool connect();
+  bool request(const String& path, const JsonDocument& filter, JsonDocument& doc, bool mayConnect = true);
+  bool pollStatus();
+  bool pollLive();
+  bool fetchJob();
+  bool fetchHeat();
+  void setJobPath(const char* path);
+  void findThumbnail();
+  void fetchThumbnailData();
+  void endThumbnail(Thumbnail result);
+  void setStatus(const char* status);
+  void setState(PrintClient::State state);
+  float pct() const;
+};
+
+#endif  // RRF3Client_h
@@ -0,0 +1,43 @@
+/*
+ * SnapshotClient
+ *    Create the printer clients that are implemented by this app
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "SnapshotClient.h"
+#include "MoonrakerClient.h"
+#include "OctoPrintClient.h"
+#include "RRF3Client.h"
+#include "../../MMFeatures.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+SnapshotClient* SnapshotClient::create(const String& type) {
+#if MM_FEATURE_RRF3
+  if (type.equalsIgnoreCase(RRF3Client::TypeName)) return new RRF3Client();
+#endif
+#if MM_FEATURE_MOONRAKER
+  if (type.equalsIgnoreCase(MoonrakerClient::TypeName)) return new MoonrakerClient();
+#endif
+#if MM_FEATURE_OCTOPRINT
+  if (type.equalsIgnoreCase(OctoPrintClient::TypeName)) return new OctoPrintClient();
+#endif
+  return nullptr;
+}
+
+bool SnapshotClient::handles(const String& type) {
+  return (MM_FEATURE_RRF3 && type.equalsIgnoreCase(RRF3Client::TypeName)) ||
+         (MM_FEATURE_MOONRAKER && type.equalsIgnoreCase(MoonrakerClient::TypeName)) ||
+         (MM_FEATURE_OCTOPRINT && type.equalsIgnoreCase(OctoPrintClient::TypeName));
+}
+
+// Without MM_FEATURE_OCTOPRINT, OctoPrint printers fall back to PrinterGroup
+bool SnapshotClient::omitted(const String& type) {
+  return (!MM_FEATURE_RRF3 && type.equalsIgnoreCase(RRF3Client::TypeName)) ||
+         (!MM_FEATURE_MOONRAKER && type.equalsIgnoreCase(MoonrakerClient::TypeName));
+}
@@ -0,0 +1,86 @@
+/*
+ * SnapshotClient
+ *    The interface for printer clients that are implemented by this app
+ *    rather than by PrinterGroup. Instead of answering getter calls, they
+ *    fill in a PrinterSnapshot directly.
+ *
+ * NOTES:
+ * o The app keeps PrinterGroup from creating a client of its own for these
+ *   printers by handing it settings that mark them inactive. Everything
+ *   else in the app sees them through their snapshots like any printer.
+ * o Clients are only used on the network side of the app (see
+ *   MM_NETWORK_TASK in MMFeatures.h). loop() is called on every pass and
+ *   refresh() once per refresh interval. Either may block.
+ * o A client records what has changed as it goes. The app collects the
+ *   changes with takeChange() to decide when to publish new snapshots.
+ *
+ */
+
+#ifndef SnapshotClient_h
+#define SnapshotClient_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <BPA_PrinterSettings.h>
+//                                  Local Includes
+#include "../printers/PrinterSnapshot.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+class SnapshotClient {
+public:
+  // A state change (e.g. a print finished) outranks a progress update
+  enum class Change : uint8_t { None, Progress, State };
+
+  // Returns a new client for printers of the given type, or nullptr if the
+  // type is handled by PrinterGroup
+  static SnapshotClient* create(const String& type);
+  static bool handles(const String& type);
+  // Is this a type of printer that this build leaves out? See MMFeatures.h
+  static bool omitted(const String& type);
+
+  virtual ~SnapshotClient() { }
+
+  // The printer type this client handles, as selected in the Web UI
+  virtual const char* type() const = 0;
+
+  // Start (or restart) the client. ps.server has already been resolved.
+  // If the client is already running with the same settings, this does nothing.
+  virtual void begin(const PrinterSettings& ps) = 0;
+
+  // Service any open connection
+  virtual void loop() { }
+
+  // Bring the printer's state up to date
+  virtual void refresh() = 0;
+
+  // Fill in every field of snapshot other than version and refreshed
+  virtual void capture(PrinterSnapshot& snapshot) const = 0;
+
+  // Does the client know the printer's state? False from begin() with new
+  // settings until the printer has answered (or has clearly failed to).
+  bool hasRefreshed() const { return _refreshed; }
+
+  virtual void acknowledgeCompletion() = 0;
+
+  // Clients that can show a preview of the current job fetch it into the
+  // ThumbnailCache one request at a time. Each call to fetchThumbnail()
+  // makes the next request; it is only called while thumbnailPending().
+  virtual bool thumbnailPending() const { return false; }
+  virtual void fetchThumbnail() { }
+
+  // Returns the most significant change since the last call
+  Change takeChange() { Change c = _change; _change = Change::None; return c; }
+
+protected:
+  void noteChange(Change c) { if (c > _change) _change = c; }
+  void setRefreshed(bool refreshed) { _refreshed = refreshed; }
+
+private:
+  Change _change = Change::None;
+  bool   _refreshed = false;
+};
+
+#endif  // SnapshotClient_h
@@ -0,0 +1,116 @@
+/*
+ * CompletionQueue
+ *    The printers that are currently printing, ordered by expected
+ *    completion time.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <TimeLib.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <WTApp.h>
+//                                  Local Includes
+#include "CompletionQueue.h"
+#include "../util/TimeFormat.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace CompletionQueue {
+  namespace Internal {
+    struct Slot {
+      Entry    entry;
+      String   formatted;
+      uint32_t formattedMinute;   // completesAt/60 when formatted was produced
+      bool     formatted24Hour;
+    };
+
+    Slot    slots[MaxPrinters];
+    Slot*   order[MaxPrinters];   // Sorted by completesAt; the first n are in use
+    uint8_t n = 0;
+    bool    initialized = false;
+
+    void init() {
+      for (int i = 0; i < MaxPrinters; i++) {
+        slots[i].entry.index = i;
+        slots[i].formattedMinute = UINT32_MAX;
+      }
+      initialized = true;
+    }
+
+    // The position of printer i in order[], or -1
+    int find(uint8_t i) {
+      for (int k = 0; k < n; k++) { if (order[k]->entry.index == i) return k; }
+      return -1;
+    }
+
+    // The first position whose completion time is later than t
+    int upperBound(time_t t) {
+      int lo = 0, hi = n;
+      while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (order[mid]->entry.completesAt <= t) lo = mid + 1;
+        else hi = mid;
+      }
+      return lo;
+    }
+
+    void removeAt(int k) {
+      for (; k < n-1; k++) order[k] = order[k+1];
+      n--;
+    }
+  } // ----- END: CompletionQueue::Internal
+
+
+  uint32_t Entry::remaining() const {
+    time_t t = now();
+    return (completesAt > t) ? (completesAt - t) : 0;
+  }
+
+  const String& Entry::formatted() const {
+    Internal::Slot& slot = Internal::slots[index];
+    uint32_t minute = completesAt / 60;
+    bool use24Hour = wtApp->settings->uiOptions.use24Hour;
+    if (minute != slot.formattedMinute || use24Hour != slot.formatted24Hour) {
+      slot.formatted = "";
+      TimeFormat::appendDayAndTime(completesAt, slot.formatted);
+      slot.formattedMinute = minute;
+      slot.formatted24Hour = use24Hour;
+    }
+    return slot.formatted;
+  }
+
+  void update(uint8_t i, time_t completesAt) {
+    using namespace Internal;
+    if (i >= MaxPrinters) return;
+    if (!initialized) init();
+
+    int k = find(i);
+    if (k != -1) {
+      if (order[k]->entry.completesAt == completesAt) return;
+      removeAt(k);
+    }
+
+    Slot* slot = &slots[i];
+    slot->entry.completesAt = completesAt;
+    int pos = upperBound(completesAt);
+    for (int j = n; j > pos; j--) order[j] = order[j-1];
+    order[pos] = slot;
+    n++;
+  }
+
+  void remove(uint8_t i) {
+    int k = Internal::find(i);
+    if (k != -1) Internal::removeAt(k);
+  }
+
+  uint8_t size() { return Internal::n; }
+
+  uint8_t next(const Entry** entries, uint8_t maxEntries) {
+    uint8_t count = min(maxEntries, Internal::n);
+    for (int k = 0; k < count; k++) entries[k] = &Internal::order[k]->entry;
+    return count;
+  }
+};
@@ -0,0 +1,60 @@
+/*
+ * CompletionQueue
+ *    The printers that are currently printing, ordered by expected
+ *    completion time.
+ *
+ * NOTES:
+ * o The queue is updated when a printer's data is refreshed, not when it is
+ *   displayed. Readers (the HomeScreen, the web pages, the /completions
+ *   endpoint) just walk the already-sorted entries.
+ * o Entries are kept in a small sorted array. The insertion point is found
+ *   with a binary search. An update whose completion time hasn't changed
+ *   does nothing.
+ * o Each entry caches its completion time formatted for display (e.g.
+ *   "Tue 4:05PM"). It is only reformatted when the completion time moves
+ *   to a different minute or the 12/24 hour preference changes.
+ *
+ */
+
+#ifndef CompletionQueue_h
+#define CompletionQueue_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <TimeLib.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMSettings.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace CompletionQueue {
+  static constexpr uint8_t MaxPrinters = MMSettings::MaxPrinters;
+
+  struct Entry {
+    uint8_t index;          // The printer's index
+    time_t  completesAt;    // Expected completion (TimeLib time)
+
+    // Seconds remaining as of the current time
+    uint32_t remaining() const;
+    // The completion time formatted for display
+    const String& formatted() const;
+  };
+
+  // Record that printer i is expected to complete at the given time
+  void update(uint8_t i, time_t completesAt);
+
+  // Printer i is no longer printing (or is no longer active)
+  void remove(uint8_t i);
+
+  // The number of printers in the queue
+  uint8_t size();
+
+  // Up to maxEntries of the earliest completions, soonest first. Returns the
+  // number of entries provided. The pointers remain valid until the next
+  // call to update() or remove().
+  uint8_t next(const Entry** entries, uint8_t maxEntries);
+};
+
+#endif  // CompletionQueue_h
@@ -0,0 +1,77 @@
+/*
+ * EtaEstimator
+ *    Smooth the time remaining reported by a printer
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "EtaEstimator.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+// Observed progress gets half the weight once the sample window covers this
+// much progress (in hundredths of a percent)
+static constexpr float FullWeightSpan = 10 * 100.0f;
+static constexpr float MaxObservedWeight = 0.5f;
+// A drop in progress larger than this (in hundredths) means a new job
+static constexpr uint16_t NewJobThreshold = 100;
+
+void EtaEstimator::reset() {
+  _samples.clear();
+  _hasLatest = false;
+}
+
+void EtaEstimator::addSample(uint32_t now, float pct, uint32_t serverTimeLeft) {
+  Sample s = {now, (uint16_t)(constrain(pct, 0.0f, 100.0f) * 100), serverTimeLeft};
+
+  if (_hasLatest && s.pct100 + NewJobThreshold < _latest.pct100) reset();
+
+  _latest = s;
+  _hasLatest = true;
+  if (_samples.isEmpty() || (now - _samples.newest().t) >= MinSampleSpacing) {
+    _samples.push(s);
+  }
+}
+
+bool EtaEstimator::timeLeft(uint32_t now, uint32_t& secondsLeft) const {
+  if (!_hasLatest) return false;
+
+  // The server's estimate, aged by the time since it was reported
+  uint32_t age = now - _latest.t;
+  float serverEstimate = (_latest.timeLeft > age) ? (_latest.timeLeft - age) : 0;
+
+  uint8_t n = _samples.size();
+  bool includeLatest = (_latest.t != _samples.newest().t);
+  if (n + includeLatest < 3) { secondsLeft = serverEstimate; return true; }
+
+  // Least squares fit of pct100 = a + b*(t - t0)
+  uint32_t t0 = _samples.oldest().t;
+  float sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < n + includeLatest; i++) {
+    const Sample& s = (i < n) ? _samples[i] : _latest;
+    float x = s.t - t0;
+    float y = s.pct100;
+    sumX += x; sumY += y; sumXX += x*x; sumXY += x*y;
+    count++;
+  }
+  float denominator = count * sumXX - sumX * sumX;
+  if (denominator <= 0) { secondsLeft = serverEstimate; return true; }
+  float b = (count * sumXY - sumX * sumY) / denominator;
+  if (b <= 0) { secondsLeft = serverEstimate; return true; }   // Stalled or paused
+  float a = (sumY - b * sumX) / count;
+
+  float pctNow = min(a + b * (now - t0), 100 * 100.0f);
+  float observedEstimate = (100 * 100.0f - pctNow) / b;
+  // The printer doesn't estimate (or its estimate has run out)
+  if (serverEstimate == 0) { secondsLeft = (uint32_t)(observedEstimate + 0.5f); return true; }
+
+  float span = (float)_latest.pct100 - (float)_samples.oldest().pct100;
+  float w = MaxObservedWeight * constrain(span / FullWeightSpan, 0.0f, 1.0f);
+  secondsLeft = (uint32_t)((1 - w) * serverEstimate + w * observedEstimate + 0.5f);
+  return true;
+}
@@ -0,0 +1,61 @@
+/*
+ * EtaEstimator
+ *    Smooth the time remaining reported by a printer. The server's estimate
+ *    is blended with an estimate derived from the progress actually observed
+ *    over the last several minutes.
+ *
+ * NOTES:
+ * o Samples are kept in a fixed-size ring buffer, so the memory used per
+ *   printer is bounded (MaxSamples * 12 bytes plus a little overhead).
+ * o Samples are spaced at least MinSampleSpacing apart so that the buffer
+ *   spans a useful window (~8 minutes) regardless of the refresh interval.
+ * o The observed rate is the least squares slope of percent complete vs.
+ *   time. Its weight grows with the amount of progress covered by the
+ *   window, up to an even blend with the server's estimate. Early in a
+ *   print (heating, first layer) the server's estimate dominates.
+ * o A server estimate of 0 means there is none, so once there are enough
+ *   samples the observed estimate is used on its own.
+ * o Times are in seconds from any monotonic base, e.g. millis()/1000.
+ *
+ */
+
+#ifndef EtaEstimator_h
+#define EtaEstimator_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../util/RingBuffer.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+class EtaEstimator {
+public:
+  static constexpr uint8_t  MaxSamples = 16;
+  static constexpr uint32_t MinSampleSpacing = 30;  // Seconds
+
+  // Forget all samples, e.g. because the printer is no longer printing
+  void reset();
+
+  // Record the values most recently reported by the printer
+  void addSample(uint32_t now, float pct, uint32_t serverTimeLeft);
+
+  // Provide the estimated number of seconds remaining as of `now`.
+  // Returns false if there are no samples to base an estimate on.
+  bool timeLeft(uint32_t now, uint32_t& secondsLeft) const;
+
+private:
+  struct Sample {
+    uint32_t t;
+    uint16_t pct100;      // Percent complete in hundredths of a percent
+    uint32_t timeLeft;    // As reported by the server
+  };
+
+  RingBuffer<Sample, MaxSamples> _samples;
+  Sample _latest;
+  bool   _hasLatest = false;
+};
+
+#endif  // EtaEstimator_h
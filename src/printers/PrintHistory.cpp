@@ -0,0 +1,75 @@
+/*
+ * PrintHistory
+ *    A compact record of a print job's temperatures and progress
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "PrintHistory.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+void PrintHistory::reset() {
+  _count = 0;
+  _interval = BaseSampleInterval;
+  _generation++;
+}
+
+bool PrintHistory::record(uint32_t now, float bed, float tool, float pct) {
+  if (_count != 0 && (now - _lastSampleTime) < _interval) return false;
+
+  if (_count == Capacity) compact();
+  int16_t target[N_Channels] = {
+    (int16_t)lroundf(bed), (int16_t)lroundf(tool), (int16_t)lroundf(pct * 2)
+  };
+  append(target);
+  _lastSampleTime = now;
+  return true;
+}
+
+PrintHistory::Sample PrintHistory::first() const {
+  Sample s;
+  for (int c = 0; c < N_Channels; c++) s.value[c] = _base[c];
+  return s;
+}
+
+PrintHistory::Sample PrintHistory::next(const Sample& previous, uint16_t i) const {
+  Sample s;
+  for (int c = 0; c < N_Channels; c++) s.value[c] = previous.value[c] + _delta[i][c];
+  return s;
+}
+
+void PrintHistory::append(const int16_t (&target)[N_Channels]) {
+  if (_count == 0) {
+    for (int c = 0; c < N_Channels; c++) _newest.value[c] = _base[c] = target[c];
+  } else {
+    for (int c = 0; c < N_Channels; c++) {
+      int16_t d = constrain(target[c] - _newest.value[c], INT8_MIN, INT8_MAX);
+      _delta[_count][c] = d;
+      _newest.value[c] += d;
+    }
+  }
+  _count++;
+}
+
+void PrintHistory::compact() {
+  // Decode pairs of samples, average them, and re-encode in place. Writes
+  // trail reads (sample k is written after samples 2k and 2k+1 are read).
+  Sample prev = first();
+  uint16_t n = _count;
+  _count = 0;
+  for (uint16_t i = 0; i + 1 < n; i += 2) {
+    Sample a = (i == 0) ? prev : next(prev, i);
+    Sample b = next(a, i + 1);
+    prev = b;
+    int16_t avg[N_Channels];
+    for (int c = 0; c < N_Channels; c++) avg[c] = (a.value[c] + b.value[c]) / 2;
+    append(avg);
+  }
+  _interval *= 2;
+  _generation++;
+}
@@ -0,0 +1,78 @@
+/*
+ * PrintHistory
+ *    A compact record of a print job's bed temperature, tool temperature,
+ *    and percent complete over the life of the job.
+ *
+ * NOTES:
+ * o Each channel is stored as a starting value followed by one signed byte
+ *   per sample holding the change from the previous sample, so a sample
+ *   costs 3 bytes. Temperatures are in whole degrees and progress is in
+ *   half percent units.
+ * o A change too large for one byte (e.g. a heater warming up) is clamped.
+ *   Deltas are computed against the *reconstructed* value, so the stored
+ *   series catches up over the following samples rather than drifting.
+ * o When the store fills up, adjacent pairs of samples are averaged and the
+ *   sample interval doubles. Any job fits, at a resolution that gets coarser
+ *   as the job gets longer. generation() changes when this happens so a
+ *   viewer knows that previously drawn samples have moved.
+ * o The history is kept in RAM only. Completed jobs remain available until
+ *   the next job starts.
+ *
+ */
+
+#ifndef PrintHistory_h
+#define PrintHistory_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class PrintHistory {
+public:
+  static constexpr uint16_t Capacity = 150;
+  static constexpr uint32_t BaseSampleInterval = 10;  // Seconds
+
+  enum Channel { Bed, Tool, Pct, N_Channels };
+
+  struct Sample {
+    int16_t value[N_Channels];  // Bed and Tool in degrees, Pct in half percents
+    float bed() const { return value[Bed]; }
+    float tool() const { return value[Tool]; }
+    float pct() const { return value[Pct] / 2.0f; }
+  };
+
+  // Forget the current job
+  void reset();
+
+  // Offer the latest readings. They are stored only if at least one sample
+  // interval has passed since the last stored sample. Returns true if a
+  // sample was stored. `now` is in seconds from any monotonic base.
+  bool record(uint32_t now, float bed, float tool, float pct);
+
+  uint16_t size() const { return _count; }
+  uint32_t sampleInterval() const { return _interval; }
+  uint8_t  generation() const { return _generation; }
+
+  // Decode samples sequentially. Call first() and then next() up to size()-1 times.
+  Sample first() const;
+  Sample next(const Sample& previous, uint16_t i) const;
+  Sample newest() const { return _newest; }
+
+private:
+  int16_t  _base[N_Channels];
+  int8_t   _delta[Capacity][N_Channels];   // _delta[0] is unused
+  uint16_t _count = 0;
+  uint32_t _interval = BaseSampleInterval;
+  uint32_t _lastSampleTime = 0;
+  uint8_t  _generation = 0;
+  Sample   _newest;
+
+  void append(const int16_t (&target)[N_Channels]);
+  void compact();
+};
+
+#endif  // PrintHistory_h
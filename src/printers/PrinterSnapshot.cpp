@@ -0,0 +1,36 @@
+/*
+ * PrinterSnapshot
+ *    A self-contained copy of the state of one printer
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "PrinterSnapshot.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+void PrinterSnapshot::capture(PrintClient* printer, bool isActive) {
+  if (!isActive || printer == nullptr) {
+    uint32_t v = version;
+    bool r = refreshed;
+    *this = PrinterSnapshot();
+    version = v;
+    refreshed = r;
+    return;
+  }
+
+  active = true;
+  state = printer->getState();
+  pct = printer->getPctComplete();
+  timeLeft = printer->getPrintTimeLeft();
+  elapsed = printer->getElapsedTime();
+  printer->getBedTemps(bedActual, bedTarget);
+  printer->getToolTemps(toolActual, toolTarget);
+  strncpy(filename, printer->getFilename().c_str(), MaxFilenameLength);
+  filename[MaxFilenameLength] = '\0';
+  thumbnail = false;   // PrinterGroup's clients don't fetch thumbnails
+}
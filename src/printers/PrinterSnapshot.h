@@ -0,0 +1,49 @@
+/*
+ * PrinterSnapshot
+ *    A self-contained copy of the state of one printer as of the end of a
+ *    refresh.
+ *
+ * NOTES:
+ * o Snapshots are captured on whichever core refreshes the printers and
+ *   handed to the UI through a SnapshotBuffer. They are plain data (no
+ *   Strings or pointers) so copying one never touches the heap.
+ * o Each published snapshot carries a new version. Consumers can compare it
+ *   with the version they last used and skip work if nothing has arrived.
+ * o Filenames longer than MaxFilenameLength are truncated.
+ *
+ */
+
+#ifndef PrinterSnapshot_h
+#define PrinterSnapshot_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <BPA_PrintClient.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+struct PrinterSnapshot {
+  static constexpr uint8_t MaxFilenameLength = 63;
+
+  uint32_t version = 0;       // 0 until a snapshot has been published
+  bool     active = false;    // False if the printer is not in use
+  PrintClient::State state = PrintClient::State::Offline;
+  float    pct = 0;           // Percent complete
+  uint32_t timeLeft = 0;      // Seconds remaining as reported by the printer
+  uint32_t elapsed = 0;       // Seconds since the job started
+  float    bedActual = 0, bedTarget = 0;
+  float    toolActual = 0, toolTarget = 0;
+  char     filename[MaxFilenameLength+1] = "";
+  bool     thumbnail = false; // The ThumbnailCache has a preview of the job
+  bool     refreshed = false; // The printer has been refreshed since it was activated.
+                              // Until it has, the other fields say nothing about it.
+
+  // Fill in every field other than version and refreshed from printer,
+  // which may be null
+  void capture(PrintClient* printer, bool isActive);
+};
+
+#endif  // PrinterSnapshot_h
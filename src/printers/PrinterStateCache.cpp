@@ -0,0 +1,116 @@
+/*
+ * PrinterStateCache
+ *    Persist a compact copy of the last known state of each printer
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <ESP_FS.h>
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "PrinterStateCache.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace PrinterStateCache {
+  namespace Internal {
+    static constexpr const char* CachePath = "/printerState.bin";
+    static constexpr uint32_t Magic = 0x4353434D;  // "MMSC"
+    static constexpr uint8_t  Version = 1;
+
+    // State changes are written promptly, but never more often than this
+    static constexpr uint32_t MinStateWriteInterval = 30 * 1000L;
+    // Progress-only changes are written at most this often
+    static constexpr uint32_t ProgressWriteInterval = 5 * 60 * 1000L;
+
+    struct Header {
+      uint32_t magic;
+      uint8_t  version;
+      uint8_t  nPrinters;
+      uint16_t recordSize;
+    };
+
+    CachedPrinterState cache[MaxPrinters];
+    bool valid = false;
+    bool stateChanged = false;
+    bool progressChanged = false;
+    uint32_t lastWrite = 0;
+
+    void write() {
+      File f = ESP_FS::open(CachePath, "w");
+      if (!f) {
+        MM_LOG_WARNING(F("PrinterStateCache: unable to write %s"), CachePath);
+        return;
+      }
+      Header h = {Magic, Version, MaxPrinters, sizeof(CachedPrinterState)};
+      f.write((const uint8_t*)&h, sizeof(h));
+      f.write((const uint8_t*)cache, sizeof(cache));
+      f.close();
+
+      stateChanged = progressChanged = false;
+      lastWrite = millis();
+    }
+  } // ----- END: PrinterStateCache::Internal
+
+
+  bool load() {
+    using namespace Internal;
+
+    valid = false;
+    if (!ESP_FS::exists(CachePath)) return false;
+
+    File f = ESP_FS::open(CachePath, "r");
+    if (!f) return false;
+
+    Header h;
+    if (f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+        h.magic == Magic && h.version == Version &&
+        h.nPrinters == MaxPrinters && h.recordSize == sizeof(CachedPrinterState)) {
+      valid = (f.read((uint8_t*)cache, sizeof(cache)) == sizeof(cache));
+    }
+    f.close();
+
+    if (!valid) {
+      MM_LOG_WARNING(F("PrinterStateCache: ignoring invalid cache file"));
+      memset(cache, 0, sizeof(cache));
+    }
+    return valid;
+  }
+
+  bool isValid() { return Internal::valid; }
+
+  const CachedPrinterState& get(int i) { return Internal::cache[i]; }
+
+  void update(int i, const PrinterSnapshot& snapshot) {
+    using namespace Internal;
+    if (i < 0 || i >= MaxPrinters || !snapshot.active) return;
+
+    CachedPrinterState& c = cache[i];
+    uint8_t state = static_cast<uint8_t>(snapshot.state);
+    uint8_t pct = (uint8_t)snapshot.pct;
+
+    if (state != c.state) stateChanged = true;
+    else if (pct != c.pct) progressChanged = true;
+    else return;
+
+    c.state = state;
+    c.pct = pct;
+    c.timeLeft = snapshot.timeLeft;
+    strncpy(c.filename, snapshot.filename, CachedPrinterState::MaxFilenameLength);
+    c.filename[CachedPrinterState::MaxFilenameLength] = '\0';
+  }
+
+  void saveIfNeeded() {
+    using namespace Internal;
+    uint32_t sinceLastWrite = millis() - lastWrite;
+    if ((stateChanged && sinceLastWrite >= MinStateWriteInterval) ||
+        (progressChanged && sinceLastWrite >= ProgressWriteInterval)) {
+      write();
+    }
+  }
+};
+// ----- END: PrinterStateCache
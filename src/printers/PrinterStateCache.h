@@ -0,0 +1,64 @@
+/*
+ * PrinterStateCache
+ *    Persist a compact copy of the last known state of each printer so that
+ *    the HomeScreen has something meaningful to show immediately after boot,
+ *    long before the first live poll completes.
+ *
+ * NOTES:
+ * o The cache is stored in a small binary file rather than JSON. It is read
+ *   once at boot, before the network is up, so it must be cheap to load.
+ * o Writes are rate limited to avoid wearing out the flash. A change in a
+ *   printer's state (e.g. Printing -> Complete) is written promptly, but
+ *   progress updates are only written every few minutes.
+ * o Cached values are necessarily stale. Consumers should indicate this
+ *   until a live poll of the printer has completed.
+ *
+ */
+
+#ifndef PrinterStateCache_h
+#define PrinterStateCache_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <BPA_PrintClient.h>
+//                                  Local Includes
+#include "../../MMSettings.h"
+#include "PrinterSnapshot.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+struct CachedPrinterState {
+  static constexpr uint8_t MaxFilenameLength = 47;
+
+  uint8_t  state;         // A PrintClient::State value
+  uint8_t  pct;           // Percent complete (0-100)
+  uint32_t timeLeft;      // Seconds remaining at the time the state was captured
+  char     filename[MaxFilenameLength+1];
+
+  PrintClient::State getState() const { return static_cast<PrintClient::State>(state); }
+};
+
+namespace PrinterStateCache {
+  static constexpr uint8_t MaxPrinters = MMSettings::MaxPrinters;
+
+  // Read the cache from the file system. Returns true if a valid cache was found.
+  bool load();
+
+  // Returns true if load() found a valid cache
+  bool isValid();
+
+  // The cached state of printer i. Only meaningful if isValid() is true
+  const CachedPrinterState& get(int i);
+
+  // Capture the state of a printer from its latest snapshot. This only
+  // updates the cache in RAM; call saveIfNeeded() to persist it
+  void update(int i, const PrinterSnapshot& snapshot);
+
+  // Write the cache to the file system if it has changed enough since the
+  // last write to warrant it
+  void saveIfNeeded();
+};
+
+#endif  // PrinterStateCache_h
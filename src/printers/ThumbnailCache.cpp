@@ -0,0 +1,207 @@
+/*
+ * ThumbnailCache
+ *    Keep downscaled RGB565 copies of print job thumbnails in flash
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <ESP_FS.h>
+#include <gui/Theme.h>
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "ThumbnailCache.h"
+#include "../screens/PanelLayout.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace ThumbnailCache {
+  const uint16_t Size = Layout::Detail::ThumbSize;
+
+  namespace Internal {
+    static constexpr uint32_t Magic = 0x4854434D;  // "MCTH"
+
+    struct Header {
+      uint32_t magic;     // Not written until the thumbnail is complete
+      uint32_t key;
+      uint16_t width;
+      uint16_t height;
+    };
+
+    // FNV-1a. Zero is reserved for slots that hold nothing.
+    uint32_t keyFor(const char* filename) {
+      uint32_t h = 2166136261UL;
+      while (*filename) { h ^= (uint8_t)*filename++; h *= 16777619UL; }
+      return h ? h : 1;
+    }
+
+    String pathFor(uint32_t key) {
+      String path = F("/thumb");
+      path += (key % Slots);
+      path += F(".565");
+      return path;
+    }
+
+    int8_t base64Value(char c) {
+      if (c >= 'A' && c <= 'Z') return c - 'A';
+      if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+      if (c >= '0' && c <= '9') return c - '0' + 52;
+      if (c == '+') return 62;
+      if (c == '/') return 63;
+      return -1;
+    }
+  } // ----- END: ThumbnailCache::Internal
+
+
+  bool contains(const char* filename) {
+    uint16_t width, height;
+    File f = open(filename, width, height);
+    if (!f) return false;
+    f.close();
+    return true;
+  }
+
+  File open(const char* filename, uint16_t& width, uint16_t& height) {
+    using namespace Internal;
+    if (*filename == '\0') return File();
+
+    uint32_t key = keyFor(filename);
+    String path = pathFor(key);
+    if (!ESP_FS::exists(path.c_str())) return File();
+    File f = ESP_FS::open(path.c_str(), "r");
+    if (!f) return File();
+
+    Header h;
+    if (f.read((uint8_t*)&h, sizeof(h)) != sizeof(h) || h.magic != Magic || h.key != key ||
+        h.width == 0 || h.height == 0 || h.width > Size || h.height > Size ||
+        f.size() != sizeof(h) + (size_t)h.width * h.height * sizeof(uint16_t)) {
+      f.close();
+      return File();
+    }
+    width = h.width;
+    height = h.height;
+    return f;
+  }
+
+
+  /*----------------------------------------------------------------------------
+   *
+   * Writer
+   *
+   *--------------------------------------------------------------------------*/
+
+  Writer::Writer(const char* filename) : _decoder(*this), _key(Internal::keyFor(filename)) { }
+
+  Writer::~Writer() {
+    // An unfinished thumbnail is left without a valid header
+    if (_file) _file.close();
+    delete[] _sums;
+    delete[] _counts;
+  }
+
+  bool Writer::add(const uint8_t* data, size_t len) {
+    return _decoder.feed(data, len);
+  }
+
+  bool Writer::addBase64(const char* text) {
+    uint8_t buf[48];
+    uint8_t n = 0;
+    for (; *text; text++) {
+      int8_t v = Internal::base64Value(*text);
+      if (v < 0) continue;   // Padding, line breaks
+      _bits = (_bits << 6) | v;
+      _nBits += 6;
+      if (_nBits >= 8) {
+        _nBits -= 8;
+        buf[n++] = (_bits >> _nBits) & 0xFF;
+        if (n == sizeof(buf)) {
+          if (!add(buf, n)) return false;
+          n = 0;
+        }
+      }
+    }
+    return add(buf, n);
+  }
+
+  bool Writer::finish() {
+    using namespace Internal;
+    if (!_file || !_decoder.done()) return false;
+
+    Header h = {Magic, _key, _width, _height};
+    bool ok = _file.seek(0) && _file.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+    _file.close();
+    delete[] _sums; _sums = nullptr;
+    delete[] _counts; _counts = nullptr;
+    if (!ok) MM_LOG_WARNING(F("ThumbnailCache: unable to complete %s"), pathFor(_key).c_str());
+    return ok;
+  }
+
+  bool Writer::begin(uint16_t width, uint16_t height) {
+    using namespace Internal;
+
+    _srcWidth = width;
+    _srcHeight = height;
+    uint16_t longest = max(width, height);
+    if (longest <= Size) {
+      _width = width;
+      _height = height;
+    } else {
+      _width = max(1, (int)((uint32_t)width * Size / longest));
+      _height = max(1, (int)((uint32_t)height * Size / longest));
+    }
+
+    _sums = new uint32_t[_width * 4]();
+    _counts = new uint16_t[_width]();
+    String path = pathFor(_key);
+    _file = ESP_FS::open(path.c_str(), "w");
+    if (!_file) {
+      MM_LOG_WARNING(F("ThumbnailCache: unable to write %s"), path.c_str());
+      return false;
+    }
+    Header placeholder = {0, 0, 0, 0};
+    _file.write((const uint8_t*)&placeholder, sizeof(placeholder));
+    return true;
+  }
+
+  void Writer::pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    uint16_t dx = (uint32_t)_x * _width / _srcWidth;
+    uint32_t* sum = &_sums[dx * 4];
+    sum[0] += r * a;
+    sum[1] += g * a;
+    sum[2] += b * a;
+    sum[3] += a;
+    _counts[dx]++;
+
+    if (++_x < _srcWidth) return;
+    _x = 0;
+    _y++;
+    // Emit the output row once the last source row that maps to it is done
+    if (_y == _srcHeight ||
+        (uint32_t)_y * _height / _srcHeight != (uint32_t)(_y - 1) * _height / _srcHeight) {
+      writeRow();
+    }
+  }
+
+  void Writer::writeRow() {
+    // Transparent areas take on the background they will be drawn over
+    const uint16_t Bg = Theme::Color_Background;
+    const uint32_t BgR = (Bg >> 8) & 0xF8, BgG = (Bg >> 3) & 0xFC, BgB = (Bg << 3) & 0xF8;
+
+    uint16_t row[Layout::Detail::ThumbSize];
+    for (uint16_t dx = 0; dx < _width; dx++) {
+      uint32_t* sum = &_sums[dx * 4];
+      uint32_t total = _counts[dx] * 255UL;
+      uint32_t bgWeight = total - sum[3];
+      uint8_t r = total ? (sum[0] + BgR * bgWeight) / total : BgR;
+      uint8_t g = total ? (sum[1] + BgG * bgWeight) / total : BgG;
+      uint8_t b = total ? (sum[2] + BgB * bgWeight) / total : BgB;
+      row[dx] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+    _file.write((const uint8_t*)row, _width * sizeof(uint16_t));
+    memset(_sums, 0, _width * 4 * sizeof(uint32_t));
+    memset(_counts, 0, _width * sizeof(uint16_t));
+  }
+};
@@ -0,0 +1,77 @@
+/*
+ * ThumbnailCache
+ *    Keep downscaled RGB565 copies of print job thumbnails in flash so
+ *    they can be drawn without fetching or decoding them again.
+ *
+ * NOTES:
+ * o Thumbnails are keyed by file name. The cache is direct mapped: each
+ *   name hashes to one of Slots files, and a new thumbnail simply replaces
+ *   whatever was in its slot. That bounds the flash used without keeping
+ *   an index.
+ * o A Writer decodes a QOI image as it arrives and scales it down (by
+ *   averaging) to fit within Size x Size, writing each row to flash as soon
+ *   as it is complete. Only one row of accumulators is held in RAM.
+ * o A slot's header is written last, so a thumbnail that was abandoned
+ *   part way through, or is still being written, is never found.
+ * o Writers are used on the network side and readers on the UI side.
+ *
+ */
+
+#ifndef ThumbnailCache_h
+#define ThumbnailCache_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <FS.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../util/QoiDecoder.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace ThumbnailCache {
+  static constexpr uint8_t Slots = 8;
+
+  // The largest width or height of a cached thumbnail
+  extern const uint16_t Size;
+
+  bool contains(const char* filename);
+
+  // Open the thumbnail for filename. If there is one, returns the file
+  // positioned at the first of its height rows of width pixels.
+  File open(const char* filename, uint16_t& width, uint16_t& height);
+
+  class Writer : public QoiDecoder::Sink {
+  public:
+    Writer(const char* filename);
+    ~Writer();
+
+    // Add the next part of the image, either as raw QOI data or as
+    // base64 text, which may be split anywhere. Returns false on error.
+    bool add(const uint8_t* data, size_t len);
+    bool addBase64(const char* text);
+
+    // Make the thumbnail available. Returns false if it is incomplete.
+    bool finish();
+
+    bool begin(uint16_t width, uint16_t height) override;
+    void pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a) override;
+
+  private:
+    QoiDecoder _decoder;
+    uint32_t   _key;
+    File       _file;
+    uint16_t   _srcWidth = 0, _srcHeight = 0;
+    uint16_t   _width = 0, _height = 0;
+    uint16_t   _x = 0, _y = 0;      // The next source pixel
+    uint32_t*  _sums = nullptr;     // Per output column: r, g, b, alpha-weighted count
+    uint16_t*  _counts = nullptr;   // Per output column: pixels summed
+    uint32_t   _bits = 0;           // base64 bits not yet used
+    uint8_t    _nBits = 0;
+
+    void writeRow();
+  };
+};
+
+#endif  // ThumbnailCache_h
@@ -23,6 +23,11 @@
 namespace AppTheme {
   constexpr uint32_t Color_Nickname = 0xE51D;      // Light Purple
   constexpr uint32_t Color_UpdatingPrinter = TFT_DARKGREEN;
+  constexpr uint32_t Color_Stale = TFT_DARKGREY;    // Cached printer state from before boot
+  constexpr uint32_t Color_GraphBed = TFT_ORANGE;
+  constexpr uint32_t Color_GraphTool = TFT_RED;
+  constexpr uint32_t Color_GraphPct = TFT_GREEN;
+  constexpr uint32_t Color_GraphGrid = 0x2104;      // Very dark grey
   constexpr uint32_t Color_SplashOcto = TFT_GREEN;
   constexpr uint32_t Color_SplashDuet = TFT_BLUE;
   constexpr uint32_t Color_SplashRR   = 0x0488;
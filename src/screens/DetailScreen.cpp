@@ -8,7 +8,6 @@
 //--------------- Begin:  Includes ---------------------------------------------
 //                                  Core Libraries
 //                                  Third Party Libraries
-#include <ArduinoLog.h>
 #include <TimeLib.h>
 //                                  WebThing Includes
 #include <WebThing.h>
@@ -18,7 +17,14 @@
 //                                  Local Includes
 #include "DetailScreen.h"
 #include "../../MultiMonApp.h"
+#include "../../MMFeatures.h"
+#include "../../MMLog.h"
+#include "../printers/ThumbnailCache.h"
+#include "../util/PerfStats.h"
+#include "../util/TimeFormat.h"
 #include "AppTheme.h"
+#include "PanelLayout.h"
+#include "SpritePusher.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -28,43 +34,53 @@
  *
  *----------------------------------------------------------------------------*/
 
-static constexpr uint16_t TitleAreaYOrigin = 0;
-static constexpr auto TitleFont = Display.FontID::SB18;
-static constexpr auto TitleFontHeight = 42;     // TitleFont->yAdvance;
-static constexpr auto TitleAreaHeight = TitleFontHeight;
+// Panel-specific values come from PanelLayout
+using L = Layout::Detail;
+using A = Areas::Detail;
 
-static constexpr uint16_t FileNameYOrigin = TitleAreaYOrigin + TitleAreaHeight;
-static constexpr auto FileNameFont = Display.FontID::SB9;
-static constexpr auto FileNameFontHeight = 22;  // FileNameFont->yAdvance;
+static constexpr uint16_t TitleAreaYOrigin = A::TitleAreaYOrigin;
+static constexpr auto TitleFont = L::TitleFont;
+static constexpr auto TitleFontHeight = L::TitleFontHeight;
+static constexpr auto TitleAreaHeight = A::TitleAreaHeight;
+
+static constexpr uint16_t FileNameYOrigin = A::FileNameYOrigin;
+static constexpr auto FileNameFont = L::FileNameFont;
+static constexpr auto FileNameFontHeight = L::FileNameFontHeight;
 
 // The button that initiates scrolling of the file name covers both the title
 // area and the file name area. The file name area by itself is too small.
-static constexpr Region   FileNameRegion {0, 0, Display.Width, 64};
-
-static constexpr auto     ProgressFont = Display.FontID::SB18;
-static constexpr uint16_t ProgressXInset = 4;
-static constexpr uint16_t ProgressXOrigin = ProgressXInset;
-static constexpr uint16_t ProgressYOrigin = 100;
-static constexpr uint16_t ProgressHeight = 42;      // ProgressFont->yAdvance;
-static constexpr uint16_t ProgressWidth = Display.Width - (2 * ProgressXInset);
-
-
-static constexpr auto TimeFont = Display.FontID::D20;
-static constexpr uint16_t TimeYOrigin = ProgressYOrigin + ProgressHeight + 15;
-static constexpr uint16_t TimeWidth = 100;
-static constexpr uint16_t TimeHeight = 22;
-
-static constexpr auto DetailFont = Display.FontID::SB9;
-static constexpr uint16_t DetailXInset = 10;
-static constexpr uint16_t DetailYBottomMargin = 4;
-static constexpr uint16_t DetailFontHeight = 22;    // DetailFont->yAdvance;
+static constexpr Region   FileNameRegion {0, 0, Display.Width, L::FileNameAreaHeight};
+
+// A thumbnail of the job, if there is one, is centered in a square in the
+// top left corner. It is drawn from flash a few rows at a time.
+static constexpr uint16_t ThumbSize = L::ThumbSize;
+static constexpr uint16_t ThumbXMargin = A::ThumbXMargin;
+static constexpr uint8_t  ThumbStripRows = 4;
+
+static constexpr auto     ProgressFont = L::ProgressFont;
+static constexpr uint16_t ProgressXOrigin = A::ProgressXOrigin;
+static constexpr uint16_t ProgressYOrigin = L::ProgressYOrigin;
+static constexpr uint16_t ProgressHeight = L::ProgressHeight;
+static constexpr uint16_t ProgressWidth = A::ProgressWidth;
+
+
+static constexpr auto TimeFont = L::TimeFont;
+static constexpr uint16_t TimeXOrigin = A::TimeXOrigin;
+static constexpr uint16_t TimeYOrigin = A::TimeYOrigin;
+static constexpr uint16_t TimeWidth = L::TimeWidth;
+static constexpr uint16_t TimeHeight = L::TimeHeight;
+
+static constexpr auto DetailFont = L::DetailFont;
+static constexpr uint16_t DetailXInset = A::DetailXInset;
+static constexpr uint16_t DetailFontHeight = L::DetailFontHeight;
 static constexpr uint16_t DetailWidth = Display.Width;
-static constexpr uint16_t DetailHeight = 2 * DetailFontHeight;
+static constexpr uint16_t DetailHeight = A::DetailHeight;
 static constexpr uint16_t DetailXOrigin = 0;
-static constexpr uint16_t DetailYOrigin = Display.Height - DetailHeight - DetailYBottomMargin;
+static constexpr uint16_t DetailYOrigin = A::DetailYOrigin;
 
 static constexpr uint8_t FileNameLabel = 0;
-static constexpr uint8_t FullScreenButtonID = FileNameLabel + 1;
+static constexpr uint8_t GraphButtonID = FileNameLabel + 1;
+static constexpr uint8_t FullScreenButtonID = GraphButtonID + 1;
 static constexpr uint8_t N_Labels = FullScreenButtonID + 1;
 
 /*------------------------------------------------------------------------------
@@ -75,38 +91,54 @@ static constexpr uint8_t N_Labels = FullScreenButtonID + 1;
 
 DetailScreen::DetailScreen() {
   buttonHandler = [this](uint8_t id, PressType type) -> void {
-    Log.verbose(F("In DetailScreen ButtonHandler, id = %d"), id);
+    PerfStats::Scope timer(PerfStats::Case::TapResponse);
+    MM_LOG_VERBOSE(F("In DetailScreen ButtonHandler, id = %d"), id);
     if (id == FileNameLabel) {  // The file name was tapped
       revealFullFileName();
       return;
     }
+    if (id == GraphButtonID && type == PressType::Normal) {
+      mmApp->graphScreen->setIndex(index);
+      ScreenMgr.display(mmApp->graphScreen);
+      return;
+    }
 
-    PrintClient *p = mmApp->printerGroup->getPrinter(index);
-    if (type > PressType::Normal && p->getState() == PrintClient::State::Complete) {
-      p->acknowledgeCompletion();
+    if (type > PressType::Normal &&
+        mmApp->printerSnapshot(index).state == PrintClient::State::Complete) {
+      mmApp->acknowledgeCompletion(index);
     }
     ScreenMgr.displayHomeScreen();
   };
 
   labels = new Label[(nLabels = N_Labels)];
   labels[0].init(FileNameRegion, FileNameLabel);
-  labels[1].init(0, 0, Display.Width, Display.Height, FullScreenButtonID);
+  // The progress bar leads to the GraphScreen. It has priority over the
+  // full screen button because it is earlier in the list.
+  labels[1].init(ProgressXOrigin, ProgressYOrigin, ProgressWidth, ProgressHeight, GraphButtonID);
+  labels[2].init(0, 0, Display.Width, Display.Height, FullScreenButtonID);
 }
 
 void DetailScreen::setIndex(int i) { index = i; }
 
 void DetailScreen::display(bool activating) {
-  PrintClient *printer = mmApp->printerGroup->getPrinter(index);
+  PerfStats::Scope timer(PerfStats::Case::DetailRender);
+  SpritePusher::Batch batch;
+  const PrinterSnapshot& printer = mmApp->printerSnapshot(index);
 
   if (activating) {
     scrollIndex = -1; // We're doing an inital display, so we aren't scrolling
     Display.tft.fillScreen(Theme::Color_Background);
     drawStaticContent(printer, activating);
+  } else if (printer.thumbnail != thumbnailWanted) {
+    // The thumbnail has arrived, or a new job has started
+    scrollIndex = -1;
+    Display.tft.fillRect(0, 0, Display.Width, L::FileNameAreaHeight, Theme::Color_Background);
+    drawStaticContent(printer, true);
   }
 
   drawProgressBar(ProgressXOrigin, ProgressYOrigin, ProgressWidth, ProgressHeight,
-    printer->getPctComplete(),
-    WebThing::formattedInterval(printer->getPrintTimeLeft()),
+    printer.pct,
+    WebThing::formattedInterval(mmApp->printTimeLeft(index)),
     activating);
   drawDetailInfo(printer, activating);
   drawTime(activating);
@@ -129,37 +161,61 @@ void DetailScreen::processPeriodicActivity() {
  *
  *----------------------------------------------------------------------------*/
 
-inline void DetailScreen::appendDate(time_t theTime, String &target) {
-  target += String(dayShortStr(weekday(theTime)));
-  target += " ";
-  target += (wtApp->settings->uiOptions.use24Hour) ? hour(theTime) : hourFormat12(theTime);
-  target += ":";
-  int theMinute =  minute(theTime);
-  if (theMinute < 10) target += '0';
-  target += theMinute;
-  if (!wtApp->settings->uiOptions.use24Hour) target += isAM(theTime) ? "AM" : "PM";
-}
-
-void DetailScreen::drawStaticContent(PrintClient *printer, bool) {
+void DetailScreen::drawStaticContent(const PrinterSnapshot& printer, bool) {
   auto& tft = Display.tft;
 
+  // ----- Display the thumbnail, if any, and make room for it
+  thumbnailWanted = printer.thumbnail;
+#if MM_FEATURE_RRF3
+  bool hasThumbnail = printer.thumbnail && drawThumbnail(printer.filename);
+#else
+  bool hasThumbnail = false;  // Only RRF3 printers provide thumbnails
+#endif
+  nameX = hasThumbnail ? ThumbSize + ThumbXMargin : 0;
+  nameAreaWidth = Display.Width - nameX;
+  uint16_t nameCenter = nameX + nameAreaWidth/2;
+
   // ----- Display the nickname
   tft.setTextDatum(TC_DATUM);
   Display.setFont(TitleFont);
   tft.setTextColor(AppTheme::Color_Nickname);
-  tft.drawString(mmSettings->printer[index].nickname, Display.XCenter, 5);
+  tft.drawString(mmSettings->printer[index].nickname, nameCenter, 5);
 
-  String name = printer->getFilename();
+  String name = printer.filename;
   Display.setFont(DetailFont); // Set font BEFORE measuring width
   nameWidth = tft.textWidth(name);        // Remember width in case we need to scroll
   tft.setTextColor(Theme::Color_DimText);
-  if (nameWidth < Display.Width)  {
+  if (nameWidth < nameAreaWidth)  {
     tft.setTextDatum(TC_DATUM);
-    tft.drawString(name, Display.XCenter, FileNameYOrigin);
+    tft.drawString(name, nameCenter, FileNameYOrigin);
   } else {
     tft.setTextDatum(TL_DATUM);
-    tft.drawString(name, 0, FileNameYOrigin);
+    tft.drawString(name, nameX, FileNameYOrigin);
+  }
+}
+
+bool DetailScreen::drawThumbnail(const char* filename) {
+  uint16_t w, h;
+  File f = ThumbnailCache::open(filename, w, h);
+  if (!f) return false;
+
+  auto& tft = Display.tft;
+  uint16_t x = (ThumbSize - w)/2;
+  uint16_t y = (ThumbSize - h)/2;
+  uint16_t strip[ThumbSize * ThumbStripRows];
+  // The cache holds native 16-bit values
+  bool swapBytes = tft.getSwapBytes();
+  tft.setSwapBytes(true);
+  SpritePusher::flush();
+  for (uint16_t row = 0; row < h; row += ThumbStripRows) {
+    uint16_t rows = min((uint16_t)ThumbStripRows, (uint16_t)(h - row));
+    size_t bytes = rows * w * sizeof(uint16_t);
+    if (f.read((uint8_t*)strip, bytes) != bytes) break;
+    tft.pushImage(x, y + row, w, rows, strip);
   }
+  tft.setSwapBytes(swapBytes);
+  f.close();
+  return true;
 }
 
 void DetailScreen::drawTime(bool force) {
@@ -197,7 +253,7 @@ void DetailScreen::drawTime(bool force) {
   sprite->drawString(timeString, TimeWidth/2, 0);
 
   sprite->setBitmapColor(AppTheme::Color_Nickname, Theme::Color_Background);
-  sprite->pushSprite((Display.Width-TimeWidth)/2, TimeYOrigin);
+  SpritePusher::push(sprite, TimeXOrigin, TimeYOrigin);
   sprite->deleteSprite();
 }
 
@@ -240,12 +296,17 @@ void DetailScreen::drawProgressBar(
   sprite->drawString(String((int)(pct)) + "%", PctXInset, (h/2));
   sprite->setTextDatum(MR_DATUM);
   sprite->drawString(txt, w-TxtXInset, (h/2));
-  sprite->pushSprite(x, y);
+  SpritePusher::push(sprite, x, y);
 
   sprite->deleteSprite();
 }
 
-void DetailScreen::drawDetailInfo(PrintClient *printer, bool) {
+void DetailScreen::drawDetailInfo(const PrinterSnapshot& printer, bool force) {
+  // Everything shown here comes from the snapshot, so it only changes when
+  // a new one arrives
+  if (!force && printer.version == detailVersion) return;
+  detailVersion = printer.version;
+
   auto& sprite = Display.sprite;
 
   sprite->setColorDepth(1);
@@ -256,50 +317,47 @@ void DetailScreen::drawDetailInfo(PrintClient *printer, bool) {
   sprite->setTextDatum(TL_DATUM);
 
   // ----- Display the temps
-  float target, actual;
-  printer->getBedTemps(actual, target);
-  String temp = "Bed: " + String(actual, 1) + " / " + String(target, 1);
+  String temp = "Bed: " + String(printer.bedActual, 1) + " / " + String(printer.bedTarget, 1);
   sprite->drawString(temp, DetailXInset, 0);
 
-  printer->getToolTemps(actual, target);
-  temp = "E0: " + String(actual, 1) + " / " + String(target, 1);
+  temp = "E0: " + String(printer.toolActual, 1) + " / " + String(printer.toolTarget, 1);
   sprite->drawString(temp, Display.XCenter+DetailXInset, 0);
 
   // ----- Display the elapsed Time
   Display.setSpriteFont(DetailFont);
   sprite->setTextDatum(TL_DATUM);
   sprite->setTextColor(Theme::Color_NormalText);
-  String elapsed = "Done: " + WebThing::formattedInterval(printer->getElapsedTime());
+  String elapsed = "Done: " + WebThing::formattedInterval(printer.elapsed);
   sprite->drawString(elapsed, DetailXInset, DetailFontHeight);
 
   // ----- Display expected completion time
   String est = "Complete";
-  if (printer->getState() == PrintClient::State::Printing) {
+  if (printer.state == PrintClient::State::Printing) {
     est = "Est: ";
-    appendDate(now() + printer->getPrintTimeLeft(), est);
+    TimeFormat::appendDayAndTime(now() + mmApp->printTimeLeft(index), est);
   }
   sprite->drawString(est, Display.XCenter+DetailXInset, DetailFontHeight);
 
   sprite->setBitmapColor(Theme::Color_NormalText, Theme::Color_Background);
-  sprite->pushSprite(DetailXOrigin, DetailYOrigin);
+  SpritePusher::push(sprite, DetailXOrigin, DetailYOrigin);
   sprite->deleteSprite();
 }
 
 void DetailScreen::scrollFileName() {
   auto& sprite = Display.sprite;
   sprite->setColorDepth(1);
-  sprite->createSprite(Display.Width, DetailHeight);
+  sprite->createSprite(nameAreaWidth, DetailHeight);
   sprite->fillSprite(Theme::Mono_Background);
   Display.setSpriteFont(DetailFont);
   sprite->setTextColor(Theme::Mono_Foreground);
   sprite->setTextDatum(TL_DATUM);
 
   uint32_t extraDelay = 0;
-  String name = mmApp->printerGroup->getPrinter(index)->getFilename();
-  if (scrollIndex == nameWidth - Display.Width) { delta = -delta; extraDelay = 500; }
+  String name = mmApp->printerSnapshot(index).filename;
+  if (scrollIndex == nameWidth - nameAreaWidth) { delta = -delta; extraDelay = 500; }
   sprite->drawString(name, -scrollIndex, 0);
   sprite->setBitmapColor(Theme::Color_DimText, Theme::Color_Background);
-  sprite->pushSprite(0, FileNameYOrigin);
+  SpritePusher::push(sprite, nameX, FileNameYOrigin);
   sprite->deleteSprite();
 
   nextScrollTime = millis() + 10 + extraDelay;
@@ -307,7 +365,7 @@ void DetailScreen::scrollFileName() {
 }
 
 void DetailScreen::revealFullFileName() {
-  if (nameWidth <= Display.Width) return; // It's already revealed
+  if (nameWidth <= nameAreaWidth) return; // It's already revealed
   if (scrollIndex != -1) {  // We're already scrolling, finish
     scrollIndex = 0;
     delta = -1;
@@ -5,11 +5,12 @@
 //                                  Core Libraries
 #include <Arduino.h>
 //                                  Third Party Libraries
-#include <BPA_PrintClient.h>
 //                                  WebThing Includes
 #include <WTApp.h>
 #include <gui/Screen.h>
+#include <gui/Display.h>
 //                                  Local Includes
+#include "../printers/PrinterSnapshot.h"
 //--------------- End:    Includes ---------------------------------------------
 
 class DetailScreen : public Screen {
@@ -24,17 +25,21 @@ private:
   uint32_t nextUpdateTime = UINT32_MAX;
   int scrollIndex = -1;
   int nameWidth;
+  int nameX = 0;                // The title and file name are beside the thumbnail
+  int nameAreaWidth = Display.Width;
+  bool thumbnailWanted = false; // printer.thumbnail when the static content was drawn
   int delta;
   int bound;
   uint32_t nextScrollTime = 0;
+  uint32_t detailVersion = 0;   // The snapshot version shown in the detail area
 
   void drawProgressBar(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float pct, String txt, bool force = false);
-  void drawStaticContent(PrintClient *printer, bool force = false);
-  void drawDetailInfo(PrintClient *printer, bool force = false);
+  void drawStaticContent(const PrinterSnapshot& printer, bool force = false);
+  bool drawThumbnail(const char* filename);
+  void drawDetailInfo(const PrinterSnapshot& printer, bool force = false);
   void drawTime(bool force = false);
   void scrollFileName();
   void revealFullFileName();
-  void appendDate(time_t theTime, String &target);
 };
 
 #endif  // DetailScreen_h
\ No newline at end of file
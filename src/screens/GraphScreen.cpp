@@ -0,0 +1,200 @@
+/*
+ * GraphScreen:
+ *    Plot the bed temperature, tool temperature, and progress of a
+ *    printer's current (or most recent) job.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <WebThing.h>
+#include <gui/Display.h>
+#include <gui/Theme.h>
+#include <gui/ScreenMgr.h>
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "GraphScreen.h"
+#include "../../MultiMonApp.h"
+#include "AppTheme.h"
+#include "../util/PerfStats.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * CONSTANTS
+ *
+ *----------------------------------------------------------------------------*/
+
+static constexpr auto     TitleFont = Display.FontID::SB9;
+static constexpr uint16_t TitleHeight = 22;     // TitleFont->yAdvance;
+
+static constexpr auto     FooterFont = Display.FontID::SB9;
+static constexpr uint16_t FooterHeight = 22;    // FooterFont->yAdvance;
+static constexpr uint16_t FooterYOrigin = Display.Height - FooterHeight;
+
+static constexpr uint16_t ColumnWidth = 2;
+static constexpr uint16_t PlotWidth = PrintHistory::Capacity * ColumnWidth;
+static constexpr uint16_t PlotXOrigin = (Display.Width - PlotWidth) / 2;
+static constexpr uint16_t PlotYOrigin = TitleHeight + 4;
+static constexpr uint16_t PlotHeight = FooterYOrigin - PlotYOrigin - 4;
+
+// Both temperatures share one scale. Progress uses the full plot height.
+static constexpr int16_t  TempScaleMax = 300;
+static constexpr int16_t  GridLineSpacing = 50;   // Degrees
+
+static constexpr uint32_t CheckInterval = 1000L;
+
+static constexpr uint8_t FullScreenButtonID = 0;
+static constexpr uint8_t N_Labels = FullScreenButtonID + 1;
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Utility Functions
+ *
+ *----------------------------------------------------------------------------*/
+
+static inline int16_t yFor(int16_t value, int16_t scaleMax) {
+  value = constrain(value, 0, scaleMax);
+  return PlotYOrigin + PlotHeight - 1 - ((int32_t)value * (PlotHeight - 1)) / scaleMax;
+}
+
+static inline int16_t yFor(const PrintHistory::Sample& s, int channel) {
+  if (channel == PrintHistory::Pct) return yFor(s.value[channel], 200);
+  return yFor(s.value[channel], TempScaleMax);
+}
+
+static const uint16_t ChannelColors[PrintHistory::N_Channels] = {
+  AppTheme::Color_GraphBed, AppTheme::Color_GraphTool, AppTheme::Color_GraphPct
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constructors and Public methods
+ *
+ *----------------------------------------------------------------------------*/
+
+GraphScreen::GraphScreen() {
+  buttonHandler = [this](uint8_t id, PressType type) -> void {
+    PerfStats::Scope timer(PerfStats::Case::TapResponse);
+    MM_LOG_VERBOSE(F("In GraphScreen ButtonHandler, id = %d"), id);
+    ScreenMgr.display(mmApp->detailScreen);
+  };
+
+  labels = new Label[(nLabels = N_Labels)];
+  labels[0].init(0, 0, Display.Width, Display.Height, FullScreenButtonID);
+}
+
+void GraphScreen::setIndex(int i) { index = i; }
+
+void GraphScreen::display(bool activating) {
+  const PrintHistory& history = mmApp->printHistory(index);
+  auto& tft = Display.tft;
+
+  if (activating) {
+    tft.fillScreen(Theme::Color_Background);
+
+    tft.setTextDatum(TL_DATUM);
+    Display.setFont(TitleFont);
+    tft.setTextColor(AppTheme::Color_Nickname);
+    tft.drawString(mmSettings->printer[index].nickname, PlotXOrigin, 0);
+
+    // Legend
+    static const char* const Names[PrintHistory::N_Channels] = {"Bed", "Tool", "%"};
+    int16_t x = PlotXOrigin + PlotWidth;
+    tft.setTextDatum(TR_DATUM);
+    for (int c = PrintHistory::N_Channels - 1; c >= 0; c--) {
+      tft.setTextColor(ChannelColors[c]);
+      tft.drawString(Names[c], x, 0);
+      x -= tft.textWidth(Names[c]) + 8;
+    }
+  }
+
+  if (activating || history.generation() != drawnGeneration || history.size() < drawnCount) {
+    drawPlotFrame();
+    drawnCount = 0;
+    drawnGeneration = history.generation();
+  }
+
+  // Draw only the columns that aren't already on the screen
+  uint16_t n = history.size();
+  if (drawnCount == 0 && n > 0) {
+    lastDrawn = history.first();
+    drawColumn(0, lastDrawn, lastDrawn);
+    drawnCount = 1;
+  }
+  for (uint16_t i = drawnCount; i < n; i++) {
+    PrintHistory::Sample s = history.next(lastDrawn, i);
+    drawColumn(i, lastDrawn, s);
+    lastDrawn = s;
+  }
+  if (n > drawnCount || activating) drawFooter(history);
+  drawnCount = n;
+
+  nextCheckTime = millis() + CheckInterval;
+}
+
+void GraphScreen::processPeriodicActivity() {
+  if (millis() < nextCheckTime) return;
+  const PrintHistory& history = mmApp->printHistory(index);
+  if (history.size() != drawnCount || history.generation() != drawnGeneration) display(false);
+  else nextCheckTime = millis() + CheckInterval;
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private methods
+ *
+ *----------------------------------------------------------------------------*/
+
+void GraphScreen::drawPlotFrame() {
+  auto& tft = Display.tft;
+
+  tft.fillRect(PlotXOrigin, PlotYOrigin, PlotWidth, PlotHeight, Theme::Color_Background);
+  for (int16_t t = GridLineSpacing; t < TempScaleMax; t += GridLineSpacing) {
+    tft.drawFastHLine(PlotXOrigin, yFor(t, TempScaleMax), PlotWidth, AppTheme::Color_GraphGrid);
+  }
+  tft.drawRect(PlotXOrigin-1, PlotYOrigin-1, PlotWidth+2, PlotHeight+2, Theme::Color_Border);
+}
+
+void GraphScreen::drawColumn(
+    uint16_t i, const PrintHistory::Sample& prev, const PrintHistory::Sample& cur)
+{
+  auto& tft = Display.tft;
+  int16_t x = PlotXOrigin + i * ColumnWidth;
+  int16_t prevX = (i == 0) ? x : x - ColumnWidth;
+
+  for (int c = 0; c < PrintHistory::N_Channels; c++) {
+    tft.drawLine(prevX, yFor(prev, c), x, yFor(cur, c), ChannelColors[c]);
+  }
+}
+
+void GraphScreen::drawFooter(const PrintHistory& history) {
+  auto& sprite = Display.sprite;
+
+  String text;
+  if (history.size() == 0) {
+    text = "No history for this job yet";
+  } else {
+    text = WebThing::formattedInterval(history.size() * history.sampleInterval());
+    text += " shown, ";
+    text += history.sampleInterval();
+    text += "s per sample";
+  }
+
+  sprite->setColorDepth(1);
+  sprite->createSprite(Display.Width, FooterHeight);
+  sprite->fillSprite(Theme::Mono_Background);
+  Display.setSpriteFont(FooterFont);
+  sprite->setTextColor(Theme::Mono_Foreground);
+  sprite->setTextDatum(TC_DATUM);
+  sprite->drawString(text, Display.XCenter, 0);
+  sprite->setBitmapColor(Theme::Color_DimText, Theme::Color_Background);
+  sprite->pushSprite(0, FooterYOrigin);
+  sprite->deleteSprite();
+}
@@ -0,0 +1,44 @@
+/*
+ * GraphScreen:
+ *    Plot the bed temperature, tool temperature, and progress of a
+ *    printer's current (or most recent) job. Reached by tapping the
+ *    progress bar on the DetailScreen.
+ *
+ */
+
+#ifndef GraphScreen_h
+#define GraphScreen_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <gui/Screen.h>
+//                                  Local Includes
+#include "../printers/PrintHistory.h"
+//--------------- End:    Includes ---------------------------------------------
+
+class GraphScreen : public Screen {
+public:
+  GraphScreen();
+  void setIndex(int i);
+  void display(bool activating = false);
+  void processPeriodicActivity();
+
+private:
+  int index = 0;
+  uint32_t nextCheckTime = 0;
+
+  // What is already on the screen. New samples are drawn as additional
+  // columns. The whole plot is redrawn only if the history was compacted.
+  uint16_t drawnCount = 0;
+  uint8_t  drawnGeneration = 0;
+  PrintHistory::Sample lastDrawn;
+
+  void drawPlotFrame();
+  void drawColumn(uint16_t i, const PrintHistory::Sample& prev, const PrintHistory::Sample& cur);
+  void drawFooter(const PrintHistory& history);
+};
+
+#endif  // GraphScreen_h
@@ -17,7 +17,13 @@
 #include <gui/ScreenMgr.h>
 //                                  Local Includes
 #include "../../MultiMonApp.h"
+#include "../../MMLog.h"
+#include "../printers/PrinterStateCache.h"
+#include "../util/PerfStats.h"
+#include "AppTheme.h"
 #include "HomeScreen.h"
+#include "PanelLayout.h"
+#include "SpritePusher.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -42,6 +48,9 @@
       | ------------------------------------------ |
       | ------------------------------------------ |
       +--------------------------------------------+
+
+  The number and width of the progress bars depends on how many printers
+  are active.
 */
 
 /*------------------------------------------------------------------------------
@@ -50,44 +59,60 @@
  *
  *----------------------------------------------------------------------------*/
 
-static constexpr auto WeatherFont = Display.FontID::SB9;
-static constexpr uint16_t WeatherFontHeight = 22;   // WeatherFont->yAdvance;
+// Panel-specific values come from PanelLayout
+using L = Layout::Home;
+using A = Areas::Home;
+
+static constexpr auto WeatherFont = L::WeatherFont;
 static constexpr uint16_t WeatherXOrigin = 0;
-static constexpr uint16_t WeatherYOrigin = 0;
-static constexpr uint16_t WeatherHeight = WeatherFontHeight;
+static constexpr uint16_t WeatherYOrigin = A::WeatherYOrigin;
+static constexpr uint16_t WeatherHeight = A::WeatherHeight;
 static constexpr uint16_t WeatherWidth = Display.Width;
 
 static int16_t PrinterNameFont = 2; // A small 5x7 font
+static constexpr uint16_t PrinterNameHeight = A::PrinterNameHeight;
 
 // NC is short for Next Completion
-static constexpr auto NCFont = Display.FontID::SB9;
-static constexpr uint16_t NCFontHeight = 22;      // NCFont->yAdvance;
+static constexpr auto NCFont = L::NCFont;
 static constexpr uint16_t NCXOrigin = 0;
-static constexpr uint16_t NCYOrigin = WeatherYOrigin + WeatherHeight + 2;
-static constexpr uint16_t NCHeight = NCFontHeight;
+static constexpr uint16_t NCYOrigin = A::NCYOrigin;
+static constexpr uint16_t NCHeight = A::NCHeight;
 static constexpr uint16_t NCWidth = Display.Width;
 
-// NOTE: The rightmost frame of ProgressBar[i] overlaps the leftmost frame
-//       of ProgressBar[i+1]
-static constexpr uint16_t PB_FrameSize = 2;                             // Size of the Frame
-static constexpr uint16_t PB_Width = 81;                                // Includes Frame
-static constexpr uint16_t PB_Height = 42;                               // Includes Frame
-static constexpr uint16_t PB_BarWidth = PB_Width - (PB_FrameSize*2);    // Just the bar, no frame
-static constexpr uint16_t PB_BarHeight = PB_Height - (PB_FrameSize*2);  // Just the bar, no frame
-static constexpr uint16_t PB_XOrigin = 1;                               // X of origin of 1st progress bar
-static constexpr uint16_t PB_YOrigin = Display.Height - PB_Height;      // Y Origin of all progress bars
-static constexpr uint16_t PBLabelsYOrigin = PB_YOrigin-10;              // Space for teeny label + pad
-static constexpr auto     PB_Font = Display.FontID::SB9;                // Font for the Progress Bar
+// NOTE: The rightmost frame of each progress bar overlaps the leftmost frame
+//       of the next one. The width of the bars depends on how many are
+//       shown. See HomeScreen::layoutPrinters()
+static constexpr uint16_t PB_FrameSize = A::PB_FrameSize;               // Size of the Frame
+static constexpr uint16_t PB_Height = L::PB_Height;                     // Includes Frame
+static constexpr uint16_t PB_XOrigin = A::PB_XOrigin;                   // X of origin of 1st progress bar
+static constexpr uint16_t PB_YOrigin = A::PB_YOrigin;                   // Y Origin of all progress bars
+static constexpr auto     PB_Font = L::PB_Font;                         // Font for the Progress Bar
+
+// Each printer's slot holds its name above its progress bar. A slot is
+// drawn in a sprite of its own, so the largest is no bigger than one bar.
+static constexpr uint16_t SlotYOrigin = A::SlotYOrigin;
+static constexpr uint16_t SlotHeight = A::SlotHeight;
+
+// Palette indices for the printer slots
+static constexpr uint8_t PI_Background = 0;
+static constexpr uint8_t PI_Border = 1;
+static constexpr uint8_t PI_Text = 2;
+static constexpr uint8_t PI_Inactive = 3;
+static constexpr uint8_t PI_Offline = 4;
+static constexpr uint8_t PI_Online = 5;
+static constexpr uint8_t PI_Progress = 6;
+static constexpr uint8_t PI_Stale = 7;
 
 static constexpr uint16_t ClockXOrigin = 0;                             // Starts at left edge of screen
-static constexpr uint16_t ClockYOrigin = NCYOrigin + NCHeight;          // Starts below the NextCompletion area
+static constexpr uint16_t ClockYOrigin = A::ClockYOrigin;               // Starts below the NextCompletion area
 static constexpr uint16_t ClockWidth = Display.Width;                   // Full width of the screen
-static constexpr uint16_t ClockHeight = PBLabelsYOrigin-ClockYOrigin;   // The space between the other 2 areas
-static constexpr auto     ClockFont = Display.FontID::D100;
-static constexpr uint16_t ClockFontHeight = 109;    // ClockFont->yAdvance;
+static constexpr uint16_t ClockHeight = A::ClockHeight;                 // The space between the other 2 areas
+static constexpr auto     ClockFont = L::ClockFont;
+static constexpr uint16_t ClockFontHeight = L::ClockFontHeight;
 
+// Bars are labels [0, N_ProgressBars). Those beyond the printers shown are disabled
 static constexpr uint8_t FirstProgressBar = 0;
-static constexpr uint8_t N_ProgressBars   = 4;
+static constexpr uint8_t N_ProgressBars   = 4;  // One per printer
 static constexpr uint8_t WeatherAreaLabel = FirstProgressBar + N_ProgressBars;
 static constexpr uint8_t ClockAreaLabel   = WeatherAreaLabel + 1;
 static constexpr uint8_t N_Labels         = ClockAreaLabel + 1;
@@ -102,15 +127,16 @@ static constexpr uint8_t N_Labels         = ClockAreaLabel + 1;
 HomeScreen::HomeScreen() {
 
   buttonHandler = [this](uint8_t id, PressType type) -> void {
-    Log.verbose(F("In HomeScreen Button Handler, id = %d"), id);
-    if (id < mmApp->MaxPrinters) {
-      PrintClient* p = mmApp->printerGroup->getPrinter(id);
-      if (mmSettings->printer[id].isActive &&
-          p->getState() > PrintClient::State::Operational)
-      {
-        mmApp->detailScreen->setIndex(id);
-        ScreenMgr.display(mmApp->detailScreen);
-        return;
+    PerfStats::Scope timer(PerfStats::Case::TapResponse);
+    MM_LOG_VERBOSE(F("In HomeScreen Button Handler, id = %d"), id);
+    if (id < N_ProgressBars && id < nShown) {
+      uint8_t printerIndex = order[id];
+      if (mmApp->isPrinterLive(printerIndex)) {
+        if (mmApp->printerSnapshot(printerIndex).state > PrintClient::State::Operational) {
+          mmApp->detailScreen->setIndex(printerIndex);
+          ScreenMgr.display(mmApp->detailScreen);
+          return;
+        }
       }
     }
     if (type > PressType::Normal) {
@@ -129,13 +155,11 @@ HomeScreen::HomeScreen() {
     }
   };
 
+  static_assert(MaxPrinters <= N_ProgressBars, "Too few progress bar labels");
   labels = new Label[(nLabels = N_Labels)];
 
-  Region r {PB_XOrigin, PB_YOrigin, PB_Width, PB_Height};
-  for (int i = 0; i < mmApp->MaxPrinters; i++) {
-    labels[i].init(r, i);
-    r.x += PB_Width - PB_FrameSize;
-  }
+  // The progress bars are positioned by layoutPrinters()
+  for (int i = 0; i < N_ProgressBars; i++) labels[i].init(0, 0, 0, 0, i);
 
   // Because the weather area is slim and at the top of the screen, we make a bigger button
   // right in the middle to make it easier to touch. It overlaps the Clock button area
@@ -145,11 +169,12 @@ HomeScreen::HomeScreen() {
 }
 
 void HomeScreen::display(bool activating) {
+  PerfStats::Scope timer(PerfStats::Case::HomeRender);
+  SpritePusher::Batch batch;
   if (activating) { Display.tft.fillScreen(Theme::Color_Background); }
 
   drawClock(activating);
-  drawPrinterNames(activating);
-  drawStatus(activating);
+  drawPrinters(activating);
   drawWeather(activating);
   drawSecondLine(activating);
   nextUpdateTime = millis() + 10 * 1000L;
@@ -172,6 +197,10 @@ void HomeScreen::drawClock(bool force) {
   int     min = minute(t);
   auto&   sprite = Display.sprite;
 
+  // When we start from the PrinterStateCache, the HomeScreen may be shown
+  // before the time has been set. Don't display a bogus time.
+  if (timeStatus() == timeNotSet) return;
+
   int compositeTime = hr * 100 + min;
   if (!force && (compositeTime == lastTimeDisplayed)) return;
   else lastTimeDisplayed = compositeTime;
@@ -196,31 +225,22 @@ void HomeScreen::drawClock(bool force) {
 
   Display.setSpriteFont(ClockFont);
   sprite->setTextColor(Theme::Mono_Foreground);
-  // With this large font some manual "kerning" is required to make it fit
+  // With this large font some manual "kerning" is required to make it fit.
+  // The positions are specific to the panel; see PanelLayout
   uint16_t baseline = ClockFontHeight-1;
-  sprite->setCursor(   0, baseline); sprite->print(timeString[0]);
-  sprite->setCursor(  70, baseline); sprite->print(timeString[1]);
-  sprite->setCursor( 145, baseline); sprite->print(timeString[2]);
-  sprite->setCursor( 160, baseline); sprite->print(timeString[3]);
-  sprite->setCursor( 230, baseline); sprite->print(timeString[4]);
+  sprite->setCursor(L::clockX(0), baseline); sprite->print(timeString[0]);
+  sprite->setCursor(L::clockX(1), baseline); sprite->print(timeString[1]);
+  sprite->setCursor(L::clockX(2), baseline); sprite->print(timeString[2]);
+  sprite->setCursor(L::clockX(3), baseline); sprite->print(timeString[3]);
+  sprite->setCursor(L::clockX(4), baseline); sprite->print(timeString[4]);
 
   sprite->setBitmapColor(Theme::Color_AlertGood, Theme::Color_Background);
-  uint16_t yPlacement = ClockYOrigin+((ClockHeight-ClockFontHeight)/2);
-  yPlacement -= 10; // Having it perfectly centered doesn't look as good,
-                    // especially when no "next completion time" is displayed
-  sprite->pushSprite(ClockXOrigin, yPlacement);
+  // Not quite centered, which looks better, especially when no "next
+  // completion time" is displayed
+  SpritePusher::push(sprite, ClockXOrigin, A::ClockSpriteYOrigin);
   sprite->deleteSprite();
 }
 
-void HomeScreen::drawProgressBar(
-    int i, uint16_t barColor, uint16_t txtColor,
-    float pct, String txt, bool showPct) {
-  labels[i].drawProgress(
-        pct, txt, PB_Font, PB_FrameSize,
-        txtColor, Theme::Color_Border, barColor, Theme::Color_Background,
-        showPct, true);
-}
-
 void HomeScreen::drawWeather(bool) {
   String readout("No weather data available");
   auto& sprite = Display.sprite;
@@ -253,7 +273,7 @@ void HomeScreen::drawWeather(bool) {
   sprite->drawString(readout, WeatherWidth/2, WeatherHeight/2);
 
   sprite->setBitmapColor(textColor, Theme::Color_Background);
-  sprite->pushSprite(WeatherXOrigin, WeatherYOrigin);
+  SpritePusher::push(sprite, WeatherXOrigin, WeatherYOrigin);
   sprite->deleteSprite();
 }
 
@@ -271,7 +291,7 @@ void HomeScreen::drawSecondLine(bool) {
 
   String printerName, formattedTime;
   uint32_t delta;
-  mmApp->printerGroup->nextCompletion(printerName, formattedTime, delta);
+  mmApp->nextCompletion(printerName, formattedTime, delta);
   String text;
   if (printerName.isEmpty()) {
     // Nothing to display, so show the forecast if available
@@ -300,50 +320,153 @@ void HomeScreen::drawSecondLine(bool) {
 
   sprite->drawString(text, NCWidth/2, 0);
   sprite->setBitmapColor(textColor, Theme::Color_Background);
-  sprite->pushSprite(NCXOrigin, NCYOrigin);
+  SpritePusher::push(sprite, NCXOrigin, NCYOrigin);
   sprite->deleteSprite();
 
 }
 
-void HomeScreen::drawPrinterNames(bool) {
-  auto& tft = Display.tft;
-  uint16_t yPos = PB_YOrigin;
-  uint16_t xDelta = Display.Width/mmApp->MaxPrinters;
-  uint16_t xPos = 0 + xDelta/2;
-
-  tft.setTextDatum(BC_DATUM);
-  tft.setTextColor(Theme::Color_NormalText);
-  for (int i = 0; i < mmApp->MaxPrinters; i++) {
-    String name;
-    if (!mmSettings->printer[i].isActive) name = "";
-    else name = mmSettings->printer[i].nickname;
-    tft.drawString(name, xPos, yPos, PrinterNameFont);
-    xPos += xDelta;
+// Create Display.sprite with the palette of the printer slots
+static void createSlotSprite(uint16_t width) {
+  uint16_t cmap[16];
+  cmap[PI_Background] = Theme::Color_Background;
+  cmap[PI_Border] = Theme::Color_Border;
+  cmap[PI_Text] = Theme::Color_NormalText;
+  cmap[PI_Inactive] = Theme::Color_Inactive;
+  cmap[PI_Offline] = Theme::Color_Offline;
+  cmap[PI_Online] = Theme::Color_Online;
+  cmap[PI_Progress] = Theme::Color_Progress;
+  cmap[PI_Stale] = AppTheme::Color_Stale;
+
+  auto& sprite = Display.sprite;
+  sprite->setColorDepth(4);
+  sprite->createSprite(width, SlotHeight);
+  sprite->createPalette(cmap);
+}
+
+bool HomeScreen::layoutPrinters() {
+  // Printers that are printing or complete come first; otherwise keep the
+  // configured order
+  uint8_t newOrder[MaxPrinters];
+  uint8_t n = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    for (uint8_t i = 0; i < MaxPrinters; i++) {
+      if (!mmSettings->printer[i].isActive) continue;
+      PrintClient::State state = PrintClient::State::Offline;
+      if (mmApp->isPrinterLive(i)) state = mmApp->printerSnapshot(i).state;
+      else if (PrinterStateCache::isValid()) state = PrinterStateCache::get(i).getState();
+      bool busy = (state == PrintClient::State::Printing || state == PrintClient::State::Complete);
+      if (busy == (pass == 0)) newOrder[n++] = i;
+    }
+  }
+
+  bool orderChanged = (n != nShown);
+  for (uint8_t i = 0; i < n && !orderChanged; i++) orderChanged = (newOrder[i] != order[i]);
+  if (!orderChanged) return false;
+  memcpy(order, newOrder, n);
+  nShown = n;
+
+  // Fill the width of the screen, allowing for the overlapping frames
+  nBars = max(n, (uint8_t)1);  // Even with no printers, show one bar
+  barWidth = A::barWidth(nBars);
+  Region r {PB_XOrigin, PB_YOrigin, barWidth, PB_Height};
+  for (uint8_t i = 0; i < N_ProgressBars; i++) {
+    if (i < nShown) { labels[i].init(r, i); r.x += barWidth - PB_FrameSize; }
+    else labels[i].init(0, 0, 0, 0, i);
+  }
+  return true;
+}
+
+void HomeScreen::drawPrinters(bool force) {
+  bool all = layoutPrinters() || force || redrawPrinters;
+  redrawPrinters = false;
+
+  if (all) {
+    // The slots don't quite reach the edges of the screen. Clear what an
+    // earlier layout may have left there.
+    SpritePusher::flush();
+    uint16_t right = PB_XOrigin + nBars*(barWidth - PB_FrameSize) + PB_FrameSize;
+    Display.tft.fillRect(0, SlotYOrigin, PB_XOrigin, SlotHeight, Theme::Color_Background);
+    if (right < Display.Width) {
+      Display.tft.fillRect(right, SlotYOrigin, Display.Width - right, SlotHeight, Theme::Color_Background);
+    }
+  }
+
+  if (nShown == 0) {
+    if (all) drawSlot(0);
+    return;
+  }
+
+  bool usedCache = false;
+  for (uint8_t slot = 0; slot < nShown; slot++) {
+    uint8_t i = order[slot];
+    bool live = mmApp->isPrinterLive(i);
+    uint32_t version = live ? mmApp->printerSnapshot(i).version : 0;
+    if (!live && PrinterStateCache::isValid()) usedCache = true;
+    if (!all && version == drawnVersions[i]) continue;
+    drawnVersions[i] = version;
+    drawSlot(slot);
   }
+  if (usedCache) PerfStats::markBoot(PerfStats::BootPhase::CachedHomeShown);
 }
 
-void HomeScreen::drawStatus(bool force) {
-  (void)force;  // We don't use this parameter. Avoid a warning...
-  for (uint8_t i = 0; i < mmApp->MaxPrinters; i++) {
-    PrintClient *printer = mmApp->printerGroup->getPrinter(i);
+void HomeScreen::drawSlot(uint8_t slot) {
+  auto& sprite = Display.sprite;
+  createSlotSprite(barWidth);
+  sprite->fillSprite(PI_Background);
 
-    if (!mmSettings->printer[i].isActive) {
-      drawProgressBar(i, Theme::Color_Inactive, Theme::Color_NormalText, 1.0, "Unused", false);
+  if (nShown == 0) {
+    drawBar(PI_Inactive, PI_Text, 1.0, "No Printers");
+  } else {
+    uint8_t i = order[slot];
+    sprite->setTextDatum(BC_DATUM);
+    sprite->setTextColor(PI_Text);
+    sprite->drawString(mmSettings->printer[i].nickname, barWidth/2, PrinterNameHeight, PrinterNameFont);
+
+    if (!mmApp->isPrinterLive(i) && PrinterStateCache::isValid()) {
+      const CachedPrinterState& cached = PrinterStateCache::get(i);
+      drawPrinterState(cached.getState(), cached.pct, true);
     } else {
-      switch (printer->getState()) {
-        case PrintClient::State::Offline:
-          drawProgressBar(i, Theme::Color_Offline, Theme::Color_NormalText, 1.0, "Offline", false);
-          break;
-        case PrintClient::State::Operational:
-          drawProgressBar(i, Theme::Color_Online, Theme::Color_Background, 1.0, "Online", false);
-          break;
-        case PrintClient::State::Complete:
-        case PrintClient::State::Printing:
-          drawProgressBar(
-              i, Theme::Color_Progress, Theme::Color_NormalText,
-              printer->getPctComplete()/100.0, "", true);
-          break;
-      }
+      const PrinterSnapshot& printer = mmApp->printerSnapshot(i);
+      drawPrinterState(printer.state, printer.pct, false);
     }
   }
+
+  SpritePusher::push(sprite, A::barX(slot, nBars), SlotYOrigin);
+  sprite->deleteSprite();
+}
+
+void HomeScreen::drawBar(uint8_t barColor, uint8_t txtColor, float pct, const String& txt) {
+  auto& sprite = Display.sprite;
+  uint16_t y = PrinterNameHeight;
+  uint16_t w = barWidth;
+
+  for (uint16_t f = 0; f < PB_FrameSize; f++) {
+    sprite->drawRect(f, y+f, w-2*f, PB_Height-2*f, PI_Border);
+  }
+  uint16_t innerWidth = w - 2*PB_FrameSize;
+  uint16_t innerHeight = PB_Height - 2*PB_FrameSize;
+  uint16_t filled = constrain(pct, 0.0f, 1.0f) * innerWidth;
+  sprite->fillRect(PB_FrameSize, y+PB_FrameSize, filled, innerHeight, barColor);
+
+  Display.setSpriteFont(PB_Font);
+  sprite->setTextColor(txtColor);
+  sprite->setTextDatum(MC_DATUM);
+  sprite->drawString(txt, w/2, y + PB_Height/2);
+}
+
+void HomeScreen::drawPrinterState(PrintClient::State state, float pct, bool stale) {
+  // Stale (cached) state is shown using the normal labels, but with a bar
+  // color that makes it clear the data isn't live
+  switch (state) {
+    case PrintClient::State::Offline:
+      drawBar(stale ? PI_Stale : PI_Offline, PI_Text, 1.0, "Offline");
+      break;
+    case PrintClient::State::Operational:
+      drawBar(stale ? PI_Stale : PI_Online, stale ? PI_Text : PI_Background, 1.0, "Online");
+      break;
+    case PrintClient::State::Complete:
+    case PrintClient::State::Printing:
+      drawBar(stale ? PI_Stale : PI_Progress, PI_Text, pct/100.0, String((int)pct) + "%");
+      break;
+  }
 }
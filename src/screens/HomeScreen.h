@@ -4,10 +4,14 @@
 //--------------- Begin:  Includes ---------------------------------------------
 //                                  Core Libraries
 //                                  Third Party Libraries
+#include <BPA_PrintClient.h>
 //                                  WebThing Includes
+#include <gui/Display.h>
 #include <gui/Screen.h>
 //                                  Local Includes
+#include "../../MMSettings.h"
 #include "DetailScreen.h"
+#include "PanelLayout.h"
 //--------------- End:    Includes ---------------------------------------------
 
 class HomeScreen : public Screen {
@@ -18,17 +22,42 @@ public:
 
   virtual void processPeriodicActivity();
 
+  // Redraw on the next call to processPeriodicActivity rather than waiting
+  // for the normal update interval
+  void requestUpdate() { nextUpdateTime = 0; }
+
+  // Printer settings (such as nicknames) changed. Redraw the printers
+  // even if no new printer data has arrived.
+  void printersChanged() { redrawPrinters = true; requestUpdate(); }
+
 private:
+  static constexpr uint8_t MaxPrinters = MMSettings::MaxPrinters;
+  static constexpr uint16_t MinBarWidth = Layout::Home::MinBarWidth;
+  static_assert(Display.Width / MinBarWidth >= MaxPrinters,
+      "The progress bars for every printer must fit across the display");
+
   uint32_t nextUpdateTime = UINT32_MAX;
 
-  void drawProgressBar(
-      int i, uint16_t barColor, uint16_t txtColor,
-      float pct, String txt, bool showPct);
+  // The active printers in display order (printing or complete first) and
+  // the geometry of their bars
+  uint8_t  order[MaxPrinters];
+  uint8_t  nShown = UINT8_MAX;   // Forces the first layout
+  uint8_t  nBars = 0;            // One per printer shown, or one saying there are none
+  uint16_t barWidth = 0;
+
+  // The snapshot versions the bars were drawn from (0 for printers that
+  // weren't live). A printer's slot is only redrawn when its version changes.
+  bool     redrawPrinters = true;
+  uint32_t drawnVersions[MaxPrinters] = {0};
+
+  bool layoutPrinters();
+  void drawPrinters(bool force = false);
+  void drawSlot(uint8_t slot);
+  void drawBar(uint8_t barColor, uint8_t txtColor, float pct, const String& txt);
+  void drawPrinterState(PrintClient::State state, float pct, bool stale);
   void drawClock(bool force = false);
-  void drawStatus(bool force = false);
   void drawWeather(bool force = false);
   void drawSecondLine(bool force = false);
-  void drawPrinterNames(bool force = false);
 };
 
-#endif  // HomeScreen_h
\ No newline at end of file
+#endif  // HomeScreen_h
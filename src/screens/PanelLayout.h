@@ -0,0 +1,194 @@
+/*
+ * PanelLayout
+ *    The sizes, positions, and fonts used by the HomeScreen and DetailScreen
+ *    for each supported panel resolution.
+ *
+ * NOTES:
+ * o The layout is chosen at compile time from Display.Width and
+ *   Display.Height. Everything here is a constant, so there is no cost at
+ *   runtime for supporting more than one panel.
+ * o Values that depend on the size of a font (heights, kerning) are
+ *   measured, not computed, so each panel lists them explicitly.
+ * o To support another panel, add a specialization of PanelLayout with the
+ *   same members. PanelAreas derives where each screen draws from it and
+ *   checks at compile time that the layout fits.
+ * o tests/host/PanelLayoutTest paints the areas of every panel and checks
+ *   that each is on the panel and that none overlap.
+ *
+ */
+
+#ifndef PanelLayout_h
+#define PanelLayout_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <gui/Display.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+template<uint16_t Width, uint16_t Height>
+struct PanelLayout {
+  static_assert(Width != Width, "No PanelLayout is defined for this panel resolution");
+};
+
+
+// ----- 320x240: e.g. 2.4", 2.8", and 3.2" ILI9341 panels
+template<>
+struct PanelLayout<320, 240> {
+  struct Home {
+    static constexpr auto     WeatherFont = Display.FontID::SB9;
+    static constexpr uint16_t WeatherFontHeight = 22;   // WeatherFont->yAdvance;
+    static constexpr auto     NCFont = Display.FontID::SB9;
+    static constexpr uint16_t NCFontHeight = 22;        // NCFont->yAdvance;
+    static constexpr auto     ClockFont = Display.FontID::D100;
+    static constexpr uint16_t ClockFontHeight = 109;    // ClockFont->yAdvance;
+    static constexpr uint16_t ClockDigitWidth = 70;
+    static constexpr int16_t  ClockYAdjust = -10;       // Perfectly centered doesn't look as good
+    // With this large font some manual "kerning" is required to make it fit
+    static constexpr uint16_t clockX(uint8_t i) {
+      return (i == 0) ? 0 : (i == 1) ? 70 : (i == 2) ? 145 : (i == 3) ? 160 : 230;
+    }
+    static constexpr uint16_t PB_Height = 42;
+    static constexpr auto     PB_Font = Display.FontID::SB9;
+    static constexpr uint16_t MinBarWidth = 80;
+  };
+
+  struct Detail {
+    static constexpr auto     TitleFont = Display.FontID::SB18;
+    static constexpr uint16_t TitleFontHeight = 42;     // TitleFont->yAdvance;
+    static constexpr auto     FileNameFont = Display.FontID::SB9;
+    static constexpr uint16_t FileNameFontHeight = 22;  // FileNameFont->yAdvance;
+    static constexpr uint16_t FileNameAreaHeight = 64;  // Title + File Name, for touch
+    static constexpr uint16_t ThumbSize = 64;           // Beside the title and file name
+    static constexpr auto     ProgressFont = Display.FontID::SB18;
+    static constexpr uint16_t ProgressYOrigin = 100;
+    static constexpr uint16_t ProgressHeight = 42;      // ProgressFont->yAdvance;
+    static constexpr auto     TimeFont = Display.FontID::D20;
+    static constexpr uint16_t TimeWidth = 100;
+    static constexpr uint16_t TimeHeight = 22;
+    static constexpr auto     DetailFont = Display.FontID::SB9;
+    static constexpr uint16_t DetailFontHeight = 22;    // DetailFont->yAdvance;
+  };
+};
+
+
+// ----- 480x320: e.g. 3.5" ILI9488 panels
+template<>
+struct PanelLayout<480, 320> {
+  struct Home {
+    static constexpr auto     WeatherFont = Display.FontID::SB18;
+    static constexpr uint16_t WeatherFontHeight = 42;   // WeatherFont->yAdvance;
+    static constexpr auto     NCFont = Display.FontID::SB18;
+    static constexpr uint16_t NCFontHeight = 42;        // NCFont->yAdvance;
+    static constexpr auto     ClockFont = Display.FontID::D100;
+    static constexpr uint16_t ClockFontHeight = 109;    // ClockFont->yAdvance;
+    static constexpr uint16_t ClockDigitWidth = 70;
+    static constexpr int16_t  ClockYAdjust = -10;
+    // The same font as the 320x240 layout, centered in the wider panel
+    static constexpr uint16_t clockX(uint8_t i) {
+      return 90 + PanelLayout<320, 240>::Home::clockX(i);
+    }
+    static constexpr uint16_t PB_Height = 56;
+    static constexpr auto     PB_Font = Display.FontID::SB18;
+    static constexpr uint16_t MinBarWidth = 80;
+  };
+
+  struct Detail {
+    static constexpr auto     TitleFont = Display.FontID::SB18;
+    static constexpr uint16_t TitleFontHeight = 42;     // TitleFont->yAdvance;
+    static constexpr auto     FileNameFont = Display.FontID::SB9;
+    static constexpr uint16_t FileNameFontHeight = 22;  // FileNameFont->yAdvance;
+    static constexpr uint16_t FileNameAreaHeight = 72;
+    static constexpr uint16_t ThumbSize = 72;
+    static constexpr auto     ProgressFont = Display.FontID::SB18;
+    static constexpr uint16_t ProgressYOrigin = 120;
+    static constexpr uint16_t ProgressHeight = 56;
+    static constexpr auto     TimeFont = Display.FontID::D20;
+    static constexpr uint16_t TimeWidth = 100;
+    static constexpr uint16_t TimeHeight = 22;
+    static constexpr auto     DetailFont = Display.FontID::SB9;
+    static constexpr uint16_t DetailFontHeight = 22;    // DetailFont->yAdvance;
+  };
+};
+
+
+// ----- The areas each screen draws, for any panel
+template<uint16_t Width, uint16_t Height>
+struct PanelAreas {
+  // The weather is on top, then the next completion. The printers' slots,
+  // each a name above a progress bar, are on the bottom and the clock is
+  // in the space between.
+  struct Home {
+    using L = typename PanelLayout<Width, Height>::Home;
+
+    static constexpr uint16_t WeatherYOrigin = 0;
+    static constexpr uint16_t WeatherHeight = L::WeatherFontHeight;
+    static constexpr uint16_t NCYOrigin = WeatherYOrigin + WeatherHeight + 2;
+    static constexpr uint16_t NCHeight = L::NCFontHeight;
+
+    static constexpr uint16_t PrinterNameHeight = 16;             // The small 5x7 font
+    static constexpr uint16_t PB_FrameSize = 2;
+    static constexpr uint16_t PB_XOrigin = 1;
+    static constexpr uint16_t PB_YOrigin = Height - L::PB_Height;
+    static constexpr uint16_t PBLabelsYOrigin = PB_YOrigin - 10;  // Space for teeny label + pad
+    static constexpr uint16_t SlotYOrigin = PB_YOrigin - PrinterNameHeight;
+    static constexpr uint16_t SlotHeight = PrinterNameHeight + L::PB_Height;
+
+    static constexpr uint16_t ClockYOrigin = NCYOrigin + NCHeight;
+    static constexpr uint16_t ClockHeight = PBLabelsYOrigin - ClockYOrigin;
+    // Perfectly centered in its area doesn't look as good
+    static constexpr uint16_t ClockSpriteYOrigin =
+        ClockYOrigin + (ClockHeight - L::ClockFontHeight)/2 + L::ClockYAdjust;
+
+    // The bars fill the width of the panel. The rightmost frame of each
+    // overlaps the leftmost frame of the next.
+    static constexpr uint16_t barWidth(uint8_t nBars) {
+      return (Width - PB_XOrigin + (nBars-1)*PB_FrameSize) / nBars;
+    }
+    static constexpr uint16_t barX(uint8_t slot, uint8_t nBars) {
+      return PB_XOrigin + slot*(barWidth(nBars) - PB_FrameSize);
+    }
+
+    static_assert(ClockHeight >= L::ClockFontHeight, "The clock doesn't fit on this panel");
+    static_assert(L::clockX(4) + L::ClockDigitWidth <= Width, "The clock is too wide for this panel");
+  };
+
+  // The title and file name are on top, with room for a thumbnail to their
+  // left. Then come the progress bar, the time, and two lines of details.
+  struct Detail {
+    using L = typename PanelLayout<Width, Height>::Detail;
+
+    static constexpr uint16_t TitleAreaYOrigin = 0;
+    static constexpr uint16_t TitleAreaHeight = L::TitleFontHeight;
+    static constexpr uint16_t FileNameYOrigin = TitleAreaYOrigin + TitleAreaHeight;
+    static constexpr uint16_t ThumbXMargin = 4;
+
+    static constexpr uint16_t ProgressXInset = 4;
+    static constexpr uint16_t ProgressXOrigin = ProgressXInset;
+    static constexpr uint16_t ProgressWidth = Width - (2 * ProgressXInset);
+
+    static constexpr uint16_t TimeXOrigin = (Width - L::TimeWidth)/2;
+    static constexpr uint16_t TimeYOrigin = L::ProgressYOrigin + L::ProgressHeight + 15;
+
+    static constexpr uint16_t DetailXInset = 10;
+    static constexpr uint16_t DetailYBottomMargin = 4;
+    static constexpr uint16_t DetailHeight = 2 * L::DetailFontHeight;
+    static constexpr uint16_t DetailYOrigin = Height - DetailHeight - DetailYBottomMargin;
+
+    static_assert(FileNameYOrigin + L::FileNameFontHeight <= L::ProgressYOrigin,
+        "The file name overlaps the progress bar");
+    static_assert(TimeYOrigin + L::TimeHeight <= DetailYOrigin, "The time overlaps the details");
+    static_assert(L::ThumbSize <= L::ProgressYOrigin, "The thumbnail overlaps the progress bar");
+  };
+};
+
+
+// The layout for the panel this build targets
+using Layout = PanelLayout<Display.Width, Display.Height>;
+using Areas = PanelAreas<Display.Width, Display.Height>;
+
+#endif  // PanelLayout_h
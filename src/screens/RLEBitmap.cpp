@@ -0,0 +1,36 @@
+/*
+ * RLEBitmap
+ *    Draw run-length encoded monochrome bitmaps as filled spans
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+#include "RLEBitmap.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace RLEBitmap {
+  void draw(
+      TFT_eSPI& tft, int32_t x, int32_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+      uint16_t fgcolor, uint16_t bgcolor)
+  {
+    // See tools/rle_bitmap.py for the encoding
+    tft.startWrite();
+    for (int16_t row = 0; row < h; ) {
+      uint8_t rows = pgm_read_byte(bitmap++);
+      bool set = false;   // Runs alternate, starting with clear pixels
+      for (int16_t col = 0; col < w; set = !set) {
+        uint8_t length = pgm_read_byte(bitmap++);
+        if (length) tft.fillRect(x + col, y + row, length, rows, set ? fgcolor : bgcolor);
+        col += length;
+      }
+      row += rows;
+    }
+    tft.endWrite();
+  }
+};
@@ -0,0 +1,36 @@
+/*
+ * RLEBitmap
+ *    Draw monochrome bitmaps that were run-length encoded at build time by
+ *    tools/rle_bitmap.py.
+ *
+ * NOTES:
+ * o Each run is drawn with a single fillRect(), and a run that is the same
+ *   in several identical rows is drawn once for all of them. TFT_eSPI's
+ *   drawBitmap() draws each pixel on its own.
+ * o The bitmaps take about a third of the flash of the raw 1-bit arrays.
+ *   Their sources are in tools/images. Rerun tools/rle_bitmap.py after
+ *   changing one.
+ *
+ */
+
+#ifndef RLEBitmap_h
+#define RLEBitmap_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace RLEBitmap {
+  // As with drawBitmap(), set pixels are drawn in fgcolor and clear pixels
+  // in bgcolor. The bitmap is in PROGMEM.
+  void draw(
+      TFT_eSPI& tft, int32_t x, int32_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+      uint16_t fgcolor, uint16_t bgcolor);
+};
+
+#endif  // RLEBitmap_h
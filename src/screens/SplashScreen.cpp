@@ -10,8 +10,10 @@
 //                                  Local Includes
 #include "SplashScreen.h"
 #include "AppTheme.h"
+#include "RLEBitmap.h"
 #include "images/Duet3DMono.h"
 #include "images/OctoMono.h"
+#include "../../MMFeatures.h"
 //--------------- End:    Includes ---------------------------------------------
 
 
@@ -24,12 +26,20 @@ void SplashScreen::display(bool) {
   auto& tft = Display.tft;
 
   tft.fillScreen(Theme::Color_SplashBkg);
-  tft.drawBitmap(
-      6, 10, OctoMono, OctoMono_Width, OctoMono_Height,
+  // The artwork is side by side, or centered if there is only one
+  constexpr bool both = MM_FEATURE_OCTO_SPLASH && MM_FEATURE_DUET_SPLASH;
+#if MM_FEATURE_OCTO_SPLASH
+  RLEBitmap::draw(
+      tft, both ? 6 : (Display.Width-OctoMono_Width)/2, 10,
+      OctoMono_RLE, OctoMono_Width, OctoMono_Height,
       Theme::Color_SplashBkg, AppTheme::Color_SplashOcto);
-  tft.drawBitmap(
-      Display.XCenter+6, 10, Duet3DMono, Duet3DMono_Width, Duet3DMono_Height,
+#endif
+#if MM_FEATURE_DUET_SPLASH
+  RLEBitmap::draw(
+      tft, both ? Display.XCenter+6 : (Display.Width-Duet3DMono_Width)/2, 10,
+      Duet3DMono_RLE, Duet3DMono_Width, Duet3DMono_Height,
       Theme::Color_SplashBkg, AppTheme::Color_SplashD3);
+#endif
 
   Display.setFont(Display.FontID::SBO24);
   tft.setTextColor(Theme::Color_SplashText);
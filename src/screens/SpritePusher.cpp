@@ -0,0 +1,104 @@
+/*
+ * SpritePusher
+ *    Send sprites to the display, using DMA where available
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+#if defined(ESP32)
+  #include <esp_heap_caps.h>
+#endif
+//                                  WebThing Includes
+#include <gui/Display.h>
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "SpritePusher.h"
+#include "SpriteUnpacker.h"
+#include "../util/PerfStats.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+#if defined(ESP32) && !defined(MM_NO_DMA)
+  #define MM_USE_DMA 1
+#endif
+
+namespace SpritePusher {
+  namespace Internal {
+    uint8_t batchDepth = 0;
+
+#if defined(MM_USE_DMA)
+    // Each buffer holds a full row of the widest panel several times over
+    static constexpr uint16_t ChunkPixels = 480 * 8;
+
+    uint16_t* buffers[2] = {nullptr, nullptr};
+    uint8_t   nextBuffer = 0;
+    bool      dmaReady = false;
+    bool      dmaFailed = false;
+    bool      inTransaction = false;
+
+    bool begin() {
+      if (dmaFailed) return false;
+      if (!dmaReady) {
+        // Allocated on first use and kept. Fall back to pushSprite for good
+        // if DMA can't be set up.
+        buffers[0] = (uint16_t*)heap_caps_malloc(ChunkPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+        buffers[1] = (uint16_t*)heap_caps_malloc(ChunkPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+        dmaReady = buffers[0] && buffers[1] && Display.tft.initDMA();
+        if (!dmaReady) {
+          MM_LOG_WARNING(F("SpritePusher: DMA unavailable, using pushSprite"));
+          dmaFailed = true;
+          return false;
+        }
+      }
+      if (!inTransaction) { Display.tft.startWrite(); inTransaction = true; }
+      return true;
+    }
+#endif
+  } // ----- END: SpritePusher::Internal
+
+
+  void push(TFT_eSprite* sprite, int32_t x, int32_t y) {
+    PerfStats::Scope timer(PerfStats::Case::SpritePush);
+#if defined(MM_USE_DMA)
+    using namespace Internal;
+    if (batchDepth == 0 || !begin()) { sprite->pushSprite(x, y); return; }
+
+    auto& tft = Display.tft;
+    SpriteUnpacker unpacker(sprite, tft.bitmap_fg, tft.bitmap_bg);
+    int16_t w = sprite->width();
+    int16_t h = sprite->height();
+    int16_t rowsPerChunk = max(1, ChunkPixels / w);
+    for (int16_t row = 0; row < h; row += rowsPerChunk) {
+      int16_t rows = min(rowsPerChunk, (int16_t)(h - row));
+      // The other buffer may still be in flight, but this one is free.
+      // pushImageDMA() waits for the transfer in flight before starting
+      // the next, so there is no need to wait here.
+      unpacker.unpack(row, rows, buffers[nextBuffer]);
+      tft.pushImageDMA(x, y + row, w, rows, buffers[nextBuffer]);
+      nextBuffer ^= 1;
+    }
+#else
+    sprite->pushSprite(x, y);
+#endif
+  }
+
+  void flush() {
+#if defined(MM_USE_DMA)
+    if (Internal::inTransaction) {
+      Display.tft.dmaWait();
+      Display.tft.endWrite();
+      Internal::inTransaction = false;
+    }
+#endif
+  }
+
+  Batch::Batch() { Internal::batchDepth++; }
+
+  Batch::~Batch() {
+    if (--Internal::batchDepth == 0) flush();
+  }
+};
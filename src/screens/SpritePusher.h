@@ -0,0 +1,48 @@
+/*
+ * SpritePusher
+ *    Send sprites to the display. On the ESP32 this is done with DMA so the
+ *    CPU can prepare the next region while the current one is being sent.
+ *
+ * NOTES:
+ * o A sprite is converted to 16-bit pixels a few rows at a time into one
+ *   of two buffers (see SpriteUnpacker). While DMA sends one buffer, the
+ *   next rows are converted into the other.
+ * o The last chunk of a sprite is still being sent when push() returns.
+ *   The caller is free to delete the sprite and start drawing the next one
+ *   in the meantime.
+ * o DMA is only used between the creation and destruction of a Batch. All
+ *   the pushes in a Batch share one SPI transaction. Drawing directly to
+ *   the tft while a Batch is open requires a call to flush() first.
+ * o On the ESP8266, or if MM_NO_DMA is defined, push() just calls
+ *   pushSprite().
+ *
+ */
+
+#ifndef SpritePusher_h
+#define SpritePusher_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace SpritePusher {
+  // Send the sprite to the display with its top left corner at (x, y)
+  void push(TFT_eSprite* sprite, int32_t x, int32_t y);
+
+  // Wait for any transfer in progress to complete
+  void flush();
+
+  // Enables DMA transfers for its lifetime. Batches may be nested.
+  class Batch {
+  public:
+    Batch();
+    ~Batch();
+  };
+};
+
+#endif  // SpritePusher_h
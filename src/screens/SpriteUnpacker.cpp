@@ -0,0 +1,87 @@
+/*
+ * SpriteUnpacker
+ *    Convert the pixels of a sprite to the 16-bit form the display expects
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+#include "SpriteUnpacker.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+static inline uint16_t swapped(uint16_t color) { return (color >> 8) | (color << 8); }
+
+SpriteUnpacker::SpriteUnpacker(TFT_eSprite* sprite, uint16_t fg, uint16_t bg) :
+    _sprite(sprite),
+    _pixels((const uint8_t*)sprite->getPointer()),
+    _width(sprite->width()),
+    _depth(sprite->getColorDepth())
+{
+  if (_pixels == nullptr || sprite->getRotation() != 0) _depth = 0;
+  if (_depth == 4) {
+    for (uint8_t i = 0; i < 16; i++) _colors[i] = swapped(sprite->getPaletteColor(i));
+  } else if (_depth == 1) {
+    _colors[0] = swapped(bg);
+    _colors[1] = swapped(fg);
+  } else if (_depth != 16) {
+    _depth = 0;
+  }
+}
+
+void SpriteUnpacker::unpack(int16_t row, int16_t rows, uint16_t* out) const {
+  const int16_t w = _width;
+
+  switch (_depth) {
+    case 16:
+      // Already stored in the display's byte order
+      memcpy(out, (const uint16_t*)_pixels + row * w, rows * w * sizeof(uint16_t));
+      return;
+
+    case 4: {
+      const int16_t stride = (w + 1) >> 1;   // bytes
+      for (int16_t r = 0; r < rows; r++) {
+        const uint8_t* p = _pixels + (row + r) * stride;
+        int16_t c = w;
+        for (; c >= 2; c -= 2) {
+          uint8_t b = *p++;
+          *out++ = _colors[b >> 4];
+          *out++ = _colors[b & 0x0F];
+        }
+        if (c) *out++ = _colors[*p >> 4];
+      }
+      return;
+    }
+
+    case 1: {
+      const int16_t stride = (w + 7) >> 3;   // bytes
+      const uint16_t bg = _colors[0];
+      const uint16_t fg = _colors[1];
+      for (int16_t r = 0; r < rows; r++) {
+        const uint8_t* p = _pixels + (row + r) * stride;
+        for (int16_t c = 0; c < w; c += 8) {
+          uint8_t bits = *p++;
+          // Runs of clear or set pixels are common, so handle whole bytes of them quickly
+          if (w - c >= 8 && (bits == 0x00 || bits == 0xFF)) {
+            uint16_t color = bits ? fg : bg;
+            for (uint8_t b = 0; b < 8; b++) *out++ = color;
+            continue;
+          }
+          int16_t n = min((int16_t)8, (int16_t)(w - c));
+          for (int16_t b = 0; b < n; b++, bits <<= 1) *out++ = (bits & 0x80) ? fg : bg;
+        }
+      }
+      return;
+    }
+
+    default:
+      for (int16_t r = 0; r < rows; r++) {
+        for (int16_t c = 0; c < w; c++) *out++ = swapped(_sprite->readPixel(c, row + r));
+      }
+      return;
+  }
+}
@@ -0,0 +1,46 @@
+/*
+ * SpriteUnpacker
+ *    Convert the pixels of a sprite to the 16-bit form the display expects
+ *
+ * NOTES:
+ * o The pixels are read straight from the sprite's buffer rather than with
+ *   readPixel(), which checks bounds, rotation, and color depth for every
+ *   pixel. 1-bit pixels are unpacked a byte at a time and 4-bit pixels two
+ *   at a time, through a table of colors that are already byte-swapped.
+ * o This relies on TFT_eSprite's layout: 16-bit pixels are stored
+ *   byte-swapped, rows of 4-bit pixels are padded to an even width, and
+ *   rows of 1-bit pixels to a multiple of 8, most significant bit first.
+ *   Rotated sprites and other depths are converted with readPixel().
+ *
+ */
+
+#ifndef SpriteUnpacker_h
+#define SpriteUnpacker_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class SpriteUnpacker {
+public:
+  // fg and bg are the colors of the set and clear pixels of a 1-bit sprite.
+  // TFT_eSPI keeps them in the tft as bitmap_fg and bitmap_bg.
+  SpriteUnpacker(TFT_eSprite* sprite, uint16_t fg, uint16_t bg);
+
+  // Fill out with rows [row, row + rows) of the sprite, big-endian
+  void unpack(int16_t row, int16_t rows, uint16_t* out) const;
+
+private:
+  TFT_eSprite*   _sprite;
+  const uint8_t* _pixels;
+  int16_t        _width;
+  uint8_t        _depth;      // 0 if readPixel() must be used
+  uint16_t       _colors[16]; // Swapped palette (4-bit) or bg and fg (1-bit)
+};
+
+#endif  // SpriteUnpacker_h
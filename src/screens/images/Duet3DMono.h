@@ -1,347 +1,118 @@
-
-/*******************************************************************************
-* generated by lcd-image-converter rev.030b30d from 2019-03-17 01:38:34 +0500
-* image
-* filename: unsaved
-* name: Duet3D_Compatible_Mono
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* split to rows: yes
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-#define Duet3DMono_Width  (152)
-#define Duet3DMono_Height (160)
-
-static const uint8_t Duet3DMono[3040] PROGMEM = {
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████████████████████∙█████████████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████████████∙∙∙████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████∙∙∙∙∙███████████████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████
-    // ███████████████████████████████████████████████∙∙∙∙∙∙∙∙███████████████████████████████████████∙∙∙∙∙∙∙∙██████████████████████████████████████████████████
-    // ██████████████████████████████████████████████∙∙∙∙∙∙∙███████████████████████████████████████████∙∙∙∙∙∙∙█████████████████████████████████████████████████
-    // █████████████████████████████████████████████∙∙∙∙∙∙███████████████████████████████████████████████∙∙∙∙∙∙████████████████████████████████████████████████
-    // ████████████████████████████████████████████∙∙∙∙∙∙██████████████████████████████████████████████████∙∙∙∙∙███████████████████████████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙█████████████████████████████████████████████████████∙∙∙∙∙██████████████████████████████████████████████
-    // ██████████████████████████████████████████∙∙∙∙█████████████████████████████████████████████████████████∙∙∙∙█████████████████████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙███████████████████████████████████████████████████████████∙∙∙∙████████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙███████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙███████████████████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙██████████████████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙█████████████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙████████████∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████
-    // ███████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙███████████████████████████∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙███████████████████████████████∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙███████████████████████████████████∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙███████████████████∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙████∙∙████∙∙∙∙∙∙██████████████∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙████∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙███∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙████∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙██∙∙∙∙∙∙∙███████∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙██∙∙∙∙∙██████████∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙██∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙██∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙██∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙██∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙██∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙██∙∙∙███∙∙∙∙∙∙∙∙███∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙██∙∙∙██████████████∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙██∙∙∙██████████████∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙██∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙██∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙██∙∙∙∙∙∙∙∙∙██∙∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙██∙∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙████∙∙∙∙∙███∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙██∙∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙████∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███████████████∙∙∙∙∙∙████∙∙∙∙████∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙███████████████∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██████████████∙∙∙∙∙∙∙∙███████████∙∙∙∙∙███████████∙∙∙∙∙█████∙∙∙██████████∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙████████████∙∙∙∙∙∙∙∙∙∙∙██████∙∙██∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙████∙∙∙∙∙███████∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙██∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙██∙∙██∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙███∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙██∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙███████∙████∙∙∙∙█∙█████∙∙∙∙██████∙∙∙█████∙██∙∙███████∙∙∙∙██∙∙∙∙█████∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙███∙∙∙███∙∙████∙∙██∙∙∙███∙∙██∙∙∙███∙∙∙██∙∙∙██∙∙∙██∙∙████████∙∙∙██∙∙∙██∙∙∙██∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙███∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙███∙∙∙∙██∙∙██∙∙██∙∙∙∙∙██∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙∙∙∙∙∙∙██∙∙∙██∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙██∙∙∙∙∙██∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙∙∙██████∙∙∙██∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙█████████∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙██∙∙∙∙∙∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙█████∙██∙∙∙██∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙██∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙██∙∙∙∙∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙██∙∙∙∙∙██∙∙██∙∙██∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙███∙∙∙∙∙███∙∙██∙∙∙∙███∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙∙∙██∙∙██∙∙∙∙██∙∙∙██∙∙∙██∙∙███∙∙∙∙██∙∙██∙∙██∙∙∙∙∙██∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙█████████∙∙∙∙██∙∙███∙∙∙██∙∙∙∙██∙∙∙██∙∙∙███∙∙██∙∙∙███∙∙████∙∙███∙∙██∙∙████∙███∙∙∙██∙∙∙███████∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙███████∙∙∙∙∙∙█████∙∙∙∙██∙∙∙∙██∙∙∙██∙∙∙██████∙∙∙∙∙█████∙██∙∙∙███∙██∙∙██∙████∙∙∙∙██∙∙∙∙█████∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0x01, 0xff, 0xff, 0xf8, 0x07, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xfc, 0x07, 0xff, 0xff, 0xff, 0x01, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x60, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0x80, 0x78, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0xff, 0xf0, 0x38, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x7f, 0xf0, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0xc0, 0x7f, 0xfc, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x79, 0xe0, 0x7f, 0xfe, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x70, 0x70, 0x0f, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0xe0, 0x70, 0x70, 0x07, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0xe0, 0x70, 0x70, 0x03, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0xe0, 0x30, 0x1f, 0xc1, 0xfc, 0x00, 0x70, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0xe0, 0x30, 0x7f, 0xe1, 0xfc, 0x00, 0x70, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x38, 0xe0, 0x30, 0x70, 0x70, 0x70, 0x01, 0xe0, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x38, 0xe0, 0x30, 0xe0, 0x38, 0x60, 0x07, 0xc0, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x38, 0xe0, 0x30, 0xe0, 0x38, 0x60, 0x07, 0xe0, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x38, 0xe0, 0x31, 0xc0, 0x38, 0x60, 0x00, 0x70, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x38, 0xe0, 0x31, 0xff, 0xf8, 0x60, 0x00, 0x38, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0xe0, 0x31, 0xff, 0xf8, 0x60, 0x00, 0x38, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0xe0, 0x31, 0xc0, 0x00, 0x60, 0x00, 0x18, 0x70, 0x01, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x70, 0xe0, 0x31, 0xc0, 0x00, 0x60, 0xc0, 0x18, 0x70, 0x03, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0xe0, 0xe0, 0x70, 0xe0, 0x38, 0x60, 0xe0, 0x38, 0x70, 0x03, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x01, 0xe0, 0xe0, 0x70, 0xe0, 0x38, 0x60, 0xe0, 0x38, 0x70, 0x0f, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xc0, 0xf0, 0xf0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0xff, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0x80, 0x7f, 0xf0, 0x7f, 0xf0, 0x7c, 0x7f, 0xe0, 0x7f, 0xfc, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1f, 0xfe, 0x00, 0x3f, 0x30, 0x1f, 0xc0, 0x3c, 0x1f, 0xc0, 0x7f, 0xf0, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x06, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x30, 0x06, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x06, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x06, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x1c, 0x00, 0x1f, 0x0f, 0xef, 0x0b, 0xe1, 0xf8, 0xfb, 0x3f, 0x86, 0x1f, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x18, 0x00, 0x33, 0x8e, 0x79, 0x8e, 0x63, 0x8c, 0x63, 0x3f, 0xc6, 0x31, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x18, 0x00, 0x61, 0xcc, 0x31, 0x8c, 0x33, 0x0c, 0x63, 0x38, 0x66, 0x60, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x18, 0x00, 0x60, 0xcc, 0x31, 0x8c, 0x30, 0x0c, 0x63, 0x30, 0x66, 0x60, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x18, 0x00, 0x60, 0xcc, 0x31, 0x8c, 0x30, 0xfc, 0x63, 0x30, 0x66, 0x7f, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x18, 0x06, 0x60, 0xcc, 0x31, 0x8c, 0x33, 0xec, 0x63, 0x30, 0x66, 0x60, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x0c, 0x06, 0x60, 0xcc, 0x31, 0x8c, 0x33, 0x0c, 0x63, 0x30, 0x66, 0x60, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x0e, 0x0e, 0x61, 0xcc, 0x31, 0x8c, 0x33, 0x0c, 0x63, 0x38, 0x66, 0x60, 0xc7, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x07, 0xfc, 0x33, 0x8c, 0x31, 0x8e, 0x63, 0x9e, 0x73, 0x3d, 0xc6, 0x3f, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x03, 0xf8, 0x1f, 0x0c, 0x31, 0x8f, 0xc1, 0xf6, 0x3b, 0x37, 0x86, 0x1f, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-
-
+/*
+ * Duet3DMono
+ *    Generated by tools/rle_bitmap.py from tools/images/Duet3DMono.h. Don't edit.
+ *
+ * NOTES:
+ * o 152x160 pixels, run-length encoded from 3040 to 1562 bytes. Draw it
+ *   with RLEBitmap::draw().
+ *
+ */
+
+#ifndef Duet3DMono_h
+#define Duet3DMono_h
+
+#define Duet3DMono_Width  (152)
+#define Duet3DMono_Height (160)
+
+static const uint8_t Duet3DMono_RLE[1562] PROGMEM = {
+    1,   0, 152,   1,   0,  74,   1,  77,   1,   0,  73,   3,  76,   1,   0,  72,
+    5,  75,   1,   0,  71,   7,  74,   1,   0,  70,   9,  73,   1,   0,  69,  11,
+   72,   1,   0,  68,  13,  71,   1,   0,  67,  15,  70,   1,   0,  66,  17,  69,
+    1,   0,  65,  19,  68,   1,   0,  64,  21,  67,   1,   0,  63,  23,  66,   1,
+    0,  62,  25,  65,   1,   0,  61,  27,  64,   1,   0,  60,  29,  63,   1,   0,
+   59,  31,  62,   1,   0,  58,  33,  61,   1,   0,  57,  35,  60,   1,   0,  56,
+   37,  59,   1,   0,  55,  39,  58,   1,   0,  54,  41,  57,   1,   0,  53,  43,
+   56,   1,   0,  52,  45,  55,   1,   0,  51,  21,   5,  21,  54,   1,   0,  50,
+   15,  20,  14,  53,   1,   0,  49,  12,  28,  11,  52,   1,   0,  48,  10,  34,
+    9,  51,   1,   0,  47,   8,  39,   8,  50,   1,   0,  46,   7,  43,   7,  49,
+    1,   0,  45,   6,  47,   6,  48,   1,   0,  44,   6,  50,   5,  47,   1,   0,
+   43,   5,  53,   5,  46,   1,   0,  42,   4,  57,   4,  45,   1,   0,  41,   4,
+   59,   4,  44,   1,   0,  40,   4,  23,  14,  24,   4,  43,   1,   0,  39,   5,
+   19,  23,  19,   5,  42,   1,   0,  38,   6,  16,  28,  16,   7,  41,   1,   0,
+   37,   8,  13,   9,  15,   9,  12,   9,  40,   1,   0,  36,  10,  10,   7,  22,
+    8,   9,  11,  39,   1,   0,  35,  12,   7,   7,  27,   7,   7,  12,  38,   1,
+    0,  34,  14,   4,   7,  31,   6,   5,  13,  38,   1,   0,  34,  15,   2,   6,
+   35,   6,   2,  15,  37,   1,   0,  33,  22,  39,  22,  36,   1,   0,  32,  22,
+   41,  22,  35,   1,   0,  32,  20,  44,  21,  35,   1,   0,  31,  21,  45,  21,
+   34,   1,   0,  30,  23,  14,  15,  14,  23,  33,   1,   0,  30,  24,  10,  21,
+   10,  24,  33,   1,   0,  29,  26,   7,  25,   7,  26,  32,   1,   0,  29,  27,
+    4,   8,  13,   8,   4,  27,  32,   1,   0,  28,  28,   3,   6,  19,   6,   3,
+   28,  31,   1,   0,  28,  35,  23,  35,  31,   1,   0,  27,  35,  25,  34,  31,
+    2,   0,  27,  33,  29,  33,  30,   1,   0,  26,  35,  27,  35,  29,   2,   0,
+   26,  36,  25,  36,  29,   1,   0,  25,  38,   6,  11,   6,  38,  28,   1,   0,
+   25,  39,   3,  15,   3,  39,  28,   1,   0,  25,  99,  28,   1,   0,  25,  45,
+    8,  46,  28,   1,   0,  24,  44,  12,  44,  28,   2,   0,  24,  44,  13,  44,
+   27,   1,   0,  24,  45,  11,  45,  27,   1,   0,  24,  46,   9,  46,  27,   1,
+    0,  24,  47,   7,  47,  27,   1,   0,  24,  48,   5,  48,  27,   2,   0,  24,
+   49,   3,  49,  27,   9,   0,  24, 101,  27,   1,   0,  24,  46,   9,  46,  27,
+    1,   0,  25,  43,  13,  43,  28,   1,   0,  25,  41,   5,   7,   5,  41,  28,
+    1,   0,  25,  40,   4,  11,   4,  40,  28,   1,   0,  25,  39,   3,  15,   3,
+   39,  28,   1,   0,  25,  38,   3,  17,   3,  37,  29,   1,   0,  26,  36,   3,
+   19,   3,  36,  29,   1,   0,  26,  36,   2,  21,   2,  36,  29,   1,   0,  26,
+   35,   3,  21,   3,  34,  30,   2,   0,  27,  34,   2,  23,   2,  34,  30,   1,
+    0,  28,  32,   3,  23,   3,  32,  31,   1,   0,  28,  32,   2,  24,   3,  32,
+   31,   1,   0,  28,  32,   2,  25,   2,  31,  32,   1,   0,  29,  31,   2,  25,
+    2,  31,  32,   1,   0,  29,  31,   2,  25,   2,  30,  33,   1,   0,  30,  30,
+    2,  24,   3,  30,  33,   1,   0,  31,  29,   3,  23,   2,  30,  34,   1,   0,
+   31,  30,   2,  23,   2,  30,  34,   1,   0,  32,  29,   2,  22,   3,  29,  35,
+    1,   0,  33,  28,   3,  21,   3,  28,  36,   2,   0,  65,  19,  68,   1,   0,
+   25,  99,  28,   4,   0,  24, 101,  27,   1,   0,  24,   4,  11,  53,   5,   8,
+   11,   9,  27,   1,   0,  24,   3,  14,  41,   1,   7,   8,   7,  13,   7,  27,
+    1,   0,  24,   3,  15,  39,   2,   6,   4,   2,   4,   6,  14,   6,  27,   1,
+    0,  24,   3,   3,   9,   4,  38,   2,   6,   3,   5,   3,   5,   3,   8,   4,
+    5,  27,   1,   0,  24,   3,   3,  10,   3,  38,   2,   5,   3,   6,   3,   5,
+    3,   9,   4,   4,  27,   1,   0,  24,   3,   3,  11,   3,  37,   3,   4,   3,
+    6,   3,   5,   3,  10,   3,   4,  27,   1,   0,  24,   3,   3,  11,   3,   4,
+    3,   7,   2,   7,   7,   5,   7,  11,   3,   5,   3,  11,   3,   3,  27,   1,
+    0,  24,   3,   3,  11,   3,   4,   3,   7,   2,   5,  10,   4,   7,  11,   3,
+    5,   3,  11,   3,   3,  27,   1,   0,  24,   3,   3,  12,   3,   3,   3,   7,
+    2,   5,   3,   5,   3,   5,   3,  11,   4,   6,   3,  11,   3,   3,  27,   1,
+    0,  24,   3,   3,  12,   3,   3,   3,   7,   2,   4,   3,   7,   3,   4,   2,
+   10,   5,   7,   3,  11,   3,   3,  27,   1,   0,  24,   3,   3,  12,   3,   3,
+    3,   7,   2,   4,   3,   7,   3,   4,   2,  10,   6,   6,   3,  11,   3,   3,
+   27,   1,   0,  24,   3,   3,  12,   3,   3,   3,   7,   2,   3,   3,   8,   3,
+    4,   2,  14,   3,   5,   3,  11,   3,   3,  27,   1,   0,  24,   3,   3,  12,
+    3,   3,   3,   7,   2,   3,  14,   4,   2,  15,   3,   4,   3,  11,   3,   3,
+   27,   1,   0,  24,   3,   3,  11,   3,   4,   3,   7,   2,   3,  14,   4,   2,
+   15,   3,   4,   3,  11,   3,   3,  27,   1,   0,  24,   3,   3,  11,   3,   4,
+    3,   7,   2,   3,   3,  15,   2,  16,   2,   4,   3,  11,   3,   3,  27,   1,
+    0,  24,   3,   3,  11,   3,   4,   3,   7,   2,   3,   3,  15,   2,   5,   2,
+    9,   2,   4,   3,  10,   3,   4,  27,   1,   0,  24,   3,   3,  10,   3,   5,
+    3,   6,   3,   4,   3,   7,   3,   4,   2,   5,   3,   7,   3,   4,   3,  10,
+    3,   4,  27,   1,   0,  24,   3,   3,   9,   4,   5,   3,   6,   3,   4,   3,
+    7,   3,   4,   2,   5,   3,   7,   3,   4,   3,   8,   4,   5,  27,   1,   0,
+   24,   3,  15,   6,   4,   4,   4,   5,   3,   5,   3,   5,   3,   5,   3,   5,
+    3,   5,  15,   5,  27,   1,   0,  24,   3,  14,   8,  11,   5,  11,   5,   5,
+    3,  10,   6,  13,   7,  27,   1,   0,  24,   3,  12,  11,   6,   2,   2,   7,
+    7,   8,   4,   5,   7,   7,  11,   9,  27,   7,   0,  24, 101,  27,   1,   0,
+   24,   7,   5,  58,   2,   2,   2,   9,   2,  14,  27,   1,   0,  24,   5,   9,
+   51,   2,   3,   2,   2,   2,   9,   2,  14,  27,   1,   0,  24,   4,   3,   5,
+    2,  51,   2,   7,   2,   9,   2,  14,  27,   1,   0,  24,   4,   2,   7,   2,
+   50,   2,   7,   2,   9,   2,  14,  27,   1,   0,  24,   3,   3,  13,   5,   4,
+    7,   1,   4,   4,   1,   1,   5,   4,   6,   3,   5,   1,   2,   2,   7,   4,
+    2,   4,   5,   5,  27,   1,   0,  24,   3,   2,  13,   2,   2,   3,   3,   3,
+    2,   4,   2,   2,   3,   3,   2,   2,   3,   3,   3,   2,   3,   2,   3,   2,
+    2,   8,   3,   2,   3,   2,   3,   2,   4,  27,   1,   0,  24,   3,   2,  12,
+    2,   4,   3,   2,   2,   4,   2,   3,   2,   3,   2,   4,   2,   2,   2,   4,
+    2,   3,   2,   3,   2,   2,   3,   4,   2,   2,   2,   2,   2,   5,   2,   3,
+   27,   1,   0,  24,   3,   2,  12,   2,   5,   2,   2,   2,   4,   2,   3,   2,
+    3,   2,   4,   2,   8,   2,   3,   2,   3,   2,   2,   2,   5,   2,   2,   2,
+    2,   2,   5,   2,   3,  27,   1,   0,  24,   3,   2,  12,   2,   5,   2,   2,
+    2,   4,   2,   3,   2,   3,   2,   4,   2,   4,   6,   3,   2,   3,   2,   2,
+    2,   5,   2,   2,   2,   2,   9,   3,  27,   1,   0,  24,   3,   2,   8,   2,
+    2,   2,   5,   2,   2,   2,   4,   2,   3,   2,   3,   2,   4,   2,   2,   5,
+    1,   2,   3,   2,   3,   2,   2,   2,   5,   2,   2,   2,   2,   2,  10,  27,
+    1,   0,  24,   4,   2,   7,   2,   2,   2,   5,   2,   2,   2,   4,   2,   3,
+    2,   3,   2,   4,   2,   2,   2,   4,   2,   3,   2,   3,   2,   2,   2,   5,
+    2,   2,   2,   2,   2,  10,  27,   1,   0,  24,   4,   3,   5,   3,   2,   2,
+    4,   3,   2,   2,   4,   2,   3,   2,   3,   2,   4,   2,   2,   2,   4,   2,
+    3,   2,   3,   2,   2,   3,   4,   2,   2,   2,   2,   2,   5,   2,   3,  27,
+    1,   0,  24,   5,   9,   4,   2,   2,   3,   3,   2,   4,   2,   3,   2,   3,
+    3,   2,   2,   3,   3,   2,   4,   2,   3,   2,   2,   2,   4,   1,   3,   3,
+    2,   3,   7,   4,  27,   1,   0,  24,   6,   7,   6,   5,   4,   2,   4,   2,
+    3,   2,   3,   6,   5,   5,   1,   2,   3,   3,   1,   2,   2,   2,   1,   4,
+    4,   2,   4,   5,   5,  27,   4,   0,  24,  44,   2,  55,  27,   3,   0,  24,
+  101,  27,   1,   0,  25,  99,  28,   1,   0, 152,
+};
+
+#endif  // Duet3DMono_h
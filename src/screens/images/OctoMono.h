@@ -1,346 +1,88 @@
-// Original source from: https://www.flaticon.com/free-icon/octopus_194298
-
-/*******************************************************************************
-* generated by lcd-image-converter rev.030b30d from 2019-03-17 01:38:34 +0500
-* image
-* filename: unsaved
-* name: OctoMono
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* split to rows: yes
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-#define OctoMono_Width  (152)
-#define OctoMono_Height (160)
-
-static const uint8_t OctoMono[3040] PROGMEM = {
-    // █████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████
-    // █████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████
-    // ████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████
-    // ██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████
-    // █████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████
-    // ████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████
-    // ██████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // ████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // ███████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // ███████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████∙███████████████████████████████∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙██████████████████████████∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙██████████████████████████∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ███████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // ████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // ████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // ███████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // ████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████
-    // ████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████
-    // ██████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████
-    // ████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████
-    // ███████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████
-    // ██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████
-    // █████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████
-    // ████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████
-    // ███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███
-    // ███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███
-    // ██∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██
-    // ██∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██
-    // ██∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙██
-    // █∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙████████████████████████████∙∙∙∙∙∙∙████████████████████████████████████████████████████████████∙∙∙∙∙∙∙████████████████████████████∙∙∙∙∙∙∙∙∙∙█
-    // █∙∙∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙∙∙█
-    // ██∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙██
-    // ██∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙██
-    // ██∙∙∙∙∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████∙∙█████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙∙∙∙∙∙██
-    // ███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███
-    // ███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███
-    // ████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████
-    // █████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████
-    // █████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████
-    // ██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████
-    // ████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████
-    // █████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████
-    // ███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████
-    // ██████████████∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙██████████████
-    // ███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████∙∙∙∙∙∙∙∙∙████████████████████████
-    // ███████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████
-    // ███████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████
-    // ███████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙█████████████████████████████████████
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 
-    0xff, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 
-    0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 
-    0xfc, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 
-    0xf8, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 
-    0xf0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0f, 
-    0xe0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 
-    0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 
-    0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 
-    0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 
-    0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 
-    0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x1f, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xf8, 0x01, 
-    0x80, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x01, 
-    0xc0, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x03, 
-    0xc0, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x03, 
-    0xc0, 0x01, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x80, 0x03, 
-    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 
-    0xff, 0xe0, 0x00, 0x07, 0x80, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xe0, 0x00, 0x07, 0xff, 
-    0xff, 0xfc, 0x03, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xc0, 0x3f, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x18, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x18, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x3c, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x7e, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x07, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xc0, 0x01, 0xff, 0x80, 0x03, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x07, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 
-    0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 
-    0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x3f, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xfc, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x03, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xc0, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff
-};
+/*
+ * OctoMono
+ *    Generated by tools/rle_bitmap.py from tools/images/OctoMono.h. Don't edit.
+ *    Original source from: https://www.flaticon.com/free-icon/octopus_194298
+ *
+ * NOTES:
+ * o 152x160 pixels, run-length encoded from 3040 to 1059 bytes. Draw it
+ *   with RLEBitmap::draw().
+ *
+ */
+
+#ifndef OctoMono_h
+#define OctoMono_h
+
+#define OctoMono_Width  (152)
+#define OctoMono_Height (160)
+
+static const uint8_t OctoMono_RLE[1059] PROGMEM = {
+    1,   0,  69,  14,  69,   1,   0,  65,  22,  65,   1,   0,  61,  30,  61,   1,
+    0,  58,  36,  58,   1,   0,  56,  40,  56,   1,   0,  54,  44,  54,   1,   0,
+   52,  48,  52,   1,   0,  50,  52,  50,   1,   0,  49,  54,  49,   1,   0,  48,
+   56,  48,   1,   0,  46,  23,  14,  23,  46,   1,   0,  45,  20,  22,  20,  45,
+    1,   0,  44,  18,  28,  18,  44,   1,   0,  43,  17,  32,  17,  43,   1,   0,
+   42,  16,  36,  16,  42,   1,   0,  41,  15,  40,  15,  41,   1,   0,  40,  14,
+   44,  14,  40,   1,   0,  39,  14,  46,  14,  39,   1,   0,  38,  14,  48,  14,
+   38,   1,   0,  37,  14,  50,  14,  37,   1,   0,  37,  12,  54,  12,  37,   1,
+    0,  36,  12,  56,  12,  36,   1,   0,  35,  13,  56,  13,  35,   1,   0,  35,
+   12,  58,  12,  35,   1,   0,  34,  12,  60,  12,  34,   1,   0,  34,  11,  62,
+   11,  34,   2,   0,  33,  11,  64,  11,  33,   2,   0,  32,  11,  66,  11,  32,
+    2,   0,  31,  11,  68,  11,  31,   1,   0,  31,  10,  70,  10,  31,   3,   0,
+   30,  10,  72,  10,  30,   1,   0,  29,  11,  72,  11,  29,   3,   0,  29,  10,
+   74,  10,  29,   7,   0,  28,  10,  76,  10,  28,   1,   0,  28,  10,  21,   1,
+   31,   2,  21,  10,  28,   1,   0,  28,  10,  18,   7,  26,   7,  18,  10,  28,
+    1,   0,  28,  10,  17,   9,  24,   9,  17,  10,  28,   1,   0,  28,  10,  16,
+   11,  22,  11,  16,  10,  28,   2,   0,  28,  10,  16,  12,  20,  12,  16,  10,
+   28,   2,   0,  28,  10,  15,  13,  20,  13,  15,  10,  28,   1,   0,  28,  10,
+   16,  12,  20,  12,  16,  10,  28,   1,   0,  28,  11,  15,  12,  20,  12,  15,
+   11,  28,   1,   0,  29,  10,  16,  10,  22,  11,  15,  10,  29,   1,   0,  29,
+   10,  16,   9,  24,   9,  16,  10,  29,   1,   0,  29,  10,  18,   6,  26,   6,
+   18,  10,  29,   3,   0,  30,  10,  72,  10,  30,   1,   0,  30,  11,  70,  11,
+   30,   1,   0,  31,  10,  70,  10,  31,   1,   0,  31,  11,  68,  11,  31,   1,
+    0,  32,  10,  68,  10,  32,   2,   0,  32,  11,  66,  11,  32,   1,   0,  33,
+   11,  64,  11,  33,   1,   0,  33,  12,  62,  12,  33,   1,   0,  34,  11,  62,
+   11,  34,   1,   0,  34,  12,  60,  12,  34,   1,   0,  35,  12,  58,  12,  35,
+    1,   0,  36,  11,  58,  11,  36,   1,   0,  36,  12,  56,  12,  36,   1,   0,
+   37,  11,  56,  11,  37,   2,   0,  38,  11,  54,  11,  38,   2,   0,  39,  10,
+   54,  10,  39,   7,   0,  40,  10,  52,  10,  40,   1,   0,  39,  10,  54,  10,
+   39,   1,   0,  38,  11,  54,  11,  38,   1,   0,  37,  12,  54,  12,  37,   1,
+    0,  35,  13,  55,  14,  35,   1,   0,  33,  15,  56,  15,  33,   1,   0,  31,
+   16,  58,  16,  31,   1,   0,  26,  21,  58,  21,  26,   1,   0,  16,  30,  60,
+   30,  16,   1,   0,  12,  33,  62,  33,  12,   1,   0,  10,  34,  64,  34,  10,
+    1,   0,   8,  35,  66,  35,   8,   1,   0,   7,  34,  70,  34,   7,   1,   0,
+    6,  33,  74,  33,   6,   1,   0,   5,  32,  78,  32,   5,   1,   0,   4,  31,
+   82,  31,   4,   1,   0,   3,  28,  90,  28,   3,   1,   0,   3,  22, 102,  22,
+    3,   1,   0,   2,  14, 120,  14,   2,   1,   0,   2,  12, 124,  12,   2,   1,
+    0,   2,  11, 126,  11,   2,   1,   0,   1,  11, 128,  11,   1,   5,   0,   1,
+   10, 130,  10,   1,   1,   0,   1,  10,  28,   7,  60,   7,  28,  10,   1,   1,
+    0,   1,  11,  24,  12,  56,  12,  24,  11,   1,   1,   0,   2,  10,  21,  16,
+   54,  16,  21,  10,   2,   1,   0,   2,  11,  16,  21,  52,  21,  16,  11,   2,
+    1,   0,   2,  13,   9,  26,  25,   2,  25,  26,   9,  13,   2,   1,   0,   3,
+   48,  21,   8,  21,  48,   3,   1,   0,   3,  48,  20,  10,  20,  48,   3,   1,
+    0,   4,  47,  18,  14,  18,  47,   4,   2,   0,   5,  46,  17,  16,  17,  46,
+    5,   1,   0,   6,  45,  16,  18,  16,  45,   6,   1,   0,   8,  42,  16,  20,
+   16,  42,   8,   1,   0,   9,  41,  15,  22,  15,  41,   9,   1,   0,  11,  18,
+    4,  16,  15,  24,  15,  16,   4,  18,  11,   1,   0,  14,   8,  10,  16,  16,
+   24,  16,  16,  10,   8,  14,   1,   0,  31,  16,  16,  12,   2,  12,  16,  16,
+   31,   1,   0,  29,  17,  16,  13,   2,  13,  16,  17,  29,   1,   0,  28,  16,
+   17,  13,   4,  13,  17,  16,  28,   1,   0,  27,  16,  18,  12,   6,  12,  18,
+   16,  27,   1,   0,  26,  16,  18,  12,   8,  12,  18,  16,  26,   1,   0,  26,
+   14,  19,  12,  10,  12,  19,  14,  26,   1,   0,  25,  14,  19,  13,  10,  13,
+   19,  14,  25,   1,   0,  25,  13,  20,  12,  12,  12,  20,  13,  25,   1,   0,
+   24,  12,  21,  12,  14,  12,  21,  12,  24,   1,   0,  24,  11,  21,  12,  16,
+   12,  21,  11,  24,   1,   0,  24,  10,  21,  13,  16,  13,  21,  10,  24,   1,
+    0,  24,  10,  20,  13,  18,  13,  20,  10,  24,   1,   0,  24,   9,  20,  13,
+   20,  13,  20,   9,  24,   1,   0,  23,  10,  19,  13,  22,  13,  19,  10,  23,
+    1,   0,  23,  10,  18,  13,  24,  13,  18,  10,  23,   1,   0,  23,  10,  17,
+   14,  24,  14,  17,  10,  23,   1,   0,  24,  10,  15,  14,  26,  14,  15,  10,
+   24,   1,   0,  24,  10,  13,  15,  28,  15,  13,  10,  24,   1,   0,  24,  11,
+   11,  15,  30,  15,  11,  11,  24,   1,   0,  24,  12,   8,  16,  32,  16,   8,
+   12,  24,   1,   0,  25,  13,   5,  16,  34,  16,   5,  13,  25,   1,   0,  25,
+   33,  36,  33,  25,   1,   0,  26,  31,  38,  31,  26,   1,   0,  26,  30,  40,
+   30,  26,   1,   0,  27,  27,  44,  27,  27,   1,   0,  28,  25,  46,  25,  28,
+    1,   0,  29,  22,  50,  22,  29,   1,   0,  30,  20,  52,  20,  30,   1,   0,
+   32,  16,  56,  16,  32,   1,   0,  34,  13,  58,  13,  34,   1,   0,  37,   7,
+   64,   7,  37,
+};
+
+#endif  // OctoMono_h
@@ -1,226 +1,49 @@
-
-/*******************************************************************************
-* generated by lcd-image-converter rev.030b30d from 2019-03-17 01:38:34 +0500
-* image
-* filename: unsaved
-* name: Reboot
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* split to rows: yes
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-
-#define RebootIcon_Width (100)
-#define RebootIcon_Height (100)
-
-static const uint8_t RebootIcon[1300] PROGMEM = {
-    // ∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙█████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙
-    // ∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙
-    // ∙∙∙∙████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙
-    // ∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████∙∙∙
-    // ∙∙████████████████████████████████████████████████████████████████████████████████████████████████∙∙
-    // ∙∙████████████████████████████████████████████████████████████████████████████████████████████████∙∙
-    // ∙██████████████████████████████████████████████████████████████████████████████████████████████████∙
-    // ∙██████████████████████████████████████████████████████████████████████████████████████████████████∙
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ██████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████
-    // ██████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████████████████████████∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████
-    // ████████████████████████████████████████████∙████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████
-    // ████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████
-    // ██████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████
-    // ███████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████
-    // █████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████████
-    // ████████████████████████∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████
-    // ███████████████████████∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████
-    // ███████████████████████∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████
-    // ██████████████████████∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████
-    // █████████████████████∙∙∙∙∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████
-    // █████████████████████∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████
-    // ███████████████████∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████
-    // ██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████
-    // ██████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙██████████████
-    // █████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // █████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // ████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ██████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // █████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // █████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙████████████
-    // ███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙█████████████
-    // ███████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙█████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████████∙∙∙∙∙∙∙∙∙██████████████
-    // ████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████
-    // █████████████████████∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙██████████████
-    // █████████████████████∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████
-    // █████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙███████████████
-    // ██████████████████████∙∙∙∙∙∙∙∙∙∙██████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████
-    // ██████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████
-    // ███████████████████████∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████
-    // ███████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙█████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙█████████████████
-    // ████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙██████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙███████████████████
-    // ██████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████
-    // ███████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████
-    // ████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████
-    // █████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████
-    // ██████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████
-    // ████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████
-    // █████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████
-    // ██████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████
-    // ████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████████████████████████████████
-    // ███████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████
-    // ██████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ∙██████████████████████████████████████████████████████████████████████████████████████████████████∙
-    // ∙██████████████████████████████████████████████████████████████████████████████████████████████████∙
-    // ∙∙████████████████████████████████████████████████████████████████████████████████████████████████∙∙
-    // ∙∙████████████████████████████████████████████████████████████████████████████████████████████████∙∙
-    // ∙∙∙██████████████████████████████████████████████████████████████████████████████████████████████∙∙∙
-    // ∙∙∙∙████████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙
-    // ∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙
-    // ∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙██████████████████████████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 
-    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0x80, 0x00, 0x07, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xf0, 
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xf0, 
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf0, 
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xf0, 
-    0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xf0, 
-    0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xf0, 
-    0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xf0, 
-    0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xf0, 
-    0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xf0, 
-    0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xf0, 
-    0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00
-};
+/*
+ * RebootBitmap
+ *    Generated by tools/rle_bitmap.py from tools/images/RebootBitmap.h. Don't edit.
+ *
+ * NOTES:
+ * o 100x100 pixels, run-length encoded from 1300 to 459 bytes. Draw it
+ *   with RLEBitmap::draw().
+ *
+ */
+
+#ifndef RebootBitmap_h
+#define RebootBitmap_h
+
+#define RebootIcon_Width  (100)
+#define RebootIcon_Height (100)
+
+static const uint8_t RebootIcon_RLE[459] PROGMEM = {
+    1,  10,  80,  10,   1,   8,  85,   7,   1,   5,  90,   5,   1,   4,  92,   4,
+    1,   3,  94,   3,   2,   2,  96,   2,   2,   1,  98,   1,   6,   0, 100,   1,
+    0,  47,  13,  40,   1,   0,  43,  20,  37,   1,   0,  41,  25,  34,   1,   0,
+   41,  28,  31,   1,   0,  42,  28,  30,   1,   0,  42,  30,  28,   1,   0,  43,
+   30,  27,   1,   0,  43,  32,  25,   1,   0,  43,  33,  24,   1,   0,  44,   5,
+    8,  20,  23,   1,   0,  44,   1,  16,  17,  22,   1,   0,  64,  15,  21,   1,
+    0,  66,  14,  20,   1,   0,  67,  14,  19,   1,   0,  69,  12,  19,   1,   0,
+   24,   1,  45,  12,  18,   1,   0,  23,   3,  45,  12,  17,   1,   0,  23,   3,
+   46,  11,  17,   1,   0,  22,   5,  46,  11,  16,   1,   0,  21,   7,  45,  11,
+   16,   1,   0,  21,   7,  46,  11,  15,   2,   0,  20,   9,  46,  10,  15,   1,
+    0,  19,  11,  46,  10,  14,   1,   0,  18,  13,  45,  10,  14,   1,   0,  18,
+   13,  46,   9,  14,   1,   0,  17,  15,  45,  10,  13,   1,   0,  17,  16,  44,
+   10,  13,   1,   0,  16,  17,  44,  10,  13,   2,   0,  15,  19,  44,   9,  13,
+    1,   0,  14,  21,  43,   9,  13,   2,   0,  13,  23,  42,   9,  13,   1,   0,
+   12,  25,  41,  10,  12,   2,   0,  11,  27,  40,   9,  13,   2,   0,  19,  10,
+   49,   9,  13,   1,   0,  19,  10,  48,  10,  13,   1,   0,  20,   9,  48,  10,
+   13,   1,   0,  20,  10,  47,  10,  13,   1,   0,  20,  10,  47,   9,  14,   1,
+    0,  20,  10,  46,  10,  14,   1,   0,  21,  10,  45,  10,  14,   1,   0,  21,
+   10,  44,  10,  15,   1,   0,  21,  11,  43,  10,  15,   1,   0,  22,  10,  42,
+   11,  15,   1,   0,  22,  11,  40,  11,  16,   1,   0,  23,  11,  39,  11,  16,
+    1,   0,  23,  12,  37,  11,  17,   1,   0,  24,  11,  36,  12,  17,   1,   0,
+   24,  12,  34,  12,  18,   1,   0,  25,  13,  31,  12,  19,   1,   0,  26,  13,
+   29,  13,  19,   1,   0,  27,  14,  25,  14,  20,   1,   0,  27,  15,  22,  15,
+   21,   1,   0,  28,  17,  17,  16,  22,   1,   0,  29,  19,  10,  19,  23,   1,
+    0,  30,  46,  24,   1,   0,  32,  43,  25,   1,   0,  33,  41,  26,   1,   0,
+   34,  38,  28,   1,   0,  36,  35,  29,   1,   0,  38,  31,  31,   1,   0,  40,
+   26,  34,   1,   0,  43,  21,  36,   1,   0,  46,  14,  40,   8,   0, 100,   2,
+    1,  98,   1,   2,   2,  96,   2,   1,   3,  94,   3,   1,   4,  92,   4,   1,
+    5,  90,   5,   1,   7,  86,   7,   1,   9,  82,   9,
+};
+
+#endif  // RebootBitmap_h
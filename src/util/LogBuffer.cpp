@@ -0,0 +1,152 @@
+/*
+ * LogBuffer
+ *    Keep the most recent log messages in RAM as compact binary records
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <atomic>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "LogBuffer.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace LogBuffer {
+  namespace Internal {
+    Record records[Capacity];
+    // The sequence number + 1 of the complete record in each slot, or 0
+    std::atomic<uint32_t> committed[Capacity];
+    std::atomic<uint32_t> next{0};    // The sequence number of the next record
+    std::atomic<uint32_t> first{0};   // Records before this have been cleared
+
+    char levelLetter(uint8_t level) {
+      // LOG_LEVEL_SILENT .. LOG_LEVEL_VERBOSE
+      static const char Letters[] = "?FEWNTV";
+      return Letters[min(level, (uint8_t)(sizeof(Letters) - 2))];
+    }
+
+    void format(const Record& r, String& out) {
+      char prefix[20];
+      snprintf(prefix, sizeof(prefix), "%lu.%03lu %c ",
+          (unsigned long)(r.millis / 1000), (unsigned long)(r.millis % 1000), levelLetter(r.level));
+      out += prefix;
+
+      uint8_t arg = 0;
+      PGM_P p = r.format;
+      for (char c = pgm_read_byte(p); c; c = pgm_read_byte(++p)) {
+        if (c != '%') { out += c; continue; }
+        c = pgm_read_byte(++p);
+        if (c == '\0') break;
+        if (c == '%') { out += c; continue; }
+        if (arg >= r.nArgs) { out += '?'; continue; }
+
+        uint32_t v = r.args[arg++];
+        switch (c) {
+          case 's': if (v < TextSize) out += &r.text[v]; break;
+          case 'S': out += reinterpret_cast<const __FlashStringHelper*>(v); break;
+          case 'c': out += (char)v; break;
+          case 'C':
+            if (v >= 0x20 && v < 0x7F) out += (char)v;
+            else { out += F("0x"); out += String(v, HEX); }
+            break;
+          case 'd':
+          case 'l': out += String((long)(int32_t)v); break;
+          case 'u': out += String(v); break;
+          case 'x': out += String(v, HEX); break;
+          case 'X': out += F("0x"); out += String(v, HEX); break;
+          case 'b': out += String(v, BIN); break;
+          case 'B': out += F("0b"); out += String(v, BIN); break;
+          case 't': out += v ? 'T' : 'F'; break;
+          case 'T': out += v ? F("true") : F("false"); break;
+          case 'D':
+          case 'F': {
+            float f;
+            memcpy(&f, &v, sizeof(f));
+            out += String(f, 2);
+            break;
+          }
+          default:    // Not a conversion ArduinoLog knows, so it takes no argument
+            out += '%'; out += c;
+            arg--;
+            break;
+        }
+      }
+      out += '\n';
+    }
+  } // ----- END: LogBuffer::Internal
+
+
+  /*----------------------------------------------------------------------------
+   *
+   * Writer
+   *
+   *--------------------------------------------------------------------------*/
+
+  Writer::Writer(uint8_t level, PGM_P format) :
+      _seq(Internal::next.fetch_add(1, std::memory_order_relaxed)),
+      _record(Internal::records[_seq % Capacity])
+  {
+    Internal::committed[_seq % Capacity].store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _record.millis = millis();
+    _record.format = format;
+    _record.level = level;
+    _record.nArgs = 0;
+  }
+
+  Writer::~Writer() {
+    Internal::committed[_seq % Capacity].store(_seq + 1, std::memory_order_release);
+  }
+
+  void Writer::addValue(uint32_t value) {
+    if (_record.nArgs < MaxArgs) _record.args[_record.nArgs++] = value;
+  }
+
+  void Writer::add(double value) {
+    float f = value;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    addValue(bits);
+  }
+
+  void Writer::add(const char* s) {
+    if (_textUsed == TextSize || s == nullptr) { addValue(TextSize); return; }
+    addValue(_textUsed);
+    size_t room = TextSize - _textUsed - 1;
+    size_t len = strnlen(s, room);
+    memcpy(&_record.text[_textUsed], s, len);
+    _record.text[_textUsed + len] = '\0';
+    _textUsed += len + 1;
+  }
+
+
+  /*----------------------------------------------------------------------------
+   *
+   * Reading
+   *
+   *--------------------------------------------------------------------------*/
+
+  void toText(String& out) {
+    using namespace Internal;
+    uint32_t end = next.load(std::memory_order_acquire);
+    uint32_t start = max(first.load(std::memory_order_relaxed), end > Capacity ? end - Capacity : 0);
+
+    for (uint32_t seq = start; seq != end; seq++) {
+      uint8_t slot = seq % Capacity;
+      // Copy the record, then make sure it wasn't being written meanwhile
+      if (committed[slot].load(std::memory_order_acquire) != seq + 1) continue;
+      Record r = records[slot];
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (committed[slot].load(std::memory_order_relaxed) != seq + 1) continue;
+      r.text[TextSize - 1] = '\0';
+      format(r, out);
+    }
+  }
+
+  void clear() {
+    Internal::first.store(Internal::next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+};
@@ -0,0 +1,93 @@
+/*
+ * LogBuffer
+ *    Keep the most recent log messages in RAM as compact binary records
+ *    that are only formatted when someone asks for them.
+ *
+ * NOTES:
+ * o A record holds the message's format pointer and its arguments rather
+ *   than the text, so adding one costs a few stores and no formatting.
+ *   Formats are string literals (usually F() strings) and are never copied.
+ * o String arguments can't be kept by pointer since they rarely outlive
+ *   the call, so they are copied into a small area in the record and
+ *   truncated if they don't fit. Flash strings (%S) are kept by pointer.
+ * o Formats use ArduinoLog's conversions (%s %S %c %C %d %l %u %x %X %b %B
+ *   %t %T %D %F). %p (Printable) isn't supported. Arguments beyond MaxArgs are
+ *   dropped.
+ * o Records may be added from either core. Each writer claims a slot with
+ *   an atomic increment, and a slot's sequence number is only set once its
+ *   record is complete, so a reader skips records that are being written.
+ * o Messages are normally added through the MM_LOG_ macros (see MMLog.h)
+ *   rather than directly.
+ *
+ */
+
+#ifndef LogBuffer_h
+#define LogBuffer_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <type_traits>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace LogBuffer {
+  static constexpr uint8_t Capacity = 40;
+  static constexpr uint8_t MaxArgs = 4;
+  static constexpr uint8_t TextSize = 36;
+
+  struct Record {
+    uint32_t  millis;
+    PGM_P     format;
+    uint32_t  args[MaxArgs];  // Values, or for %s the offset of the copy in text
+    char      text[TextSize]; // Copies of the string arguments, one after another
+    uint8_t   level;          // One of ArduinoLog's LOG_LEVEL_ values
+    uint8_t   nArgs;
+  };
+
+  // Fills in a record as the arguments are added and makes it visible to
+  // readers when it is destroyed
+  class Writer {
+  public:
+    Writer(uint8_t level, PGM_P format);
+    ~Writer();
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+    add(T value) { addValue((uint32_t)value); }
+    void add(double value);
+    void add(const char* s);
+    void add(const String& s) { add(s.c_str()); }
+    void add(const __FlashStringHelper* s) { addValue((uint32_t)(uintptr_t)s); }
+
+  private:
+    uint32_t  _seq;
+    Record&   _record;
+    uint8_t   _textUsed = 0;
+
+    void addValue(uint32_t value);
+  };
+
+  template<typename... Args>
+  void add(uint8_t level, PGM_P format, const Args&... args) {
+    Writer w(level, format);
+    int expand[] = {0, (w.add(args), 0)...};
+    (void)expand;
+  }
+
+  template<typename... Args>
+  void add(uint8_t level, const __FlashStringHelper* format, const Args&... args) {
+    add(level, reinterpret_cast<PGM_P>(format), args...);
+  }
+
+  // Appends the records, oldest first, one line each, in the form:
+  //   <seconds since boot> <level letter> <message>
+  void toText(String& out);
+
+  // Forget the records added so far
+  void clear();
+};
+
+#endif  // LogBuffer_h
@@ -0,0 +1,97 @@
+/*
+ * PerfStats
+ *    Lightweight timing of MultiMon's hot paths.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+#include "PerfStats.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace PerfStats {
+  namespace Internal {
+    static constexpr uint8_t N_Cases = static_cast<uint8_t>(Case::N_Cases);
+
+    // These are the keys used in the JSON output and in tools/perf_baselines.json
+    const char* const CaseNames[N_Cases] = {
+      "homeRender",
+      "detailRender",
+      "pluginRender",
+      "printerInfo",
+      "settingsToJSON",
+      "settingsFromJSON",
+      "configTemplate",
+      "pollCycle",
+      "hostLookup",
+      "spritePush",
+      "loopGap",
+      "tapResponse",
+      "pluginRefresh1",
+      "pluginRefresh2",
+      "pluginRefresh3",
+      "pluginRefresh4"
+    };
+
+    Stat stats[N_Cases];
+
+    static constexpr uint8_t N_Phases = static_cast<uint8_t>(BootPhase::N_Phases);
+    const char* const PhaseNames[N_Phases] = {
+      "screensRegistered",
+      "cachedHomeShown",
+      "webUIReady",
+      "clientsReady",
+      "printersActivated",
+      "firstLivePoll"
+    };
+
+    uint32_t bootMarks[N_Phases];
+  } // ----- END: PerfStats::Internal
+
+  void record(Case c, uint32_t elapsedMicros) {
+    Stat& s = Internal::stats[static_cast<uint8_t>(c)];
+    if (s.n == 0 || elapsedMicros < s.min) s.min = elapsedMicros;
+    if (elapsedMicros > s.max) s.max = elapsedMicros;
+    s.last = elapsedMicros;
+    s.total += elapsedMicros;
+    s.n++;
+  }
+
+  const Stat& get(Case c) { return Internal::stats[static_cast<uint8_t>(c)]; }
+
+  const char* name(Case c) { return Internal::CaseNames[static_cast<uint8_t>(c)]; }
+
+  void reset() {
+    memset(Internal::stats, 0, sizeof(Internal::stats));
+  }
+
+  void toJSON(JsonObject cases) {
+    for (uint8_t i = 0; i < Internal::N_Cases; i++) {
+      const Stat& s = Internal::stats[i];
+      if (s.n == 0) continue;
+      JsonObject entry = cases.createNestedObject(Internal::CaseNames[i]);
+      entry[F("n")] = s.n;
+      entry[F("min")] = s.min;
+      entry[F("max")] = s.max;
+      entry[F("last")] = s.last;
+      entry[F("mean")] = (uint32_t)(s.total / s.n);
+    }
+  }
+
+  void markBoot(BootPhase p) {
+    uint32_t& mark = Internal::bootMarks[static_cast<uint8_t>(p)];
+    if (mark == 0) mark = millis();
+  }
+
+  void bootToJSON(JsonObject phases) {
+    for (uint8_t i = 0; i < Internal::N_Phases; i++) {
+      if (Internal::bootMarks[i] != 0) phases[Internal::PhaseNames[i]] = Internal::bootMarks[i];
+    }
+  }
+};
+// ----- END: PerfStats
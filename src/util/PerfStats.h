@@ -0,0 +1,100 @@
+/*
+ * PerfStats
+ *    Lightweight timing of MultiMon's hot paths. Each named case accumulates
+ *    a sample count along with min/max/total elapsed time in microseconds.
+ *
+ * NOTES:
+ * o Cases are identified by a small enum rather than by strings so that
+ *   recording a sample is just a few integer operations.
+ * o The accumulated values are emitted as JSON (see toJSON) so that host
+ *   tools (tools/perfcheck.py) can compare them against stored baselines.
+ * o Boot phases are tracked separately. Each phase records the millis()
+ *   value at which it was first reached.
+ *
+ */
+
+#ifndef PerfStats_h
+#define PerfStats_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace PerfStats {
+  enum class Case : uint8_t {
+    HomeRender,       // HomeScreen::display
+    DetailRender,     // DetailScreen::display
+    PluginRender,     // Display of the first plugin's screen.json layout
+    PrinterInfo,      // Generation of the PRINTER_INFO JSON for the home page
+    SettingsToJSON,   // MMSettings::toJSON
+    SettingsFromJSON, // MMSettings::fromJSON
+    ConfigTemplate,   // Template expansion of ConfigPrinters.html
+    PollCycle,        // One complete refresh of the printer group
+    HostLookup,       // A DNS lookup of a printer's hostname (see CachedHost)
+    SpritePush,       // CPU time spent sending one sprite (see SpritePusher)
+    LoopGap,          // Time between calls to app_loop; bounds how long a tap can wait
+    TapResponse,      // From a screen's button handler being called to its return
+    PluginRefresh1,   // A refresh of the first plugin that made requests
+    PluginRefresh2,   //   ...of the second
+    PluginRefresh3,   //   ...of the third
+    PluginRefresh4,   //   ...of the fourth
+    N_Cases
+  };
+
+  // Plugins beyond this many aren't timed
+  static constexpr uint8_t MaxTimedPlugins = 4;
+  inline Case pluginRefresh(uint8_t index) {
+    return static_cast<Case>(static_cast<uint8_t>(Case::PluginRefresh1) + index);
+  }
+
+  enum class BootPhase : uint8_t {
+    ScreensRegistered,  // app_registerScreens has returned the first screen
+    CachedHomeShown,    // HomeScreen was rendered from the PrinterStateCache
+    WebUIReady,         // app_initWebUI has completed
+    ClientsReady,       // app_initClients has completed
+    PrintersActivated,  // All deferred printer activations have completed
+    FirstLivePoll,      // The first live refresh of printer data has completed
+    N_Phases
+  };
+
+  struct Stat {
+    uint32_t n;
+    uint32_t min;
+    uint32_t max;
+    uint32_t last;
+    uint64_t total;
+  };
+
+  void record(Case c, uint32_t elapsedMicros);
+  const Stat& get(Case c);
+  const char* name(Case c);
+  void reset();
+
+  // Adds one object per case with at least one sample to the supplied object.
+  // The object key is the case name, the values are n/min/max/last/mean.
+  void toJSON(JsonObject cases);
+
+  // Record the time at which a boot phase was reached. Only the first
+  // call for a given phase has any effect.
+  void markBoot(BootPhase p);
+
+  // Adds the millis() value of each boot phase that has been reached
+  void bootToJSON(JsonObject phases);
+
+  // Times the enclosing scope and records the result against a Case
+  class Scope {
+  public:
+    Scope(Case c) : _c(c), _start(micros()) { }
+    ~Scope() { record(_c, micros() - _start); }
+  private:
+    Case _c;
+    uint32_t _start;
+  };
+};
+
+#endif  // PerfStats_h
@@ -0,0 +1,125 @@
+/*
+ * QoiDecoder
+ *    Decode a QOI image as its bytes arrive
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "QoiDecoder.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Constants
+ *
+ *----------------------------------------------------------------------------*/
+
+static constexpr uint8_t HeaderLength = 14;
+static constexpr uint8_t OpRGB   = 0xFE;
+static constexpr uint8_t OpRGBA  = 0xFF;
+static constexpr uint8_t OpIndex = 0x00;  // The 2-bit ops are in the top bits
+static constexpr uint8_t OpDiff  = 0x40;
+static constexpr uint8_t OpLuma  = 0x80;
+static constexpr uint8_t OpRun   = 0xC0;
+static constexpr uint8_t Mask2   = 0xC0;
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+bool QoiDecoder::feed(const uint8_t* data, size_t len) {
+  while (len > 0 && !_failed) {
+    if (_headerRead && _remaining == 0) break;   // The end marker isn't needed
+
+    uint8_t needed = _headerRead ? chunkLength(_have ? _chunk[0] : *data) : HeaderLength;
+    size_t n = min((size_t)(needed - _have), len);
+    memcpy(&_chunk[_have], data, n);
+    _have += n;
+    data += n;
+    len -= n;
+    if (_have < needed) break;
+
+    _have = 0;
+    if (!_headerRead) { _failed = !readHeader(); }
+    else decodeChunk();
+  }
+  return !_failed;
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+uint8_t QoiDecoder::chunkLength(uint8_t tag) {
+  if (tag == OpRGB) return 4;
+  if (tag == OpRGBA) return 5;
+  return ((tag & Mask2) == OpLuma) ? 2 : 1;
+}
+
+bool QoiDecoder::readHeader() {
+  auto be32 = [this](int i) -> uint32_t {
+    return ((uint32_t)_chunk[i] << 24) | ((uint32_t)_chunk[i+1] << 16) |
+           ((uint32_t)_chunk[i+2] << 8) | _chunk[i+3];
+  };
+
+  if (memcmp(_chunk, "qoif", 4) != 0) return false;
+  uint32_t width = be32(4);
+  uint32_t height = be32(8);
+  if (width == 0 || height == 0 || width > MaxDimension || height > MaxDimension) return false;
+
+  memset(_index, 0, sizeof(_index));
+  _px = {0, 0, 0, 255};
+  _remaining = width * height;
+  _headerRead = true;
+  return _sink.begin(width, height);
+}
+
+void QoiDecoder::decodeChunk() {
+  uint8_t tag = _chunk[0];
+
+  if (tag == OpRGB) {
+    _px.r = _chunk[1]; _px.g = _chunk[2]; _px.b = _chunk[3];
+  } else if (tag == OpRGBA) {
+    _px.r = _chunk[1]; _px.g = _chunk[2]; _px.b = _chunk[3]; _px.a = _chunk[4];
+  } else switch (tag & Mask2) {
+    case OpIndex:
+      _px = _index[tag];
+      break;
+    case OpDiff:
+      _px.r += ((tag >> 4) & 0x03) - 2;
+      _px.g += ((tag >> 2) & 0x03) - 2;
+      _px.b += (tag & 0x03) - 2;
+      break;
+    case OpLuma: {
+      int8_t dg = (tag & 0x3F) - 32;
+      _px.r += dg - 8 + ((_chunk[1] >> 4) & 0x0F);
+      _px.g += dg;
+      _px.b += dg - 8 + (_chunk[1] & 0x0F);
+      break;
+    }
+    case OpRun:
+      // The index is unchanged; the pixel is already in it
+      emit((tag & 0x3F) + 1);
+      return;
+  }
+
+  _index[(_px.r * 3 + _px.g * 5 + _px.b * 7 + _px.a * 11) % 64] = _px;
+  emit(1);
+}
+
+void QoiDecoder::emit(uint32_t count) {
+  if (count > _remaining) count = _remaining;   // A run past the end is ignored
+  _remaining -= count;
+  while (count--) _sink.pixel(_px.r, _px.g, _px.b, _px.a);
+}
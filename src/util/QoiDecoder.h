@@ -0,0 +1,69 @@
+/*
+ * QoiDecoder
+ *    Decode a QOI ("Quite OK Image") image as its bytes arrive, handing
+ *    each pixel to a Sink as it is decoded.
+ *
+ * NOTES:
+ * o The input may be fed in pieces of any size, including a byte at a time.
+ *   Apart from the 64 entry color index that QOI requires, the decoder
+ *   holds at most one partial chunk, so it needs about 280 bytes no matter
+ *   how large the image is.
+ * o Pixels are delivered in order, left to right and top to bottom. The
+ *   Sink decides what to keep; the image is never held in memory here.
+ * o See https://qoiformat.org/qoi-specification.pdf
+ *
+ */
+
+#ifndef QoiDecoder_h
+#define QoiDecoder_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class QoiDecoder {
+public:
+  class Sink {
+  public:
+    virtual ~Sink() { }
+    // Called once the header has been read. Return false to reject the image.
+    virtual bool begin(uint16_t width, uint16_t height) = 0;
+    virtual void pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a) = 0;
+  };
+
+  // Images larger than this in either dimension are rejected
+  static constexpr uint16_t MaxDimension = 1024;
+
+  QoiDecoder(Sink& sink) : _sink(sink) { }
+
+  // Decode the next len bytes. Returns false once the input is found to be
+  // invalid or the sink rejects the image; everything after that is ignored.
+  bool feed(const uint8_t* data, size_t len);
+
+  // Have all of the image's pixels been decoded?
+  bool done() const { return _remaining == 0 && _headerRead; }
+  bool failed() const { return _failed; }
+
+private:
+  struct Pixel { uint8_t r, g, b, a; };
+
+  Sink&    _sink;
+  Pixel    _index[64];
+  Pixel    _px;
+  uint32_t _remaining = 0;    // Pixels not yet decoded
+  uint8_t  _chunk[14];        // A partial chunk, or the header
+  uint8_t  _have = 0;         // Bytes in _chunk
+  bool     _headerRead = false;
+  bool     _failed = false;
+
+  bool readHeader();
+  void decodeChunk();
+  void emit(uint32_t count);
+  static uint8_t chunkLength(uint8_t tag);
+};
+
+#endif  // QoiDecoder_h
@@ -0,0 +1,137 @@
+/*
+ * RequestScheduler
+ *    Decide when the app's sources of network requests may issue them
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "RequestScheduler.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Public Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+int8_t RequestScheduler::addSource(const char* name, Class c, uint32_t budget, bool periodic) {
+  if (nSources == MaxSources) {
+    MM_LOG_ERROR(F("RequestScheduler: no room for source %s"), name);
+    return -1;
+  }
+
+  Source& s = sources[nSources];
+  s = {};
+  s.name = name;
+  s.cls = c;
+  s.budget = budget;
+  s.periodic = periodic;
+  if (periodic) s.rank = nPeriodic++;
+  // Due as soon as it is first checked
+  s.period = s.duePeriod = UINT32_MAX;
+  return nSources++;
+}
+
+bool RequestScheduler::due(int8_t id, uint32_t interval) {
+  Source& s = sources[id];
+  if (interval == 0) return true;
+  s.duePeriod = (millis() - phase(s, interval)) / interval;
+  return s.duePeriod != s.period;
+}
+
+bool RequestScheduler::acquire(int8_t id, bool urgent) {
+  rollWindow();
+  Source& s = sources[id];
+
+  bool overBudget = !urgent && s.budget != 0 && s.used >= s.budget;
+  if (overBudget || _passRequests >= _maxPerPass || outranked(s)) {
+    if (overBudget) s.overBudget++;
+    else s.deferred++;
+    if (!isQueued(s)) { s.waiting = true; s.waitStart = millis(); }
+    s.lastRefused = millis();
+    uint8_t depth = queueDepth();
+    if (depth > _maxQueueDepth) _maxQueueDepth = depth;
+    return false;
+  }
+
+  if (isQueued(s)) {
+    uint32_t waited = millis() - s.waitStart;
+    if (waited > s.maxWait) s.maxWait = waited;
+  }
+  s.waiting = false;
+  if (s.periodic) s.period = s.duePeriod;
+  _passRequests++;
+  s.requests++;
+  s.start = micros();
+  return true;
+}
+
+void RequestScheduler::release(int8_t id) {
+  Source& s = sources[id];
+  uint32_t elapsed = micros() - s.start;
+  s.totalMicros += elapsed;
+  if (elapsed > s.maxMicros) s.maxMicros = elapsed;
+  s.used += elapsed / 1000;
+}
+
+void RequestScheduler::toJSON(JsonObject json) const {
+  json[F("queueDepth")] = queueDepth();
+  json[F("maxQueueDepth")] = _maxQueueDepth;
+  JsonObject all = json.createNestedObject(F("sources"));
+  for (int i = 0; i < nSources; i++) {
+    const Source& s = sources[i];
+    JsonObject entry = all.createNestedObject(s.name);
+    entry[F("class")] = (int)s.cls;
+    entry[F("requests")] = s.requests;
+    entry[F("mean")] = s.requests ? (uint32_t)(s.totalMicros / s.requests) : 0;
+    entry[F("max")] = s.maxMicros;
+    entry[F("budget")] = s.budget;
+    entry[F("used")] = s.used;
+    entry[F("deferred")] = s.deferred;
+    entry[F("overBudget")] = s.overBudget;
+    entry[F("maxWait")] = s.maxWait;
+  }
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Private Methods
+ *
+ *----------------------------------------------------------------------------*/
+
+uint32_t RequestScheduler::phase(const Source& s, uint32_t interval) const {
+  return nPeriodic ? (uint32_t)((uint64_t)interval * s.rank / nPeriodic) : 0;
+}
+
+bool RequestScheduler::isQueued(const Source& s) const {
+  return s.waiting && (millis() - s.lastRefused) <= QueueTimeout;
+}
+
+bool RequestScheduler::outranked(const Source& s) const {
+  // Sources that are waiting only for their budget don't hold others back
+  for (int i = 0; i < nSources; i++) {
+    const Source& other = sources[i];
+    if (!isQueued(other) || other.cls >= s.cls) continue;
+    if (other.budget == 0 || other.used < other.budget) return true;
+  }
+  return false;
+}
+
+uint8_t RequestScheduler::queueDepth() const {
+  uint8_t depth = 0;
+  for (int i = 0; i < nSources; i++) { if (isQueued(sources[i])) depth++; }
+  return depth;
+}
+
+void RequestScheduler::rollWindow() {
+  if (millis() - _windowStart < BudgetWindow) return;
+  _windowStart = millis();
+  for (int i = 0; i < nSources; i++) sources[i].used = 0;
+}
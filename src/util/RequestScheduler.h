@@ -0,0 +1,118 @@
+/*
+ * RequestScheduler
+ *    Decide when the app's sources of network requests may issue them, so
+ *    that blocking requests don't pile up in a single pass of the loop.
+ *
+ * NOTES:
+ * o Requests are blocking, so "concurrency" is the number of requests that
+ *   may start in one pass of the task scheduler that runs the sources (see
+ *   beginPass()). The default of one means that a printer refresh and a
+ *   host lookup never stall the same pass.
+ * o Each source has a class. A source is held back while a source of a
+ *   higher class is waiting for its turn.
+ * o A source may have a budget: the milliseconds it may spend blocked in
+ *   requests per BudgetWindow. Once that is used up, its requests wait for
+ *   the next window unless they are urgent.
+ * o Periodic sources are spread across their interval: each is given its
+ *   own phase within the interval rather than all coming due together.
+ * o Sources that have been refused and have asked again within QueueTimeout
+ *   form the queue. A source that stops asking drops out of it. The queue's
+ *   depth and the statistics of each source are available as JSON (see /perf).
+ * o All sources must be run from the same task. Weather and plugin
+ *   refreshes are made by the WebThing loop and are not covered.
+ *
+ */
+
+#ifndef RequestScheduler_h
+#define RequestScheduler_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class RequestScheduler {
+public:
+  static constexpr uint8_t  MaxSources = 6;
+  static constexpr uint32_t BudgetWindow = 60 * 1000L;   // millis
+  static constexpr uint32_t QueueTimeout = 2000;          // millis
+
+  // Highest priority first
+  enum class Class : uint8_t { Printer, Lookup, Background };
+
+  RequestScheduler(uint8_t maxPerPass = 1) : _maxPerPass(maxPerPass) { }
+
+  // Add a source. budget is in milliseconds per BudgetWindow (0 means no
+  // limit). Periodic sources are spread across their interval; see due().
+  // Returns the source's id, or -1 if there is no room.
+  int8_t addSource(const char* name, Class c, uint32_t budget, bool periodic = false);
+
+  // Call at the start of each pass of the task scheduler that runs the sources
+  void beginPass() { _passRequests = 0; }
+
+  // Has a new period begun for a periodic source? Each source's periods are
+  // offset by its phase. Stays true until the source is granted a request.
+  bool due(int8_t id, uint32_t interval);
+
+  // May the source issue a request now? If so, it must call release() when
+  // the request is done. Urgent requests ignore the source's budget.
+  bool acquire(int8_t id, bool urgent = false);
+  void release(int8_t id);
+
+  void toJSON(JsonObject json) const;
+
+  // Acquires on construction and releases on destruction if granted
+  class Request {
+  public:
+    Request(RequestScheduler& s, int8_t id, bool urgent = false) :
+        _s(s), _id(id), _granted(s.acquire(id, urgent)) { }
+    ~Request() { if (_granted) _s.release(_id); }
+    explicit operator bool() const { return _granted; }
+  private:
+    RequestScheduler& _s;
+    int8_t _id;
+    bool   _granted;
+  };
+
+private:
+  struct Source {
+    const char* name;
+    Class       cls;
+    bool        periodic;
+    uint8_t     rank;         // Among the periodic sources; sets the phase
+    bool        waiting;
+    uint32_t    budget;
+    uint32_t    used;         // millis in the current window
+    uint32_t    period;       // The last period granted a request
+    uint32_t    duePeriod;    // The period found by the last call to due()
+    uint32_t    waitStart;
+    uint32_t    lastRefused;
+    uint32_t    maxWait;      // millis
+    uint32_t    requests;
+    uint32_t    deferred;     // Refused for another source or the pass limit
+    uint32_t    overBudget;   // Refused for its budget
+    uint64_t    totalMicros;
+    uint32_t    maxMicros;
+    uint32_t    start;
+  };
+
+  Source   sources[MaxSources];
+  uint8_t  nSources = 0;
+  uint8_t  nPeriodic = 0;
+  uint8_t  _maxPerPass;
+  uint8_t  _passRequests = 0;
+  uint8_t  _maxQueueDepth = 0;
+  uint32_t _windowStart = 0;
+
+  uint32_t phase(const Source& s, uint32_t interval) const;
+  bool     isQueued(const Source& s) const;
+  bool     outranked(const Source& s) const;
+  uint8_t  queueDepth() const;
+  void     rollWindow();
+};
+
+#endif  // RequestScheduler_h
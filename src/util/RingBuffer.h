@@ -0,0 +1,50 @@
+/*
+ * RingBuffer
+ *    A fixed-capacity FIFO that overwrites its oldest element when full.
+ *
+ * NOTES:
+ * o Storage is allocated inline, so the memory footprint is fixed at
+ *   compile time: N * sizeof(T) plus two bytes.
+ * o Elements are indexed from oldest (0) to newest (size()-1).
+ *
+ */
+
+#ifndef RingBuffer_h
+#define RingBuffer_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdint.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+template<typename T, uint8_t N>
+class RingBuffer {
+public:
+  static constexpr uint8_t Capacity = N;
+
+  void clear() { _head = 0; _count = 0; }
+
+  void push(const T& item) {
+    _items[_head] = item;
+    _head = (_head + 1) % N;
+    if (_count < N) _count++;
+  }
+
+  uint8_t size() const { return _count; }
+  bool isEmpty() const { return _count == 0; }
+  bool isFull() const { return _count == N; }
+
+  const T& operator[](uint8_t i) const { return _items[(_head + N - _count + i) % N]; }
+  const T& oldest() const { return (*this)[0]; }
+  const T& newest() const { return (*this)[_count - 1]; }
+
+private:
+  T       _items[N];
+  uint8_t _head = 0;
+  uint8_t _count = 0;
+};
+
+#endif  // RingBuffer_h
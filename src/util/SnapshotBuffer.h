@@ -0,0 +1,71 @@
+/*
+ * SnapshotBuffer
+ *    Hand the latest value of a T from one thread (the producer) to another
+ *    (the consumer) without locks and without either side ever waiting.
+ *
+ * NOTES:
+ * o This is a double buffer with a spare: besides the slot the producer is
+ *   filling and the slot the consumer is reading, a third slot holds the
+ *   most recently published value. Publishing and acquiring are a single
+ *   atomic exchange of that slot's index, so the producer can publish as
+ *   often as it likes while the consumer holds a value, and nothing the
+ *   consumer holds is ever written.
+ * o Values that are published faster than they are consumed are dropped;
+ *   the consumer only ever sees the newest one.
+ * o The slot returned by back() holds an older value (or a default one).
+ *   The producer must fill in every field before calling publish().
+ * o Only std::atomic is used, so the same code can be exercised on a host
+ *   with std::thread.
+ *
+ */
+
+#ifndef SnapshotBuffer_h
+#define SnapshotBuffer_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdint.h>
+#include <atomic>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+template<typename T>
+class SnapshotBuffer {
+public:
+  // ----- Producer
+
+  // The slot to fill before calling publish()
+  T& back() { return _slots[_back]; }
+
+  // Make the contents of back() the latest value
+  void publish() {
+    _back = _latest.exchange(_back | Fresh, std::memory_order_acq_rel) & IndexMask;
+  }
+
+  // ----- Consumer
+
+  // Take the latest published value if there is one that hasn't been taken.
+  // Returns true if current() changed.
+  bool update() {
+    if ((_latest.load(std::memory_order_acquire) & Fresh) == 0) return false;
+    _front = _latest.exchange(_front, std::memory_order_acq_rel) & IndexMask;
+    return true;
+  }
+
+  // The value taken by the last call to update(). It doesn't change until
+  // the next call to update().
+  const T& current() const { return _slots[_front]; }
+
+private:
+  static constexpr uint8_t IndexMask = 0x03;
+  static constexpr uint8_t Fresh = 0x04;
+
+  T       _slots[3];
+  uint8_t _back = 0;                  // Owned by the producer
+  uint8_t _front = 1;                 // Owned by the consumer
+  std::atomic<uint8_t> _latest{2};    // Shared. Fresh until the consumer takes it
+};
+
+#endif  // SnapshotBuffer_h
@@ -0,0 +1,71 @@
+/*
+ * TaskScheduler
+ *    A cooperative scheduler for the app's periodic work.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+#include "../../MMLog.h"
+#include "TaskScheduler.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+bool TaskScheduler::add(
+    const char* name, Priority priority, uint32_t interval, uint32_t budget, TaskFn fn)
+{
+  if (nTasks == MaxTasks) {
+    MM_LOG_ERROR(F("TaskScheduler: no room for task %s"), name);
+    return false;
+  }
+
+  // Keep the tasks ordered by priority. Tasks of equal priority run in the
+  // order in which they were added.
+  int pos = nTasks;
+  while (pos > 0 && tasks[pos-1].priority > priority) { tasks[pos] = tasks[pos-1]; pos--; }
+  tasks[pos] = {name, priority, interval, budget, fn, millis(), 0, 0, 0, 0, 0};
+  nTasks++;
+  return true;
+}
+
+void TaskScheduler::runDue(uint32_t loopBudget) {
+  uint32_t loopStart = micros();
+
+  for (int i = 0; i < nTasks; i++) {
+    Task& t = tasks[i];
+    uint32_t now = millis();
+    if ((int32_t)(now - t.nextRun) < 0) continue;
+
+    if (t.priority != Priority::High && (micros() - loopStart) >= loopBudget) {
+      t.deferred++;
+      continue;
+    }
+
+    if (t.interval != 0 && (now - t.nextRun) > t.interval) t.late++;
+
+    uint32_t start = micros();
+    bool moreWork = t.fn();
+    uint32_t elapsed = micros() - start;
+
+    t.runs++;
+    if (elapsed > t.budget) t.overruns++;
+    if (elapsed > t.maxMicros) t.maxMicros = elapsed;
+    t.nextRun = moreWork ? millis() : millis() + t.interval;
+  }
+}
+
+void TaskScheduler::toJSON(JsonObject json) const {
+  for (int i = 0; i < nTasks; i++) {
+    const Task& t = tasks[i];
+    JsonObject entry = json.createNestedObject(t.name);
+    entry[F("runs")] = t.runs;
+    entry[F("budget")] = t.budget;
+    entry[F("max")] = t.maxMicros;
+    entry[F("overruns")] = t.overruns;
+    entry[F("late")] = t.late;
+    entry[F("deferred")] = t.deferred;
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * TaskScheduler
+ *    A cooperative scheduler for the app's periodic work.
+ *
+ * NOTES:
+ * o Each task has a priority, an interval, and a time budget. Every call to
+ *   runDue() runs the tasks that are due, highest priority first.
+ * o Once the loop budget passed to runDue() is used up, lower priority
+ *   tasks wait for the next call. High priority tasks always run.
+ * o A task that has more work to do returns true. It is run again on the
+ *   next call rather than waiting for its interval. Long jobs are written
+ *   as a series of short steps this way.
+ * o Tasks that exceed their budget, or start more than one interval late,
+ *   are counted. The counts are available as JSON (see /perf).
+ * o The scheduler only covers work owned by the app. The WebThing loop
+ *   (web requests, the GUI, plugins) runs outside it.
+ *
+ */
+
+#ifndef TaskScheduler_h
+#define TaskScheduler_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <functional>
+//                                  Third Party Libraries
+#include <ArduinoJson.h>
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+class TaskScheduler {
+public:
+  static constexpr uint8_t MaxTasks = 8;
+
+  enum class Priority : uint8_t { High, Normal, Low };
+
+  // Returns true if the task has more work to do right away
+  using TaskFn = std::function<bool()>;
+
+  // Add a task. interval is in milliseconds (0 means every call to runDue),
+  // budget is in microseconds. Returns false if there is no room.
+  bool add(const char* name, Priority priority, uint32_t interval, uint32_t budget, TaskFn fn);
+
+  // Run the tasks that are due, within the given budget (microseconds)
+  void runDue(uint32_t loopBudget);
+
+  // Adds one object per task with its statistics
+  void toJSON(JsonObject tasks) const;
+
+private:
+  struct Task {
+    const char* name;
+    Priority    priority;
+    uint32_t    interval;
+    uint32_t    budget;
+    TaskFn      fn;
+    uint32_t    nextRun;
+    uint32_t    runs;
+    uint32_t    overruns;   // Took longer than its budget
+    uint32_t    late;       // Started more than one interval after it was due
+    uint32_t    deferred;   // Was due, but the loop budget was used up
+    uint32_t    maxMicros;
+  };
+
+  Task    tasks[MaxTasks];
+  uint8_t nTasks = 0;
+};
+
+#endif  // TaskScheduler_h
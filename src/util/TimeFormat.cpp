@@ -0,0 +1,31 @@
+/*
+ * TimeFormat
+ *    Small helpers for formatting times consistently across screens
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <TimeLib.h>
+//                                  Third Party Libraries
+//                                  WebThing Includes
+#include <WTApp.h>
+//                                  Local Includes
+#include "TimeFormat.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace TimeFormat {
+  void appendDayAndTime(time_t theTime, String& target) {
+    bool use24Hour = wtApp->settings->uiOptions.use24Hour;
+    target += dayShortStr(weekday(theTime));
+    target += ' ';
+    target += use24Hour ? hour(theTime) : hourFormat12(theTime);
+    target += ':';
+    int theMinute = minute(theTime);
+    if (theMinute < 10) target += '0';
+    target += theMinute;
+    if (!use24Hour) target += isAM(theTime) ? "AM" : "PM";
+  }
+}  // ----- END: TimeFormat
@@ -0,0 +1,25 @@
+/*
+ * TimeFormat
+ *    Small helpers for formatting times consistently across screens
+ *
+ */
+
+#ifndef TimeFormat_h
+#define TimeFormat_h
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <Arduino.h>
+#include <TimeLib.h>
+//                                  Third Party Libraries
+//                                  Local Includes
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace TimeFormat {
+  // Append the short day name and the time, e.g. "Tue 4:05PM", honoring
+  // the user's 12/24 hour preference
+  void appendDayAndTime(time_t theTime, String& target);
+}  // ----- END: TimeFormat
+
+#endif  // TimeFormat_h
@@ -0,0 +1,94 @@
+/*
+ * CompletionQueueTest
+ *    Check that CompletionQueue keeps printers in order of completion
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <initializer_list>
+#include <Arduino.h>
+#include <TimeLib.h>
+//                                  WebThing Includes
+#include <WTApp.h>
+//                                  Local Includes
+#include "CompletionQueue.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+WTApp* wtApp;
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  // Are the printers queued in exactly this order?
+  bool queued(std::initializer_list<uint8_t> expected) {
+    const CompletionQueue::Entry* entries[CompletionQueue::MaxPrinters];
+    uint8_t n = CompletionQueue::next(entries, CompletionQueue::MaxPrinters);
+    if (n != expected.size() || CompletionQueue::size() != n) return false;
+    uint8_t k = 0;
+    for (uint8_t i : expected) { if (entries[k++]->index != i) return false; }
+    return true;
+  }
+
+  void testOrder() {
+    const time_t Start = 1760868000;    // Sun Oct 19 2025 10:00:00 UTC
+    setTime(Start);
+
+    check(queued({}), "starts empty");
+    CompletionQueue::update(0, Start + 3600);
+    CompletionQueue::update(1, Start + 1800);
+    CompletionQueue::update(2, Start + 5400);
+    CompletionQueue::update(3, Start + 1800);
+    check(queued({1, 3, 0, 2}), "soonest first; ties in the order they arrived");
+
+    CompletionQueue::update(0, Start + 600);
+    check(queued({0, 1, 3, 2}), "a printer moves when its time changes");
+    CompletionQueue::update(2, Start + 1800);
+    check(queued({0, 1, 3, 2}), "to after any it ties with");
+    CompletionQueue::update(1, Start + 1800);
+    check(queued({0, 1, 3, 2}), "an unchanged time doesn't move it");
+
+    CompletionQueue::remove(1);
+    check(queued({0, 3, 2}), "remove()");
+    CompletionQueue::remove(1);
+    check(queued({0, 3, 2}), "removing a printer that isn't queued");
+    CompletionQueue::update(CompletionQueue::MaxPrinters, Start);
+    check(queued({0, 3, 2}), "printers out of range are ignored");
+
+    const CompletionQueue::Entry* first[2];
+    check(CompletionQueue::next(first, 2) == 2 && first[0]->index == 0 && first[1]->index == 3,
+          "next() provides at most maxEntries");
+
+    HostClock::advanceMillis(100 * 1000);
+    check(first[0]->remaining() == 500, "remaining() counts down");
+    wtApp->settings->uiOptions.use24Hour = false;
+    check(first[0]->formatted() == "Sun 10:10AM", "formatted() in 12 hour time");
+    wtApp->settings->uiOptions.use24Hour = true;
+    check(first[0]->formatted() == "Sun 10:10", "formatted() follows the 12/24 hour preference");
+
+    for (uint8_t i = 0; i < CompletionQueue::MaxPrinters; i++) CompletionQueue::remove(i);
+    check(queued({}), "empty once every printer is removed");
+  }
+};
+
+
+int main() {
+  WTAppSettings settings;
+  WTApp app;
+  app.settings = &settings;
+  wtApp = &app;
+
+  Internal::testOrder();
+
+  if (Internal::failures) return 1;
+  printf("CompletionQueue: passed\n");
+  return 0;
+}
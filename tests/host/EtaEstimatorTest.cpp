@@ -0,0 +1,93 @@
+/*
+ * EtaEstimatorTest
+ *    Check EtaEstimator's blend of the server's estimate and the progress
+ *    it has observed
+ *
+ * NOTES:
+ * o The simulated prints advance 2% a minute and take 50 minutes. Ten
+ *   minutes in, the estimator's window covers enough progress for an even
+ *   blend. Samples arrive every 10 seconds, as they would with the default
+ *   refresh interval.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+//                                  Local Includes
+#include "EtaEstimator.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  constexpr uint32_t Refresh = 10;        // Seconds between samples
+  constexpr uint32_t SecondsPerPct = 30;
+
+  bool near(uint32_t value, uint32_t expected, uint32_t tolerance) {
+    return value + tolerance >= expected && value <= expected + tolerance;
+  }
+
+  // Sample a print that has run from `from` to `to` seconds. The server
+  // reports serverTimeLeft (adjusted by drift per second elapsed).
+  void run(EtaEstimator& eta, uint32_t from, uint32_t to, uint32_t serverTimeLeft, int32_t drift = 0) {
+    for (uint32_t t = from; t <= to; t += Refresh) {
+      int32_t reported = (int32_t)serverTimeLeft + drift * (int32_t)(t - from);
+      eta.addSample(t, (float)t / SecondsPerPct, reported > 0 ? reported : 0);
+    }
+  }
+
+  void testEstimates() {
+    uint32_t left = 0;
+    EtaEstimator eta;
+    check(!eta.timeLeft(0, left), "no estimate without samples");
+
+    // Too few samples to fit a line: the server's estimate, aged
+    eta.addSample(0, 0, 6000);
+    check(eta.timeLeft(25, left) && left == 5975, "the server's estimate ages");
+
+    // An accurate server: the blend agrees with it
+    eta.reset();
+    run(eta, 0, 600, 3000, -1);
+    check(eta.timeLeft(600, left) && near(left, 2400, 15), "an accurate server's estimate is kept");
+
+    // A pessimistic server: blended halfway toward what's observed
+    eta.reset();
+    run(eta, 0, 600, 5400, -1);
+    check(eta.timeLeft(600, left) && near(left, (4800 + 2400) / 2, 15), "a wrong estimate is blended evenly");
+
+    // A server that doesn't estimate: what's observed, not a blend with 0
+    eta.reset();
+    run(eta, 0, 600, 0);
+    check(eta.timeLeft(600, left) && near(left, 2400, 15), "without a server estimate, the observed one");
+    check(eta.timeLeft(900, left) && near(left, 2100, 15), "the observed estimate counts down");
+
+    // Stalled (e.g. paused): the server's estimate
+    eta.reset();
+    for (uint32_t t = 0; t <= 300; t += Refresh) eta.addSample(t, 5, 3000);
+    check(eta.timeLeft(300, left) && left == 3000, "a stalled print uses the server's estimate");
+
+    // A new job: progress drops and the old samples are forgotten
+    eta.reset();
+    run(eta, 0, 600, 0);
+    eta.addSample(610, 0.5f, 7200);
+    check(eta.timeLeft(610, left) && left == 7200, "a new job starts over");
+  }
+};
+
+
+int main() {
+  Internal::testEstimates();
+
+  if (Internal::failures) return 1;
+  printf("EtaEstimator: passed\n");
+  return 0;
+}
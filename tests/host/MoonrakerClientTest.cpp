@@ -0,0 +1,165 @@
+/*
+ * MoonrakerClientTest
+ *    Run MoonrakerClient against the messages tools/moonraker_stub.py sends
+ *
+ * NOTES:
+ * o The messages are laid out as the stub's json.dumps() lays them out, and
+ *   carry the same fields. The subscription's response holds the full value
+ *   of every field; each notify_status_update holds only those that changed.
+ * o Moonraker also sends notifications that weren't asked for, so one of
+ *   those is delivered along the way and must be ignored.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <WebSocketsClient.h>
+//                                  Local Includes
+#include "MoonrakerClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  PrinterSnapshot snap(const MoonrakerClient& client) {
+    PrinterSnapshot s;
+    client.capture(s);
+    return s;
+  }
+
+  // The id of the subscription request most recently sent, or 0
+  long lastSubscribeId(const WebSocketsClient& ws) {
+    if (ws.sent.empty()) return 0;
+    const String& msg = ws.sent.back();
+    if (msg.indexOf("\"printer.objects.subscribe\"") < 0) return 0;
+    int id = msg.lastIndexOf(':');
+    return msg.substring(id + 1).toInt();
+  }
+
+  void subscribed(WebSocketsClient& ws, const char* state, const char* filename, float target) {
+    char msg[512];
+    snprintf(msg, sizeof(msg),
+      "{\"jsonrpc\": \"2.0\", \"id\": %ld, \"result\": {\"eventtime\": 1760868900.125, \"status\": {"
+        "\"print_stats\": {\"state\": \"%s\", \"filename\": \"%s\", \"print_duration\": 0.0}, "
+        "\"display_status\": {\"progress\": 0.0}, "
+        "\"heater_bed\": {\"temperature\": 59.87, \"target\": %.1f}, "
+        "\"extruder\": {\"temperature\": 214.72, \"target\": %.1f}}}}",
+      lastSubscribeId(ws), state, filename, target ? 60.0 : 0.0, target);
+    ws.receive(WStype_TEXT, msg);
+  }
+
+  void testPrint() {
+    PrinterSettings ps;
+    ps.server = "klipper";
+    ps.apiKey = "secret";
+    MoonrakerClient client;
+    client.begin(ps);
+
+    WebSocketsClient* ws = WebSocketsClient::latest();
+    check(ws && ws->host == "klipper" && ws->port == MoonrakerClient::DefaultPort && ws->url == "/websocket",
+          "connects to the websocket");
+    if (!ws) return;
+    check(ws->extraHeaders == "X-Api-Key: secret", "sends the API key");
+
+    // ----- Connect and subscribe
+    ws->receive(WStype_CONNECTED);
+    check(lastSubscribeId(*ws) != 0, "subscribes once connected");
+    check(!client.hasRefreshed(), "not refreshed until the subscription is answered");
+    subscribed(*ws, "standby", "", 0);
+    check(client.hasRefreshed(), "refreshed by the subscription");
+    check(snap(client).state == PrintClient::State::Operational, "a printer on standby is Operational");
+
+    // ----- A print starts
+    ws->receive(WStype_TEXT,
+      "{\"jsonrpc\": \"2.0\", \"method\": \"notify_status_update\", \"params\": [{"
+        "\"print_stats\": {\"state\": \"printing\", \"filename\": \"stub_part.gcode\", \"print_duration\": 12.5}, "
+        "\"display_status\": {\"progress\": 0.104}, "
+        "\"heater_bed\": {\"temperature\": 60.12, \"target\": 60.0}, "
+        "\"extruder\": {\"temperature\": 215.31, \"target\": 215.0}}, 1760868901.25]}");
+    PrinterSnapshot s = snap(client);
+    check(s.state == PrintClient::State::Printing, "a printing printer is Printing");
+    check(strcmp(s.filename, "stub_part.gcode") == 0, "the file name is merged");
+    check(fabsf(s.pct - 10.4f) < 0.01f, "the progress is merged");
+    check(s.elapsed == 12, "the print duration is merged");
+    check(fabsf(s.bedTarget - 60) < 0.01f && fabsf(s.toolTarget - 215) < 0.01f, "the targets are merged");
+
+    // ----- Notifications that weren't asked for are ignored
+    client.takeChange();
+    ws->receive(WStype_TEXT,
+      "{\"jsonrpc\": \"2.0\", \"method\": \"notify_proc_stat_update\", \"params\": [{"
+        "\"moonraker_stats\": {\"time\": 1760868901.5, \"cpu_usage\": 2.17, \"memory\": 41232, \"mem_units\": \"kB\"}, "
+        "\"cpu_temp\": 48.3, \"network\": {\"lo\": {\"rx_bytes\": 2275391, \"tx_bytes\": 2275391, \"bandwidth\": 3441.2}, "
+        "\"wlan0\": {\"rx_bytes\": 15731229, \"tx_bytes\": 4031988, \"bandwidth\": 1822.7}}, "
+        "\"system_cpu_usage\": {\"cpu\": 12.5, \"cpu0\": 14.1, \"cpu1\": 9.8, \"cpu2\": 13.0, \"cpu3\": 12.9}, "
+        "\"websocket_connections\": 2}]}");
+    check(client.takeChange() == SnapshotClient::Change::None, "other notifications change nothing");
+
+    // ----- Only the fields that changed are sent
+    ws->receive(WStype_TEXT,
+      "{\"jsonrpc\": \"2.0\", \"method\": \"notify_status_update\", \"params\": [{"
+        "\"print_stats\": {\"print_duration\": 60.0}, \"display_status\": {\"progress\": 0.5}, "
+        "\"heater_bed\": {\"temperature\": 59.91}}, 1760868950.0]}");
+    s = snap(client);
+    check(fabsf(s.pct - 50) < 0.01f && s.elapsed == 60, "partial updates are merged");
+    check(strcmp(s.filename, "stub_part.gcode") == 0 && fabsf(s.toolTarget - 215) < 0.01f,
+          "fields that weren't sent are kept");
+    check(s.timeLeft == 60, "the time left is extrapolated from the progress");
+    check(client.takeChange() == SnapshotClient::Change::Progress, "progress is reported");
+    ws->receive(WStype_TEXT,
+      "{\"jsonrpc\": \"2.0\", \"method\": \"notify_status_update\", \"params\": [{"
+        "\"heater_bed\": {\"temperature\": 60.22}, \"extruder\": {\"temperature\": 215.08}}, 1760868950.25]}");
+    check(client.takeChange() == SnapshotClient::Change::None, "small temperature changes aren't reported");
+
+    // ----- The print finishes
+    ws->receive(WStype_TEXT,
+      "{\"jsonrpc\": \"2.0\", \"method\": \"notify_status_update\", \"params\": [{"
+        "\"print_stats\": {\"state\": \"complete\", \"print_duration\": 120.0}, \"display_status\": {\"progress\": 0.0}, "
+        "\"heater_bed\": {\"target\": 0.0}, \"extruder\": {\"target\": 0.0}}, 1760869010.0]}");
+    s = snap(client);
+    check(s.state == PrintClient::State::Complete && s.pct == 100, "a finished print is Complete");
+    client.acknowledgeCompletion();
+    check(snap(client).state == PrintClient::State::Operational, "acknowledging a completion");
+
+    // ----- Klipper restarts
+    ws->receive(WStype_TEXT, "{\"jsonrpc\": \"2.0\", \"method\": \"notify_klippy_shutdown\"}");
+    check(snap(client).state == PrintClient::State::Offline, "a printer without Klipper is Offline");
+    size_t sent = ws->sent.size();
+    ws->receive(WStype_TEXT, "{\"jsonrpc\": \"2.0\", \"method\": \"notify_klippy_ready\"}");
+    check(ws->sent.size() == sent + 1 && lastSubscribeId(*ws) != 0, "subscribes again once Klipper is ready");
+    char error[160];
+    snprintf(error, sizeof(error),
+      "{\"jsonrpc\": \"2.0\", \"id\": %ld, \"error\": {\"code\": 503, \"message\": \"Klippy Disconnected\"}}",
+      lastSubscribeId(*ws));
+    ws->receive(WStype_TEXT, error);
+    check(snap(client).state == PrintClient::State::Offline, "a failed subscription leaves the printer Offline");
+    long failedId = lastSubscribeId(*ws);
+    client.refresh();
+    check(lastSubscribeId(*ws) > failedId, "a failed subscription is retried on refresh");
+    subscribed(*ws, "printing", "second_part.gcode", 215);
+    s = snap(client);
+    check(s.state == PrintClient::State::Printing && strcmp(s.filename, "second_part.gcode") == 0,
+          "the subscription's response is merged");
+
+    // ----- Moonraker goes away
+    ws->receive(WStype_DISCONNECTED);
+    check(snap(client).state == PrintClient::State::Offline, "a disconnected printer is Offline");
+  }
+};
+
+
+int main() {
+  Internal::testPrint();
+
+  if (Internal::failures) return 1;
+  printf("MoonrakerClient: passed\n");
+  return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * OctoPrintClientTest
+ *    Run OctoPrintClient against canned OctoPrint REST API responses
+ *
+ * NOTES:
+ * o The responses are those of OctoPrint 1.9 with a single extruder. The
+ *   client excludes the sd and history sub-trees of /api/printer, so the
+ *   fake server honors exclude= as OctoPrint does. Everything else the
+ *   filters throw away is still read, so both the filters and the
+ *   documents they fill are exercised at the sizes used on the device.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <HTTPClient.h>
+//                                  Local Includes
+#include "OctoPrintClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  const char* const ApiKey = "0123456789ABCDEF0123456789ABCDEF";
+
+  // The parts of OctoPrint's state that the responses are built from
+  struct FakeOctoPrint {
+    bool connected = true;      // To the printer
+    bool printing = false;
+    const char* fileName = "benchy.gcode";
+    float completion = 0;
+    uint32_t printTime = 0;
+    int32_t printTimeLeft = -1; // null
+    float bedActual = 21.4, bedTarget = 0;
+    float toolActual = 22.9, toolTarget = 0;
+
+    uint32_t printerRequests = 0, jobRequests = 0;
+    uint32_t bytes = 0;         // Sent since the last call to takeBytes()
+
+    String printer(bool excludeSd, bool excludeHistory) const {
+      char buf[2048];
+      snprintf(buf, sizeof(buf),
+        "{%s\"state\": {\"error\": \"\", \"flags\": {\"cancelling\": false, \"closedOrError\": false, "
+          "\"error\": false, \"finishing\": false, \"operational\": true, \"paused\": false, \"pausing\": false, "
+          "\"printing\": %s, \"ready\": %s, \"resuming\": false, \"sdReady\": true}, \"text\": \"%s\"}, "
+        "\"temperature\": {\"bed\": {\"actual\": %.1f, \"offset\": 0, \"target\": %.1f}, "
+          "\"chamber\": {\"actual\": null, \"offset\": 0, \"target\": null}, "
+          "\"tool0\": {\"actual\": %.1f, \"offset\": 0, \"target\": %.1f}%s}}",
+        excludeSd ? "" : "\"sd\": {\"ready\": true}, ",
+        printing ? "true" : "false", printing ? "false" : "true", printing ? "Printing" : "Operational",
+        bedActual, bedTarget, toolActual, toolTarget,
+        excludeHistory ? "" :
+          ", \"history\": [{\"bed\": {\"actual\": 21.4, \"target\": 0}, \"time\": 1760868900, "
+          "\"tool0\": {\"actual\": 22.9, \"target\": 0}}]");
+      return String(buf);
+    }
+
+    String job() const {
+      char timeLeft[16];
+      if (printTimeLeft < 0) strcpy(timeLeft, "null");
+      else snprintf(timeLeft, sizeof(timeLeft), "%d", printTimeLeft);
+      char buf[2048];
+      snprintf(buf, sizeof(buf),
+        "{\"job\": {\"averagePrintTime\": 5390.2, \"estimatedPrintTime\": 5432.1, "
+          "\"filament\": {\"tool0\": {\"length\": 4120.3, \"volume\": 9.91}}, "
+          "\"file\": {\"date\": 1760812931, \"display\": \"%s\", \"name\": \"%s\", \"origin\": \"local\", "
+          "\"path\": \"%s\", \"size\": 2456012}, \"lastPrintTime\": 5511.7, \"user\": \"pi\"}, "
+        "\"progress\": {\"completion\": %.4f, \"filepos\": %u, \"printTime\": %u, \"printTimeLeft\": %s, "
+          "\"printTimeLeftOrigin\": \"estimate\"}, "
+        "\"state\": \"%s\"}",
+        fileName, fileName, fileName, completion, (uint32_t)(completion * 24560), printTime, timeLeft,
+        printing ? "Printing" : "Operational");
+      return String(buf);
+    }
+
+    HTTPClient::Response respond(const HTTPClient::Request& r) {
+      const String* key = r.header("X-Api-Key");
+      if (r.method != "GET" || !key || *key != ApiKey) return {403, ""};
+
+      HTTPClient::Response response = {404, ""};
+      if (r.uri.startsWith("/api/printer")) {
+        printerRequests++;
+        if (!connected) response = {409, "Printer is not operational"};
+        else response = {200, printer(r.uri.indexOf("sd") > 0, r.uri.indexOf("history") > 0)};
+      } else if (r.uri == "/api/job") {
+        jobRequests++;
+        response = {200, job()};
+      }
+      bytes += response.body.length();
+      return response;
+    }
+
+    uint32_t takeBytes() { uint32_t b = bytes; bytes = 0; return b; }
+  };
+
+  PrinterSnapshot snap(const OctoPrintClient& client) {
+    PrinterSnapshot s;
+    client.capture(s);
+    return s;
+  }
+
+  void testPrint() {
+    FakeOctoPrint octo;
+    String lastUri;
+    HTTPClient::handler() = [&octo, &lastUri](const HTTPClient::Request& r) {
+      lastUri = r.uri;
+      return octo.respond(r);
+    };
+
+    PrinterSettings ps;
+    ps.server = "octopi";
+    ps.apiKey = ApiKey;
+    OctoPrintClient client;
+    client.begin(ps);
+    check(!client.hasRefreshed(), "not refreshed until the first refresh");
+
+    // ----- Idle: only /api/printer, without the sd and history sub-trees
+    client.refresh();
+    check(lastUri == "/api/printer?exclude=sd,history", "excludes what isn't shown");
+    check(octo.jobRequests == 0, "the job isn't asked about while idle");
+    check(client.hasRefreshed() && snap(client).state == PrintClient::State::Operational,
+          "an idle printer is Operational");
+    check(client.lastRefreshBytes() == octo.takeBytes(), "the bytes received are counted");
+    check(octo.printer(true, true).length() < octo.printer(false, false).length(),
+          "the excluded sub-trees make the response smaller");
+    check(client.takeChange() == SnapshotClient::Change::State, "coming online is a change of state");
+
+    // ----- A print starts
+    octo.printing = true;
+    octo.completion = 12.5f;
+    octo.printTime = 690;
+    octo.printTimeLeft = 4062;
+    octo.bedActual = 59.9f; octo.bedTarget = 60;
+    octo.toolActual = 214.8f; octo.toolTarget = 215;
+    client.refresh();
+    PrinterSnapshot s = snap(client);
+    check(s.state == PrintClient::State::Printing, "a printing printer is Printing");
+    check(strcmp(s.filename, "benchy.gcode") == 0, "the file name is read");
+    check(fabsf(s.pct - 12.5f) < 0.01f && s.elapsed == 690 && s.timeLeft == 4062, "the progress is read");
+    check(fabsf(s.bedTarget - 60) < 0.01f && fabsf(s.toolActual - 214.8f) < 0.01f, "the temperatures are read");
+    check(octo.jobRequests == 1, "the job is asked about while printing");
+    check(client.lastRefreshBytes() == octo.takeBytes(), "both responses are counted");
+    check(client.takeChange() == SnapshotClient::Change::State, "starting a print is a change of state");
+
+    // OctoPrint doesn't estimate the time left at first
+    octo.printTimeLeft = -1;
+    client.refresh();
+    check(snap(client).timeLeft == 0, "a null estimate is 0");
+    check(client.takeChange() == SnapshotClient::Change::Progress, "progress is reported");
+
+    // ----- The print finishes
+    octo.printing = false;
+    octo.completion = 100;
+    client.refresh();
+    check(octo.jobRequests == 3, "the job is asked about once more when it ends");
+    check(snap(client).state == PrintClient::State::Complete, "a finished print is Complete");
+    client.refresh();
+    check(octo.jobRequests == 3, "then no more");
+    check(snap(client).state == PrintClient::State::Complete, "Complete until acknowledged");
+    client.acknowledgeCompletion();
+    check(snap(client).state == PrintClient::State::Operational, "acknowledging a completion");
+
+    // ----- A cancelled print isn't Complete
+    octo.printing = true;
+    octo.completion = 40;
+    client.refresh();
+    octo.printing = false;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Operational, "a cancelled print isn't Complete");
+
+    // ----- OctoPrint loses the printer, then goes away
+    octo.connected = false;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Offline, "a printer OctoPrint can't reach is Offline");
+    octo.connected = true;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Operational, "and back");
+
+    HTTPClient::handler() = nullptr;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Offline, "an unreachable server is Offline");
+    check(client.lastRefreshBytes() == 0, "nothing is counted without a response");
+
+    // ----- A wrong API key
+    HTTPClient::handler() = [&octo](const HTTPClient::Request& r) { return octo.respond(r); };
+    ps.apiKey = "wrong";
+    client.begin(ps);
+    client.refresh();
+    check(client.hasRefreshed() && snap(client).state == PrintClient::State::Offline,
+          "a refused request leaves the printer Offline");
+    HTTPClient::handler() = nullptr;
+  }
+};
+
+
+int main() {
+  Internal::testPrint();
+
+  if (Internal::failures) return 1;
+  printf("OctoPrintClient: passed\n");
+  return 0;
+}
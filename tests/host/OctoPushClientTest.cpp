@@ -0,0 +1,127 @@
+/*
+ * OctoPushClientTest
+ *    Run OctoPushClient against the messages OctoPrint's push API sends
+ *
+ * NOTES:
+ * o The "current" messages are those of OctoPrint 1.9 with logs and
+ *   messages unsubscribed, as the client asks. They are far larger than
+ *   what the client keeps, so the filter and the document it fills are
+ *   exercised at the sizes used on the device.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WebSocketsClient.h>
+//                                  Local Includes
+#include "OctoPushClient.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  // The callbacks made since the last call to take()
+  struct Callbacks {
+    int urgent = 0, progress = 0;
+    void take(int& u, int& p) { u = urgent; p = progress; urgent = progress = 0; }
+  };
+
+  void current(WebSocketsClient& ws, const char* text, bool printing, float completion) {
+    char msg[2048];
+    snprintf(msg, sizeof(msg),
+      "{\"current\": {\"state\": {\"text\": \"%s\", \"flags\": {\"operational\": true, \"printing\": %s, "
+        "\"cancelling\": false, \"pausing\": false, \"resuming\": false, \"finishing\": false, "
+        "\"closedOrError\": false, \"error\": false, \"paused\": false, \"ready\": %s, \"sdReady\": false}, "
+        "\"error\": \"\"}, "
+        "\"job\": {\"file\": {\"name\": \"benchy.gcode\", \"path\": \"benchy.gcode\", \"display\": \"benchy.gcode\", "
+        "\"origin\": \"local\", \"size\": 2456012, \"date\": 1760812931}, \"estimatedPrintTime\": 5432.1, "
+        "\"averagePrintTime\": null, \"lastPrintTime\": null, \"filament\": {\"tool0\": {\"length\": 4120.3, "
+        "\"volume\": 9.91}}, \"user\": \"pi\"}, "
+        "\"progress\": {\"completion\": %.4f, \"filepos\": 614003, \"printTime\": 1380, \"printTimeLeft\": 4062, "
+        "\"printTimeLeftOrigin\": \"estimate\"}, "
+        "\"currentZ\": 4.2, \"offsets\": {}, \"resends\": {\"count\": 0, \"transmitted\": 41982, \"ratio\": 0}, "
+        "\"temps\": [{\"time\": 1760868901, \"tool0\": {\"actual\": 214.8, \"target\": 215.0}, "
+        "\"bed\": {\"actual\": 59.9, \"target\": 60.0}, \"chamber\": {\"actual\": null, \"target\": null}}], "
+        "\"busyFiles\": [{\"origin\": \"local\", \"path\": \"benchy.gcode\"}], \"markings\": [], "
+        "\"serverTime\": 1760868901.7}}",
+      text, printing ? "true" : "false", printing ? "false" : "true", completion);
+    ws.receive(WStype_TEXT, msg);
+  }
+
+  void testPush() {
+    HTTPClient::handler() = [](const HTTPClient::Request& r) -> HTTPClient::Response {
+      const String* key = r.header("X-Api-Key");
+      if (r.uri != "/api/login" || r.method != "POST" || !key || *key != "octo-key") return {403, ""};
+      return {200,
+        "{\"_is_external_client\": false, \"_login_mechanism\": \"apikey\", \"active\": true, "
+        "\"admin\": true, \"apikey\": null, \"groups\": [\"admins\", \"users\"], \"name\": \"pi\", "
+        "\"needs\": {\"group\": [\"admins\", \"users\"], \"role\": [\"admin\", \"control\", \"status\"]}, "
+        "\"permissions\": [], \"roles\": [\"admin\", \"user\"], \"session\": \"c5a0e7f9d6\", \"settings\": {}, "
+        "\"user\": true}"};
+    };
+
+    Callbacks calls;
+    OctoPushClient client;
+    client.begin("octopi", 80, "octo-key", [&calls](bool urgent) { (urgent ? calls.urgent : calls.progress)++; });
+    WebSocketsClient* ws = WebSocketsClient::latest();
+    check(ws && ws->url == "/sockjs/websocket", "connects to the push API");
+    if (!ws) return;
+
+    int urgent, progress;
+    ws->receive(WStype_CONNECTED);
+    check(client.isConnected(), "logs in once connected");
+    check(!ws->sent.empty() && ws->sent[0] == "{\"auth\":\"pi:c5a0e7f9d6\"}", "authenticates with the session");
+    calls.take(urgent, progress);
+    check(urgent == 1, "asks for a refresh once connected");
+
+    // ----- The first message only sets the baseline
+    current(*ws, "Printing", true, 12.5f);
+    calls.take(urgent, progress);
+    check(urgent == 0 && progress == 0, "the first message is a baseline");
+
+    current(*ws, "Printing", true, 12.9f);
+    calls.take(urgent, progress);
+    check(urgent == 0 && progress == 0, "no callback without a change");
+    current(*ws, "Printing", true, 13.1f);
+    calls.take(urgent, progress);
+    check(urgent == 0 && progress == 1, "progress is reported");
+
+    // ----- Events
+    ws->receive(WStype_TEXT,
+      "{\"event\": {\"type\": \"PrintDone\", \"payload\": {\"name\": \"benchy.gcode\", \"path\": \"benchy.gcode\", "
+      "\"origin\": \"local\", \"size\": 2456012, \"owner\": \"pi\", \"user\": \"pi\", \"time\": 5511.73}}}");
+    calls.take(urgent, progress);
+    check(urgent == 1, "a state event is urgent");
+    ws->receive(WStype_TEXT,
+      "{\"event\": {\"type\": \"ZChange\", \"payload\": {\"new\": 4.4, \"old\": 4.2}}}");
+    calls.take(urgent, progress);
+    check(urgent == 0 && progress == 0, "other events are ignored");
+
+    current(*ws, "Operational", false, 100.0f);
+    calls.take(urgent, progress);
+    check(urgent == 1, "a change of state is urgent");
+
+    ws->receive(WStype_DISCONNECTED);
+    check(!client.isConnected(), "disconnects");
+    HTTPClient::handler() = nullptr;
+  }
+};
+
+
+int main() {
+  Internal::testPush();
+
+  if (Internal::failures) return 1;
+  printf("OctoPushClient: passed\n");
+  return 0;
+}
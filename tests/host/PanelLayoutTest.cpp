@@ -0,0 +1,156 @@
+/*
+ * PanelLayoutTest
+ *    Paint the areas the HomeScreen and DetailScreen draw for each supported
+ *    panel and check that each is on the panel and that none overlap
+ *
+ * NOTES:
+ * o The areas come from PanelAreas, which the screens use too, so this
+ *   checks the positions the screens actually draw at. Both panels are
+ *   instantiated here regardless of the panel the mocks are built for.
+ * o Each pixel of the canvas records which area painted it. Adjacent
+ *   progress bars share their frames, so a slot may overlap its neighbor
+ *   by exactly PB_FrameSize and no more.
+ * o The HomeScreen is painted for each number of printers it lays out, and
+ *   the DetailScreen with and without a thumbnail.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+//                                  Local Includes
+#include "PanelLayout.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  constexpr uint8_t MaxBars = 4;
+
+  // A panel on which each pixel holds the id of the area that painted it
+  class Canvas {
+  public:
+    static constexpr uint8_t Empty = 0xFF;
+
+    Canvas(uint16_t w, uint16_t h) : _w(w), _h(h), _owner(w*h, Empty) { }
+
+    // Returns false if the area is off the panel or overlaps another area.
+    // Pixels of the areas in `shared` may be painted over.
+    bool paint(uint8_t id, int x, int y, int w, int h, const std::vector<uint8_t>& shared = {}) {
+      if (w <= 0 || h <= 0 || x < 0 || y < 0 || x + w > _w || y + h > _h) return false;
+      bool ok = true;
+      for (int row = y; row < y + h; row++) {
+        for (int col = x; col < x + w; col++) {
+          uint8_t& owner = _owner[row * _w + col];
+          if (owner != Empty && std::find(shared.begin(), shared.end(), owner) == shared.end()) ok = false;
+          owner = id;
+        }
+      }
+      return ok;
+    }
+
+  private:
+    uint16_t _w, _h;
+    std::vector<uint8_t> _owner;
+  };
+
+  template<uint16_t W, uint16_t H>
+  void testHome(const char* panel) {
+    using L = typename PanelLayout<W, H>::Home;
+    using A = typename PanelAreas<W, H>::Home;
+    enum : uint8_t { Weather, NextCompletion, Clock, Slot0 };
+    char what[80];
+
+    for (uint8_t nBars = 1; nBars <= MaxBars; nBars++) {
+      Canvas c(W, H);
+      snprintf(what, sizeof(what), "%s: the weather is on the panel", panel);
+      check(c.paint(Weather, 0, A::WeatherYOrigin, W, A::WeatherHeight), what);
+      snprintf(what, sizeof(what), "%s: the next completion is clear of the weather", panel);
+      check(c.paint(NextCompletion, 0, A::NCYOrigin, W, A::NCHeight), what);
+      snprintf(what, sizeof(what), "%s: the clock is clear of the areas above it", panel);
+      check(c.paint(Clock, 0, A::ClockSpriteYOrigin, W, L::ClockFontHeight), what);
+
+      snprintf(what, sizeof(what), "%s, %d printers: bars are at least MinBarWidth", panel, nBars);
+      check(A::barWidth(nBars) >= L::MinBarWidth, what);
+      for (uint8_t slot = 0; slot < nBars; slot++) {
+        std::vector<uint8_t> shared;
+        if (slot) shared.push_back(Slot0 + slot - 1);
+        int x = A::barX(slot, nBars);
+        snprintf(what, sizeof(what), "%s, %d printers: slot %d is on the panel and clear", panel, nBars, slot);
+        check(c.paint(Slot0 + slot, x, A::SlotYOrigin, A::barWidth(nBars), A::SlotHeight, shared), what);
+        if (slot) {
+          // Only the shared frame is painted twice
+          snprintf(what, sizeof(what), "%s, %d printers: slot %d shares one frame", panel, nBars, slot);
+          check(A::barX(slot-1, nBars) + A::barWidth(nBars) - x == A::PB_FrameSize, what);
+        }
+      }
+      // Rounding leaves at most a few pixels of the width unused
+      int right = A::barX(nBars-1, nBars) + A::barWidth(nBars);
+      snprintf(what, sizeof(what), "%s, %d printers: the bars fill the width", panel, nBars);
+      check(right <= W && W - right < nBars, what);
+    }
+
+    for (uint8_t digit = 0; digit <= 4; digit++) {
+      snprintf(what, sizeof(what), "%s: clock digit %d is on the panel", panel, digit);
+      check(L::clockX(digit) + L::ClockDigitWidth <= W, what);
+    }
+  }
+
+  template<uint16_t W, uint16_t H>
+  void testDetail(const char* panel) {
+    using L = typename PanelLayout<W, H>::Detail;
+    using A = typename PanelAreas<W, H>::Detail;
+    enum : uint8_t { Thumbnail, Title, FileName, Progress, Time, Details };
+    char what[80];
+
+    for (bool hasThumbnail : {false, true}) {
+      Canvas c(W, H);
+      const char* variant = hasThumbnail ? "with a thumbnail" : "without a thumbnail";
+      uint16_t nameX = 0;
+      if (hasThumbnail) {
+        snprintf(what, sizeof(what), "%s: the thumbnail is on the panel", panel);
+        check(c.paint(Thumbnail, 0, 0, L::ThumbSize, L::ThumbSize), what);
+        nameX = L::ThumbSize + A::ThumbXMargin;
+      }
+      snprintf(what, sizeof(what), "%s %s: the title is clear", panel, variant);
+      check(c.paint(Title, nameX, A::TitleAreaYOrigin, W - nameX, A::TitleAreaHeight), what);
+      snprintf(what, sizeof(what), "%s %s: the file name is clear", panel, variant);
+      check(c.paint(FileName, nameX, A::FileNameYOrigin, W - nameX, L::FileNameFontHeight), what);
+      snprintf(what, sizeof(what), "%s %s: the progress bar is clear", panel, variant);
+      check(c.paint(Progress, A::ProgressXOrigin, L::ProgressYOrigin, A::ProgressWidth, L::ProgressHeight), what);
+      snprintf(what, sizeof(what), "%s %s: the time is clear", panel, variant);
+      check(c.paint(Time, A::TimeXOrigin, A::TimeYOrigin, L::TimeWidth, L::TimeHeight), what);
+      snprintf(what, sizeof(what), "%s %s: the details are clear", panel, variant);
+      check(c.paint(Details, 0, A::DetailYOrigin, W, A::DetailHeight), what);
+    }
+
+    // The button that scrolls the file name covers the title and the file name
+    snprintf(what, sizeof(what), "%s: the file name button covers the title and file name", panel);
+    check(L::FileNameAreaHeight >= A::FileNameYOrigin + L::FileNameFontHeight &&
+          L::FileNameAreaHeight <= L::ProgressYOrigin, what);
+    snprintf(what, sizeof(what), "%s: the time is centered", panel);
+    check(A::TimeXOrigin * 2 + L::TimeWidth == W, what);
+  }
+};
+
+
+int main() {
+  Internal::testHome<320, 240>("320x240");
+  Internal::testDetail<320, 240>("320x240");
+  Internal::testHome<480, 320>("480x320");
+  Internal::testDetail<480, 320>("480x320");
+
+  if (Internal::failures) return 1;
+  printf("PanelLayout: passed\n");
+  return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * PrintHistoryTest
+ *    Check that PrintHistory's delta encoding and compaction keep the
+ *    samples a viewer decodes
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <vector>
+//                                  Local Includes
+#include "PrintHistory.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  std::vector<PrintHistory::Sample> decode(const PrintHistory& h) {
+    std::vector<PrintHistory::Sample> samples;
+    if (h.size() == 0) return samples;
+    samples.push_back(h.first());
+    for (uint16_t i = 1; i < h.size(); i++) samples.push_back(h.next(samples.back(), i));
+    return samples;
+  }
+
+  void testRecord() {
+    PrintHistory h;
+    const uint32_t Interval = PrintHistory::BaseSampleInterval;
+    check(h.record(0, 20, 25, 0), "the first sample is stored");
+    check(!h.record(Interval - 1, 21, 26, 0), "samples closer than the interval are skipped");
+    check(h.record(Interval, 21, 26, 0.5f), "a sample an interval later is stored");
+
+    // The bed heats faster than a byte of change per sample
+    h.record(2 * Interval, 200, 26, 0.5f);
+    h.record(3 * Interval, 200, 26, 0.5f);
+    std::vector<PrintHistory::Sample> s = decode(h);
+    check(s.size() == 4, "four samples");
+    check(s[2].bed() == 21 + INT8_MAX, "a large change is clamped");
+    check(s[3].bed() == 200 && h.newest().bed() == 200, "and caught up with afterwards");
+    check(s[1].pct() == 0.5f && s[1].tool() == 26, "the other channels");
+  }
+
+  void testCompaction() {
+    PrintHistory h;
+    const uint32_t Interval = PrintHistory::BaseSampleInterval;
+    const uint16_t Capacity = PrintHistory::Capacity;
+
+    // Progress in half percents equal to the sample number; a tool that
+    // alternates between 210 and 212
+    for (uint16_t i = 0; i < Capacity; i++) h.record(i * Interval, 60, 210 + 2 * (i % 2), i / 2.0f);
+    check(h.size() == Capacity && h.sampleInterval() == Interval, "full at the base interval");
+    uint8_t generation = h.generation();
+
+    h.record(Capacity * Interval, 60, 215, 90);
+    check(h.size() == Capacity / 2 + 1, "pairs are merged when full");
+    check(h.sampleInterval() == 2 * Interval, "and the interval doubles");
+    check(h.generation() != generation, "and the generation changes");
+
+    std::vector<PrintHistory::Sample> s = decode(h);
+    bool averaged = true;
+    for (uint16_t k = 0; k < Capacity / 2; k++) {
+      // The average of 2k and 2k+1, in whole half percents
+      if (s[k].value[PrintHistory::Pct] != 2 * k || s[k].tool() != 211 || s[k].bed() != 60) averaged = false;
+    }
+    check(averaged, "each merged sample is the average of its pair");
+    check(s.back().pct() == 90 && s.back().tool() == 215, "the new sample follows the merged ones");
+
+    check(!h.record(Capacity * Interval + Interval, 60, 215, 90), "samples follow the new interval");
+    check(h.record(Capacity * Interval + 2 * Interval, 60, 215, 91), "at the new interval");
+
+    h.reset();
+    check(h.size() == 0 && h.sampleInterval() == Interval, "reset() starts over");
+  }
+};
+
+
+int main() {
+  Internal::testRecord();
+  Internal::testCompaction();
+
+  if (Internal::failures) return 1;
+  printf("PrintHistory: passed\n");
+  return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * RLEBitmapBench
+ *    Check RLEBitmap::draw() against drawBitmap() and time the two
+ *
+ * NOTES:
+ * o Each of the app's bitmaps is drawn from its original 1-bit source in
+ *   tools/images with drawBitmap(), and from its run-length encoding in
+ *   src/screens/images with RLEBitmap::draw(). The two must leave the
+ *   same pixels in the framebuffer.
+ * o The stand-in TFT_eSPI passes every byte the real one would send to the
+ *   display through its SPI write, so the timings include the traffic each
+ *   way of drawing generates. The bytes are reported too. They are what
+ *   takes the time on the device, where the SPI clock sets the cost of a
+ *   byte. The test fails only if the pixels differ.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <chrono>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+#include "RLEBitmap.h"
+// The original bitmaps, then their encodings
+#include "../../tools/images/Duet3DMono.h"
+#include "../../tools/images/OctoMono.h"
+#include "../../tools/images/RebootBitmap.h"
+#include "../../tools/images/RepRapMono.h"
+#include "images/Duet3DMono.h"
+#include "images/OctoMono.h"
+#include "images/RebootBitmap.h"
+#include "images/RepRapMono.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  constexpr int Iterations = 50;
+  constexpr uint16_t Fg = 0xF800, Bg = 0x001F;
+
+  struct Image {
+    const char*    name;
+    const uint8_t* bitmap;
+    const uint8_t* rle;
+    int16_t        w, h;
+  };
+
+  const Image Images[] = {
+    {"Duet3DMono", Duet3DMono, Duet3DMono_RLE, Duet3DMono_Width, Duet3DMono_Height},
+    {"OctoMono",   OctoMono,   OctoMono_RLE,   OctoMono_Width,   OctoMono_Height},
+    {"RebootIcon", RebootIcon, RebootIcon_RLE, RebootIcon_Width, RebootIcon_Height},
+    {"RepRapMono", RepRapMono, RepRapMono_RLE, RepRapMono_Width, RepRapMono_Height},
+  };
+
+  struct Result {
+    double   micros;
+    uint32_t bytes;
+  };
+
+  template<typename F>
+  Result time(TFT_eSPI& tft, F draw) {
+    uint32_t bytesBefore = tft.bytesSent;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Iterations; i++) draw();
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return {elapsed.count() / Iterations, (tft.bytesSent - bytesBefore) / Iterations};
+  }
+
+  bool same(const TFT_eSPI& a, const TFT_eSPI& b, int16_t w, int16_t h) {
+    for (int16_t y = 0; y < h; y++) {
+      for (int16_t x = 0; x < w; x++) { if (a.pixel(x, y) != b.pixel(x, y)) return false; }
+    }
+    return true;
+  }
+} // ----- END: Internal
+
+
+int main() {
+  using namespace Internal;
+  int failures = 0;
+
+  printf("%-11s %25s %25s %8s\n", "bitmap", "drawBitmap", "RLEBitmap::draw", "speedup");
+  for (const Image& img : Images) {
+    TFT_eSPI pixels(img.w, img.h), spans(img.w, img.h);
+    pixels.fillScreen(0x1234);
+    spans.fillScreen(0x1234);
+
+    Result before = time(pixels, [&]() { pixels.drawBitmap(0, 0, img.bitmap, img.w, img.h, Fg, Bg); });
+    Result after = time(spans, [&]() { RLEBitmap::draw(spans, 0, 0, img.rle, img.w, img.h, Fg, Bg); });
+    if (!same(pixels, spans, img.w, img.h)) {
+      printf("FAILED: %s: RLEBitmap::draw() and drawBitmap() drew different pixels\n", img.name);
+      failures++;
+    }
+
+    printf("%-11s %8.1fus %8u bytes %8.1fus %8u bytes %7.1fx\n", img.name,
+        before.micros, (unsigned)before.bytes, after.micros, (unsigned)after.bytes,
+        before.micros / after.micros);
+  }
+
+  if (failures) return 1;
+  printf("RLEBitmap: passed\n");
+  return 0;
+}
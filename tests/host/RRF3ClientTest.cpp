@@ -0,0 +1,286 @@
+/*
+ * RRF3ClientTest
+ *    Run RRF3Client against canned rr_model responses
+ *
+ * NOTES:
+ * o The responses follow those of a Duet 3 running RRF 3.5: every request
+ *   returns the whole sub-tree it asks for, most of which the client's
+ *   filters throw away. Their keys are still read, so both the filters and
+ *   the documents they fill are exercised at the sizes used on the device.
+ * o The fake printer refuses every request without the session key it
+ *   handed out, as RRF 3.5 does once a session has been started.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <HTTPClient.h>
+//                                  Local Includes
+#include "RRF3Client.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  // A 16x16 QOI thumbnail of one color, (32, 128, 240), served 12 bytes
+  // (16 base64 characters) at a time from ThumbnailOffset in the file
+  const char* const Thumbnail = "cW9pZgAAABAAAAAQBAD+IIDw/f39/cYAAAAAAAAAAQ==";
+  const uint32_t ThumbnailOffset = 4096;
+  const uint32_t ThumbnailChunk = 12;
+
+  // The parts of a printer's object model that the responses are built from
+  struct FakeDuet {
+    const char* status = "idle";
+    int jobSeq = 7;
+    int heatSeq = 3;
+    const char* fileName = nullptr;
+    const char* lastFileName = "0:/gcodes/calibration cube.gcode";
+    bool lastFileCancelled = false;
+    uint32_t size = 0;
+    uint32_t position = 0;
+    float bedActual = 21.5, bedActive = 0;
+    float toolActual = 23.0, toolActive = 0;
+
+    uint32_t connects = 0, jobFetches = 0, heatFetches = 0, thumbnailReads = 0;
+
+    String live() const {
+      char buf[2048];
+      snprintf(buf, sizeof(buf),
+        "{\"key\":\"\",\"flags\":\"d99fn\",\"result\":{"
+          "\"boards\":[{\"mcuTemp\":{\"current\":38.2},\"v12\":{\"current\":12.1},\"vIn\":{\"current\":24.2}}],"
+          "\"fans\":[{\"actualValue\":0.5,\"requestedValue\":0.5,\"rpm\":-1},{\"actualValue\":1,\"requestedValue\":1,\"rpm\":-1}],"
+          "\"heat\":{\"heaters\":[{\"active\":%.1f,\"avgPwm\":0.312,\"current\":%.1f,\"standby\":0,\"state\":\"active\"},"
+                               "{\"active\":%.1f,\"avgPwm\":0.521,\"current\":%.1f,\"standby\":0,\"state\":\"active\"}]},"
+          "\"inputs\":[{\"feedRate\":50,\"lineNumber\":1234,\"state\":\"idle\"},null,null],"
+          "\"job\":{\"build\":null,\"duration\":%u,\"filePosition\":%u,\"layer\":12,\"layerTime\":31.8,"
+            "\"pauseDuration\":0,\"rawExtrusion\":3120.5,"
+            "\"timesLeft\":{\"filament\":2010,\"file\":1960,\"slicer\":1800},\"warmUpDuration\":95},"
+          "\"move\":{\"axes\":[{\"machinePosition\":110.2,\"userPosition\":110.2},{\"machinePosition\":98.7,\"userPosition\":98.7},"
+                             "{\"machinePosition\":2.4,\"userPosition\":2.4}],\"currentMove\":{\"acceleration\":1000,"
+                             "\"deceleration\":1000,\"laserPwm\":null,\"requestedSpeed\":60,\"topSpeed\":60},\"virtualEPos\":3120.5},"
+          "\"sensors\":{\"analog\":[{\"lastReading\":%.1f},{\"lastReading\":%.1f}],\"endstops\":[null,null,null],"
+                       "\"filamentMonitors\":[],\"probes\":[{\"value\":[0]}]},"
+          "\"seqs\":{\"boards\":1,\"directories\":0,\"fans\":4,\"global\":9,\"heat\":%d,\"inputs\":0,\"job\":%d,"
+                    "\"ledStrips\":0,\"move\":2,\"network\":3,\"reply\":12,\"sensors\":1,\"spindles\":0,"
+                    "\"state\":5,\"tools\":2,\"volumes\":1},"
+          "\"state\":{\"currentTool\":0,\"machineMode\":\"FFF\",\"msUpTime\":482,\"status\":\"%s\",\"time\":\"2026-10-19T10:15:00\","
+                     "\"upTime\":8122}"
+        "}}",
+        bedActive, bedActual, toolActive, toolActual, position / 40, position,
+        bedActual, toolActual, heatSeq, jobSeq, status);
+      return String(buf);
+    }
+
+    String job() const {
+      char file[512] = "null";
+      if (fileName) {
+        snprintf(file, sizeof(file),
+          "{\"filament\":[4120.3],\"fileName\":\"%s\",\"firstLayerHeight\":0.2,"
+          "\"generatedBy\":\"PrusaSlicer 2.7.1+win64\",\"height\":20.2,\"lastModified\":\"2026-10-18T21:02:11\","
+          "\"layerHeight\":0.2,\"numLayers\":101,\"printTime\":3600,\"simulatedTime\":null,\"size\":%u,"
+          "\"thumbnails\":[{\"format\":\"qoi\",\"height\":48,\"offset\":186,\"size\":2048,\"width\":48}]}",
+          fileName, size);
+      }
+      char buf[2048];
+      snprintf(buf, sizeof(buf),
+        "{\"key\":\"job\",\"flags\":\"d99vn\",\"result\":{"
+          "\"build\":null,\"duration\":%u,\"file\":%s,\"filePosition\":%u,\"lastDuration\":2713,"
+          "\"lastFileAborted\":false,\"lastFileCancelled\":%s,\"lastFileName\":\"%s\","
+          "\"lastFileSimulated\":false,\"lastWarmUpDuration\":88,\"layer\":12,\"layerTime\":31.8,"
+          "\"layers\":[],\"pauseDuration\":0,\"rawExtrusion\":3120.5,"
+          "\"timesLeft\":{\"filament\":2010,\"file\":1960,\"slicer\":1800},\"warmUpDuration\":95"
+        "}}",
+        position / 40, file, position, lastFileCancelled ? "true" : "false", lastFileName);
+      return String(buf);
+    }
+
+    String heat() const {
+      char buf[2048];
+      snprintf(buf, sizeof(buf),
+        "{\"key\":\"heat\",\"flags\":\"d99vn\",\"result\":{"
+          "\"bedHeaters\":[0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1],\"chamberHeaters\":[-1,-1,-1,-1],"
+          "\"coldExtrudeTemperature\":160,\"coldRetractTemperature\":90,"
+          "\"heaters\":["
+            "{\"active\":%.1f,\"avgPwm\":0.312,\"current\":%.1f,\"max\":120,\"maxBadReadings\":3,\"maxHeatingFaultTime\":5,"
+             "\"maxTempExcursion\":15,\"min\":-273.1,\"model\":{\"coolingExp\":1.35,\"coolingRate\":0.56,\"deadTime\":5.5,"
+             "\"enabled\":true,\"fanCoolingRate\":0,\"heatingRate\":0.35,\"inverted\":false,\"maxPwm\":1,"
+             "\"pid\":{\"overridden\":false,\"p\":0.61,\"i\":0.014,\"d\":3.2,\"used\":true},\"standardVoltage\":24.1},"
+             "\"monitors\":[{\"action\":0,\"condition\":\"tooHigh\",\"limit\":120,\"sensor\":0}],\"sensor\":0,"
+             "\"standby\":0,\"state\":\"active\"},"
+            "{\"active\":%.1f,\"avgPwm\":0.521,\"current\":%.1f,\"max\":285,\"maxBadReadings\":3,\"maxHeatingFaultTime\":5,"
+             "\"maxTempExcursion\":15,\"min\":-273.1,\"model\":{\"coolingExp\":1.35,\"coolingRate\":0.97,\"deadTime\":2.1,"
+             "\"enabled\":true,\"fanCoolingRate\":0.11,\"heatingRate\":2.43,\"inverted\":false,\"maxPwm\":1,"
+             "\"pid\":{\"overridden\":false,\"p\":0.35,\"i\":0.052,\"d\":0.7,\"used\":true},\"standardVoltage\":24.1},"
+             "\"monitors\":[{\"action\":0,\"condition\":\"tooHigh\",\"limit\":285,\"sensor\":1}],\"sensor\":1,"
+             "\"standby\":0,\"state\":\"active\"}"
+          "]"
+        "}}",
+        bedActive, bedActual, toolActive, toolActual);
+      return String(buf);
+    }
+
+    String fileInfo() const {
+      char buf[1024];
+      snprintf(buf, sizeof(buf),
+        "{\"err\":0,\"fileName\":\"%s\",\"size\":%u,\"lastModified\":\"2026-10-18T21:02:11\","
+        "\"height\":20.2,\"firstLayerHeight\":0.2,\"layerHeight\":0.2,\"printTime\":3600,"
+        "\"filament\":[4120.3],\"generatedBy\":\"PrusaSlicer 2.7.1+win64\",\"thumbnails\":["
+          "{\"width\":8,\"height\":8,\"format\":\"qoi\",\"offset\":2048,\"size\":19},"
+          "{\"width\":16,\"height\":16,\"format\":\"qoi\",\"offset\":%u,\"size\":31},"
+          "{\"width\":300,\"height\":300,\"format\":\"png\",\"offset\":8192,\"size\":40123}]}",
+        fileName, size, ThumbnailOffset);
+      return String(buf);
+    }
+
+    String thumbnail(uint32_t offset) {
+      uint32_t length = strlen(Thumbnail) / 4 * 3;
+      if (offset < ThumbnailOffset || offset >= ThumbnailOffset + length) return "{\"err\":1}";
+      thumbnailReads++;
+      uint32_t start = (offset - ThumbnailOffset) / 3 * 4;
+      uint32_t next = offset + ThumbnailChunk;
+      char buf[256];
+      snprintf(buf, sizeof(buf), "{\"fileName\":\"%s\",\"offset\":%u,\"data\":\"%.16s\",\"next\":%u,\"err\":0}",
+          fileName, offset, Thumbnail + start, next < ThumbnailOffset + length ? next : 0);
+      return String(buf);
+    }
+
+    HTTPClient::Response handle(const HTTPClient::Request& r) {
+      if (r.uri.startsWith("/rr_connect")) {
+        connects++;
+        if (r.uri != "/rr_connect?password=reprap") return {200, "{\"err\":1}"};
+        return {200,
+          "{\"err\":0,\"sessionTimeout\":8000,\"boardType\":\"duet3mb6hc102\",\"apiLevel\":1,\"sessionKey\":1234}"};
+      }
+      const String* key = r.header("X-Session-Key");
+      if (key == nullptr || *key != "1234") return {401, ""};
+
+      if (r.uri == "/rr_model?key=state.status&flags=d99fn") {
+        return {200, String("{\"key\":\"state.status\",\"flags\":\"d99fn\",\"result\":\"") + status + "\"}"};
+      }
+      if (r.uri == "/rr_model?flags=d99fn") return {200, live()};
+      if (r.uri == "/rr_model?key=job&flags=d99vn") { jobFetches++; return {200, job()}; }
+      if (r.uri == "/rr_model?key=heat&flags=d99vn") { heatFetches++; return {200, heat()}; }
+      if (fileName && r.uri == "/rr_fileinfo?name=0%3A%2Fgcodes%2Fbenchy.gcode") return {200, fileInfo()};
+      if (fileName && r.uri.startsWith("/rr_thumbnail?name=0%3A%2Fgcodes%2Fbenchy.gcode&offset=")) {
+        return {200, thumbnail(r.uri.substring(r.uri.lastIndexOf('=') + 1).toInt())};
+      }
+      return {404, ""};
+    }
+  };
+
+  PrinterSnapshot snap(const RRF3Client& client) {
+    PrinterSnapshot s;
+    client.capture(s);
+    return s;
+  }
+
+  void testPrint() {
+    FakeDuet duet;
+    HTTPClient::handler() = [&duet](const HTTPClient::Request& r) { return duet.handle(r); };
+
+    PrinterSettings ps;
+    ps.server = "duet";
+    RRF3Client client;
+    client.begin(ps);
+
+    // ----- Idle: the first request has no session key, so the client connects
+    client.refresh();
+    check(duet.connects == 1, "connects when refused");
+    check(snap(client).state == PrintClient::State::Operational, "an idle printer is Operational");
+    client.refresh();
+    check(duet.connects == 1, "keeps the session key");
+    check(duet.jobFetches == 0 && duet.heatFetches == 0, "only state.status is fetched while idle");
+
+    // ----- A print starts
+    duet.status = "processing";
+    duet.fileName = "0:/gcodes/benchy.gcode";
+    duet.size = 200000;
+    duet.position = 50000;
+    duet.bedActive = 60; duet.bedActual = 59.8;
+    duet.toolActive = 215; duet.toolActual = 214.6;
+    duet.jobSeq++; duet.heatSeq++;
+    client.refresh();
+    PrinterSnapshot s = snap(client);
+    check(s.state == PrintClient::State::Printing, "a busy printer is Printing");
+    check(strcmp(s.filename, "benchy.gcode") == 0, "the file name is taken from the job");
+    check(fabsf(s.pct - 25) < 0.01f, "the progress is the file position over the file size");
+    check(s.timeLeft == 1800, "the slicer's estimate is preferred");
+    check(fabsf(s.bedTarget - 60) < 0.01f && fabsf(s.toolTarget - 215) < 0.01f, "the heater targets are fetched");
+    check(fabsf(s.bedActual - 59.8f) < 0.01f && fabsf(s.toolActual - 214.6f) < 0.01f,
+          "the heater temperatures are live");
+    check(client.lastRefreshBytes() > 0, "the bytes received are counted");
+
+    // ----- The job's thumbnail: the largest QOI, as none is big enough to scale down
+    check(client.thumbnailPending() && !s.thumbnail, "a new job's thumbnail is wanted");
+    for (int i = 0; i < 10 && client.thumbnailPending(); i++) client.fetchThumbnail();
+    check(!client.thumbnailPending() && snap(client).thumbnail, "the thumbnail is fetched");
+    check(duet.thumbnailReads == 3, "the thumbnail is read a piece at a time");
+    uint16_t width = 0, height = 0;
+    File thumb = ThumbnailCache::open("benchy.gcode", width, height);
+    uint16_t pixel = 0;
+    if (thumb) thumb.read((uint8_t*)&pixel, sizeof(pixel));
+    check(width == 16 && height == 16 && pixel == 0x241E, "the thumbnail is cached");
+
+    // ----- While printing, the job and heat sub-trees are only fetched when they change
+    uint32_t jobFetches = duet.jobFetches, heatFetches = duet.heatFetches;
+    duet.position = 100000;
+    client.refresh();
+    client.refresh();
+    check(duet.jobFetches == jobFetches && duet.heatFetches == heatFetches, "unchanged sub-trees aren't fetched");
+    check(fabsf(snap(client).pct - 50) < 0.01f, "the progress is live");
+    duet.toolActive = 220; duet.heatSeq++;
+    client.refresh();
+    check(duet.heatFetches == heatFetches + 1 && duet.jobFetches == jobFetches, "only the changed sub-tree is fetched");
+    check(fabsf(snap(client).toolTarget - 220) < 0.01f, "a new heater target is seen");
+
+    // ----- The print is cancelled
+    duet.status = "idle";
+    duet.lastFileName = duet.fileName;
+    duet.fileName = nullptr;
+    duet.lastFileCancelled = true;
+    duet.jobSeq++;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Operational, "a cancelled print isn't reported as Complete");
+
+    // ----- The next print runs to the end
+    duet.status = "processing";
+    duet.fileName = "0:/gcodes/vase.gcode";
+    duet.lastFileCancelled = false;
+    duet.jobSeq++;
+    client.refresh();
+    check(strcmp(snap(client).filename, "vase.gcode") == 0, "a new job is seen");
+    duet.status = "idle";
+    duet.lastFileName = duet.fileName;
+    duet.fileName = nullptr;
+    duet.jobSeq++;
+    client.refresh();
+    s = snap(client);
+    check(s.state == PrintClient::State::Complete, "a finished print is Complete");
+    check(strcmp(s.filename, "vase.gcode") == 0, "the finished job keeps its name");
+    client.acknowledgeCompletion();
+    check(snap(client).state == PrintClient::State::Operational, "acknowledging a completion");
+
+    // ----- The printer goes away
+    HTTPClient::handler() = nullptr;
+    client.refresh();
+    check(snap(client).state == PrintClient::State::Offline, "an unreachable printer is Offline");
+  }
+};
+
+
+int main() {
+  Internal::testPrint();
+
+  if (Internal::failures) return 1;
+  printf("RRF3Client: passed\n");
+  return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * RequestSchedulerTest
+ *    Simulate 120 seconds of passes of the network side of the app and check
+ *    how RequestScheduler spaces out the requests of its sources
+ *
+ * NOTES:
+ * o The sources are those the app adds, with its budgets. A pass runs every
+ *   10ms, and each request blocks for a fixed time, advancing the clock.
+ * o Within a pass, the sources ask in the opposite order of their class, so
+ *   that a printer refresh is refused at first and must win its turn
+ *   through the queue rather than by asking first.
+ * o A thumbnail is always wanted, so the thumbnails source runs into its
+ *   budget in every window.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+//                                  Local Includes
+#include "RequestScheduler.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  using Class = RequestScheduler::Class;
+
+  constexpr uint32_t Duration = 120 * 1000L;    // millis
+  constexpr uint32_t PassInterval = 10;
+  constexpr uint32_t RefreshInterval = 10 * 1000L;
+  constexpr uint32_t LookupInterval = 30 * 1000L;
+
+  // How long each source's requests block, in millis
+  constexpr uint32_t PollTime = 800, ClientTime = 300, LookupTime = 200, ThumbnailTime = 400;
+
+  struct Source {
+    int8_t id;
+    uint32_t duration;
+    std::vector<uint32_t> granted;   // When each request started
+  };
+
+  // Issue one request from the source if the scheduler allows it
+  bool ask(RequestScheduler& s, Source& source, bool wanted) {
+    if (!wanted) return false;
+    RequestScheduler::Request request(s, source.id);
+    if (!request) return false;
+    source.granted.push_back(millis());
+    HostClock::advanceMillis(source.duration);
+    return true;
+  }
+
+  JsonObjectConst stats(const JsonDocument& doc, const char* name) {
+    return doc[F("sources")][name];
+  }
+
+  void testPasses() {
+    HostClock::now() = 0;
+    RequestScheduler s;
+    Source poll = {s.addSource("printerPoll", Class::Printer, 20 * 1000L, true), PollTime, {}};
+    Source clients = {s.addSource("printerClients", Class::Printer, 15 * 1000L, true), ClientTime, {}};
+    Source lookup = {s.addSource("hostLookup", Class::Lookup, 5 * 1000L), LookupTime, {}};
+    Source thumbs = {s.addSource("thumbnails", Class::Background, 5 * 1000L), ThumbnailTime, {}};
+
+    uint32_t maxPerPass = 0;
+    uint32_t lookupWanted = 0;        // When the host last needed a lookup
+    bool lookupPending = true;
+    while (millis() < Duration) {
+      s.beginPass();
+      uint32_t n = 0;
+      n += ask(s, thumbs, true);
+      if (ask(s, lookup, lookupPending)) { lookupPending = false; n++; }
+      n += ask(s, clients, s.due(clients.id, RefreshInterval));
+      n += ask(s, poll, s.due(poll.id, RefreshInterval));
+      if (n > maxPerPass) maxPerPass = n;
+      if (millis() - lookupWanted >= LookupInterval) { lookupWanted = millis(); lookupPending = true; }
+      HostClock::advanceMillis(PassInterval);
+    }
+
+    check(maxPerPass == 1, "one request per pass");
+
+    // Each periodic source is refreshed once per interval
+    check(poll.granted.size() >= 12 && poll.granted.size() <= 13, "the poll runs every interval");
+    check(clients.granted.size() >= 12 && clients.granted.size() <= 13, "the clients run every interval");
+    for (size_t i = 1; i < poll.granted.size(); i++) {
+      uint32_t gap = poll.granted[i] - poll.granted[i-1];
+      check(gap >= RefreshInterval - 1000 && gap <= RefreshInterval + 1000, "the poll keeps its interval");
+    }
+
+    // Once under way, the two are half an interval apart
+    bool spread = true;
+    for (uint32_t p : poll.granted) {
+      for (uint32_t c : clients.granted) {
+        if (p < RefreshInterval || c < RefreshInterval) continue;
+        uint32_t apart = p > c ? p - c : c - p;
+        if (apart < RefreshInterval/2 - 1000) spread = false;
+      }
+    }
+    check(spread, "periodic sources are spread across the interval");
+
+    // Thumbnails use their budget in each window, and a request at most beyond it
+    uint32_t used[2] = {0, 0};
+    for (uint32_t t : thumbs.granted) used[t / RequestScheduler::BudgetWindow] += ThumbnailTime;
+    for (uint32_t u : used) {
+      check(u >= 5000 && u <= 5000 + ThumbnailTime, "the thumbnails keep to their budget");
+    }
+    check(lookup.granted.size() == 4, "every lookup is made");
+
+    DynamicJsonDocument doc(2048);
+    s.toJSON(doc.to<JsonObject>());
+    // A printer source is refused at most once, by the request already under way
+    check((stats(doc, "printerPoll")[F("maxWait")] | UINT32_MAX) <= ThumbnailTime + PassInterval,
+          "the poll waits for no more than one request");
+    check((stats(doc, "printerClients")[F("maxWait")] | UINT32_MAX) <= ThumbnailTime + PassInterval,
+          "the clients wait for no more than one request");
+    check((stats(doc, "thumbnails")[F("overBudget")] | 0) > 0, "thumbnails are refused for their budget");
+    check((stats(doc, "printerPoll")[F("mean")] | 0) == PollTime * 1000, "the mean request time");
+    check((stats(doc, "printerPoll")[F("requests")] | 0) == poll.granted.size(), "every request is counted");
+    check((doc[F("queueDepth")] | 0) == 1, "only the thumbnails are waiting at the end");
+  }
+
+  void testLongTotals() {
+    // More than 2^32 microseconds (71.6 minutes) in all
+    HostClock::now() = 0;
+    RequestScheduler s;
+    Source slow = {s.addSource("slow", Class::Background, 0), 30 * 60 * 1000L, {}};
+    for (int i = 0; i < 3; i++) {
+      s.beginPass();
+      ask(s, slow, true);
+    }
+    DynamicJsonDocument doc(512);
+    s.toJSON(doc.to<JsonObject>());
+    check((stats(doc, "slow")[F("mean")] | 0) == 30 * 60 * 1000000UL, "the mean survives long totals");
+  }
+};
+
+
+int main() {
+  Internal::testPasses();
+  Internal::testLongTotals();
+
+  if (Internal::failures) return 1;
+  printf("RequestScheduler: passed\n");
+  return 0;
+}
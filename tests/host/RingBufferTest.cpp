@@ -0,0 +1,65 @@
+/*
+ * RingBufferTest
+ *    Check RingBuffer's ordering as it fills and wraps
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdint.h>
+#include <stdio.h>
+//                                  Local Includes
+#include "RingBuffer.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  // Are the elements first, first+1, ... oldest to newest?
+  template<typename T, uint8_t N>
+  bool holds(const RingBuffer<T, N>& rb, T first, uint8_t count) {
+    if (rb.size() != count) return false;
+    for (uint8_t i = 0; i < count; i++) { if (rb[i] != first + i) return false; }
+    return count == 0 || (rb.oldest() == first && rb.newest() == first + count - 1);
+  }
+
+  void testOrder() {
+    RingBuffer<int, 5> rb;
+    check(rb.isEmpty() && !rb.isFull() && rb.size() == 0, "starts empty");
+
+    for (int v = 1; v <= 3; v++) rb.push(v);
+    check(holds(rb, 1, 3) && !rb.isFull(), "oldest to newest before filling");
+
+    rb.push(4); rb.push(5);
+    check(holds(rb, 1, 5) && rb.isFull(), "full");
+
+    // Each push past capacity drops the oldest, through several wraps
+    bool ok = true;
+    for (int v = 6; v <= 23; v++) {
+      rb.push(v);
+      ok = ok && holds(rb, v - 4, 5);
+    }
+    check(ok, "overwrites the oldest when full");
+
+    rb.clear();
+    check(rb.isEmpty() && rb.size() == 0, "empty after clear()");
+    rb.push(100);
+    check(holds(rb, 100, 1), "usable after clear()");
+  }
+};
+
+
+int main() {
+  Internal::testOrder();
+
+  if (Internal::failures) return 1;
+  printf("RingBuffer: passed\n");
+  return 0;
+}
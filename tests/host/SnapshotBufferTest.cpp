@@ -0,0 +1,107 @@
+/*
+ * SnapshotBufferTest
+ *    Check the SnapshotBuffer handoff on a host with std::thread
+ *
+ * NOTES:
+ * o The producer fills every word of a value with the same sequence number
+ *   before publishing it. A consumer that ever sees a value with mixed
+ *   words has read a slot while it was being written.
+ * o The consumer must also never see the sequence numbers go backwards.
+ * o Build with -fsanitize=thread to have TSan check the memory ordering as
+ *   well, e.g. cmake -DCMAKE_CXX_FLAGS=-fsanitize=thread
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+//                                  Local Includes
+#include "SnapshotBuffer.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  constexpr uint32_t Publishes = 500000;
+  constexpr int Words = 32;     // Big enough that a torn copy is likely to show
+
+  struct Value {
+    uint32_t words[Words] = {0};
+  };
+
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  void testSingleThread() {
+    SnapshotBuffer<Value> buffer;
+    check(!buffer.update(), "update() before any publish");
+    check(buffer.current().words[0] == 0, "default value before any publish");
+
+    for (uint32_t v = 1; v <= 3; v++) {
+      Value& back = buffer.back();
+      for (int w = 0; w < Words; w++) back.words[w] = v;
+      buffer.publish();
+    }
+    check(buffer.update(), "update() after publishing");
+    check(buffer.current().words[0] == 3, "only the newest value is taken");
+    check(!buffer.update(), "update() with nothing new");
+    check(buffer.current().words[0] == 3, "current() is kept until the next update");
+  }
+
+  void testThreads() {
+    SnapshotBuffer<Value> buffer;
+    std::atomic<bool> done{false};
+    uint32_t taken = 0;
+    bool torn = false, backwards = false;
+
+    std::thread consumer([&]() {
+      uint32_t last = 0;
+      for (;;) {
+        bool finished = done.load(std::memory_order_acquire);
+        if (buffer.update()) {
+          const Value& v = buffer.current();
+          for (int w = 1; w < Words; w++) { if (v.words[w] != v.words[0]) torn = true; }
+          if (v.words[0] <= last) backwards = true;
+          last = v.words[0];
+          taken++;
+          continue;
+        }
+        // Everything was published before done was set, so nothing is left
+        if (finished) break;
+      }
+      // The last value published must be the last one seen
+      if (last != Publishes) backwards = true;
+    });
+
+    for (uint32_t seq = 1; seq <= Publishes; seq++) {
+      Value& back = buffer.back();
+      for (int w = 0; w < Words; w++) back.words[w] = seq;
+      buffer.publish();
+      // Let the consumer run now and then so the two really overlap
+      if ((seq & 0x3F) == 0) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    check(!torn, "the consumer saw a value that was being written");
+    check(!backwards, "the consumer saw the values out of order or missed the last");
+    check(taken > 0, "the consumer took at least one value");
+    printf("SnapshotBuffer: %u published, %u taken\n", (unsigned)Publishes, (unsigned)taken);
+  }
+} // ----- END: Internal
+
+
+int main() {
+  Internal::testSingleThread();
+  Internal::testThreads();
+  if (Internal::failures) return 1;
+  printf("SnapshotBuffer: passed\n");
+  return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * SpriteUnpackerBench
+ *    Check SpriteUnpacker against readPixel() and time the two
+ *
+ * NOTES:
+ * o The sprites have the sizes and depths of the ones the Home and Detail
+ *   screens push: 1-bit text areas and 4-bit printer slots.
+ * o "readPixel" is the conversion SpritePusher used before SpriteUnpacker:
+ *   a readPixel() and a byte swap per pixel.
+ * o The timings are for the host's CPU, so only the ratio between the two
+ *   means much. The test fails only if the results differ.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+//                                  Third Party Libraries
+#include <TFT_eSPI.h>
+//                                  Local Includes
+#include "SpriteUnpacker.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  constexpr uint16_t ChunkPixels = 480 * 8;   // As in SpritePusher
+  constexpr int Iterations = 200;
+
+  struct Case {
+    const char* name;
+    int8_t  depth;
+    int16_t w, h;
+  };
+
+  const Case Cases[] = {
+    {"clock (1-bit)",       1, 320, 72},
+    {"weather (1-bit)",     1, 320, 24},
+    {"detail text (1-bit)", 1, 310, 97},
+    {"slot of 4 (4-bit)",   4,  80, 58},
+    {"slot of 1 (4-bit)",   4, 319, 58},
+    {"thumbnail (16-bit)", 16, 100, 100},
+  };
+
+  uint32_t seed = 12345;
+  uint32_t random() { seed = seed * 1103515245 + 12345; return seed >> 16; }
+
+  // Something like the real contents: mostly background, with runs of
+  // foreground as in text and bars
+  void fill(TFT_eSprite& s, int8_t depth) {
+    for (int16_t y = 0; y < s.height(); y++) {
+      uint32_t color = 0;
+      for (int16_t x = 0; x < s.width(); x++) {
+        if (random() % 6 == 0) color = (depth == 1) ? (random() & 1) : random();
+        s.drawPixel(x, y, depth == 4 ? (color & 0x0F) : color);
+      }
+    }
+  }
+
+  void convertWithReadPixel(TFT_eSprite& s, int16_t row, int16_t rows, uint16_t* p) {
+    int16_t w = s.width();
+    for (int16_t r = 0; r < rows; r++) {
+      for (int16_t c = 0; c < w; c++) {
+        uint16_t color = s.readPixel(c, row + r);
+        *p++ = (color >> 8) | (color << 8);
+      }
+    }
+  }
+
+  template<typename F>
+  double time(TFT_eSprite& s, uint16_t* out, F convert) {
+    int16_t rowsPerChunk = max(1, ChunkPixels / s.width());
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Iterations; i++) {
+      for (int16_t row = 0; row < s.height(); row += rowsPerChunk) {
+        int16_t rows = min(rowsPerChunk, (int16_t)(s.height() - row));
+        convert(row, rows, out);
+      }
+      // Keep the conversions from being optimized away
+      asm volatile("" : : "r"(out) : "memory");
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / Iterations;
+  }
+} // ----- END: Internal
+
+
+int main() {
+  using namespace Internal;
+  TFT_eSPI tft;
+  tft.setBitmapColor(0x07E0, 0x0000);
+  uint16_t palette[16];
+  for (int i = 0; i < 16; i++) palette[i] = 0x1111 * i + 0x0842;
+
+  int failures = 0;
+  printf("%-22s %10s %12s %12s %8s\n", "sprite", "pixels", "readPixel", "unpacker", "speedup");
+  for (const Case& c : Cases) {
+    TFT_eSprite sprite(&tft);
+    sprite.setColorDepth(c.depth);
+    sprite.createSprite(c.w, c.h);
+    if (c.depth == 4) sprite.createPalette(palette);
+    fill(sprite, c.depth);
+
+    std::vector<uint16_t> expected(c.w * c.h), actual(c.w * c.h);
+    convertWithReadPixel(sprite, 0, c.h, expected.data());
+    SpriteUnpacker unpacker(&sprite, tft.bitmap_fg, tft.bitmap_bg);
+    unpacker.unpack(0, c.h, actual.data());
+    if (expected != actual) {
+      printf("FAILED: %s: the unpacked pixels differ from readPixel()\n", c.name);
+      failures++;
+    }
+
+    uint16_t* out = expected.data();
+    double before = time(sprite, out, [&](int16_t row, int16_t rows, uint16_t* p) {
+      convertWithReadPixel(sprite, row, rows, p + row * c.w);
+    });
+    double after = time(sprite, out, [&](int16_t row, int16_t rows, uint16_t* p) {
+      unpacker.unpack(row, rows, p + row * c.w);
+    });
+    printf("%-22s %10d %10.1fus %10.1fus %7.1fx\n", c.name, c.w * c.h, before, after, before / after);
+  }
+
+  if (failures) return 1;
+  printf("SpriteUnpacker: passed\n");
+  return 0;
+}
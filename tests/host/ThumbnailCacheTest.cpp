@@ -0,0 +1,217 @@
+/*
+ * ThumbnailCacheTest
+ *    Check QoiDecoder against a known QOI image and ThumbnailCache::Writer
+ *    against the RGB565 thumbnail it should write
+ *
+ * NOTES:
+ * o The decoder's image is assembled by hand so that it uses every kind of
+ *   QOI chunk once. The pixels it decodes to are worked out in the comments.
+ * o The writer's image is twice ThumbnailCache::Size on each side, with a
+ *   quadrant of each: opaque red, opaque blue, half transparent green, and
+ *   alternating white and black columns. Scaled down by averaging, each
+ *   quadrant becomes a single known color.
+ *
+ */
+
+//--------------- Begin:  Includes ---------------------------------------------
+//                                  Core Libraries
+#include <stdio.h>
+#include <Arduino.h>
+#include <vector>
+//                                  WebThing Includes
+#include <gui/Theme.h>
+//                                  Local Includes
+#include "QoiDecoder.h"
+#include "ThumbnailCache.h"
+//--------------- End:    Includes ---------------------------------------------
+
+
+namespace Internal {
+  int failures = 0;
+
+  void check(bool ok, const char* what) {
+    if (ok) return;
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+
+  struct Pixel {
+    uint8_t r, g, b, a;
+    bool operator==(const Pixel& p) const { return r == p.r && g == p.g && b == p.b && a == p.a; }
+  };
+
+  // A Sink that keeps every pixel
+  struct Collector : public QoiDecoder::Sink {
+    uint16_t width = 0, height = 0;
+    std::vector<Pixel> pixels;
+    bool begin(uint16_t w, uint16_t h) override { width = w; height = h; return true; }
+    void pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a) override { pixels.push_back({r, g, b, a}); }
+  };
+
+  std::vector<uint8_t> header(uint32_t width, uint32_t height) {
+    return {
+      'q', 'o', 'i', 'f',
+      (uint8_t)(width >> 24), (uint8_t)(width >> 16), (uint8_t)(width >> 8), (uint8_t)width,
+      (uint8_t)(height >> 24), (uint8_t)(height >> 16), (uint8_t)(height >> 8), (uint8_t)height,
+      4, 0 };
+  }
+
+  void trailer(std::vector<uint8_t>& qoi) {
+    const uint8_t end[] = {0, 0, 0, 0, 0, 0, 0, 1};
+    for (uint8_t b : end) qoi.push_back(b);
+  }
+
+  // 3x2, one pixel per kind of chunk
+  std::vector<uint8_t> knownImage() {
+    std::vector<uint8_t> qoi = header(3, 2);
+    const uint8_t chunks[] = {
+      0xFE, 10, 20, 30,       // RGB:   (10, 20, 30, 255), index 9
+      0x76,                   // DIFF:  dr +1, dg -1, db 0 -> (11, 19, 30, 255)
+      0xAA, 0x5A,             // LUMA:  dg +10, dr-dg -3, db-dg +2 -> (18, 29, 42, 255)
+      0xFF, 200, 100, 50, 128,// RGBA:  (200, 100, 50, 128)
+      0x09,                   // INDEX: 9 -> (10, 20, 30, 255)
+      0xC0 };                 // RUN:   1 more of the same
+    for (uint8_t b : chunks) qoi.push_back(b);
+    trailer(qoi);
+    return qoi;
+  }
+
+  const Pixel KnownPixels[] = {
+    {10, 20, 30, 255}, {11, 19, 30, 255}, {18, 29, 42, 255},
+    {200, 100, 50, 128}, {10, 20, 30, 255}, {10, 20, 30, 255}
+  };
+
+  // Encodes with nothing but RGBA and RUN chunks, which is valid QOI if not
+  // a compact one
+  std::vector<uint8_t> encode(const std::vector<Pixel>& pixels, uint16_t width, uint16_t height) {
+    std::vector<uint8_t> qoi = header(width, height);
+    Pixel prev = {0, 0, 0, 255};
+    uint8_t run = 0;
+    for (const Pixel& p : pixels) {
+      if (p == prev && run < 62) { run++; continue; }
+      if (run) { qoi.push_back(0xC0 | (run - 1)); run = 0; }
+      if (p == prev) { run = 1; continue; }
+      const uint8_t rgba[] = {0xFF, p.r, p.g, p.b, p.a};
+      for (uint8_t b : rgba) qoi.push_back(b);
+      prev = p;
+    }
+    if (run) qoi.push_back(0xC0 | (run - 1));
+    trailer(qoi);
+    return qoi;
+  }
+
+  String base64(const std::vector<uint8_t>& data) {
+    static const char* Digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    String s;
+    for (size_t i = 0; i < data.size(); i += 3) {
+      uint32_t n = data[i] << 16;
+      if (i + 1 < data.size()) n |= data[i+1] << 8;
+      if (i + 2 < data.size()) n |= data[i+2];
+      s += Digits[(n >> 18) & 0x3F];
+      s += Digits[(n >> 12) & 0x3F];
+      s += (i + 1 < data.size()) ? Digits[(n >> 6) & 0x3F] : '=';
+      s += (i + 2 < data.size()) ? Digits[n & 0x3F] : '=';
+    }
+    return s;
+  }
+
+  void testDecoder() {
+    std::vector<uint8_t> qoi = knownImage();
+    const size_t N = sizeof(KnownPixels)/sizeof(KnownPixels[0]);
+
+    Collector whole;
+    QoiDecoder decoder(whole);
+    check(decoder.feed(qoi.data(), qoi.size()) && decoder.done(), "decodes the known image");
+    check(whole.width == 3 && whole.height == 2, "reads the header");
+    check(whole.pixels.size() == N && std::equal(KnownPixels, KnownPixels + N, whole.pixels.begin()),
+          "decodes every kind of chunk");
+
+    Collector bytes;
+    QoiDecoder byByte(bytes);
+    bool ok = true;
+    for (size_t i = 0; i < qoi.size(); i++) {
+      check(!byByte.done(), "not done before the last chunk");
+      ok = byByte.feed(&qoi[i], 1) && ok;
+      if (bytes.pixels.size() == N) break;
+    }
+    check(ok && byByte.done() && bytes.pixels == whole.pixels, "decodes a byte at a time");
+
+    Collector truncated;
+    QoiDecoder partial(truncated);
+    check(partial.feed(qoi.data(), qoi.size() - 10) && !partial.done(), "a truncated image isn't done");
+
+    Collector bad;
+    QoiDecoder badMagic(bad);
+    qoi[0] = 'x';
+    check(!badMagic.feed(qoi.data(), qoi.size()) && badMagic.failed(), "rejects a bad header");
+
+    std::vector<uint8_t> huge = header(QoiDecoder::MaxDimension + 1, 1);
+    Collector tooBig;
+    QoiDecoder tooLarge(tooBig);
+    check(!tooLarge.feed(huge.data(), huge.size()), "rejects an image that is too large");
+  }
+
+  void testWriter() {
+    const uint16_t Side = ThumbnailCache::Size * 2, Half = ThumbnailCache::Size;
+    std::vector<Pixel> pixels;
+    for (uint16_t y = 0; y < Side; y++) {
+      for (uint16_t x = 0; x < Side; x++) {
+        if (y < Half) pixels.push_back(x < Half ? Pixel{255, 0, 0, 255} : Pixel{0, 0, 255, 255});
+        else if (x < Half) pixels.push_back(Pixel{0, 255, 0, 128});
+        else pixels.push_back((x & 1) ? Pixel{0, 0, 0, 255} : Pixel{255, 255, 255, 255});
+      }
+    }
+    String text = base64(encode(pixels, Side, Side));
+
+    const char* Name = "quadrants.gcode";
+    check(!ThumbnailCache::contains(Name), "nothing is cached at first");
+    {
+      // Abandoned part way through
+      ThumbnailCache::Writer writer(Name);
+      check(writer.addBase64(text.substring(0, text.length()/2).c_str()), "accepts the first half");
+    }
+    check(!ThumbnailCache::contains(Name), "an abandoned thumbnail isn't found");
+
+    ThumbnailCache::Writer writer(Name);
+    // In pieces of awkward lengths, as they might arrive
+    bool ok = true;
+    for (unsigned int i = 0, n = 1; i < text.length(); i += n, n = n % 97 + 13) {
+      ok = writer.addBase64(text.substring(i, i + n).c_str()) && ok;
+    }
+    check(ok, "accepts the whole image in pieces");
+    check(!ThumbnailCache::contains(Name), "an unfinished thumbnail isn't found");
+    check(writer.finish(), "finishes");
+
+    uint16_t width = 0, height = 0;
+    File f = ThumbnailCache::open(Name, width, height);
+    check((bool)f && width == Half && height == Half, "the thumbnail is scaled to fit");
+    if (!f) return;
+    std::vector<uint16_t> thumb(width * height);
+    check(f.read((uint8_t*)thumb.data(), thumb.size() * 2) == thumb.size() * 2, "reads every row");
+    f.close();
+
+    // Green at half alpha over the (black) background, and the white and
+    // black columns averaged to (127, 127, 127)
+    const uint16_t Red = 0xF800, Blue = 0x001F, HalfGreen = 0x0400, Gray = 0x7BEF;
+    static_assert(Theme::Color_Background == 0x0000, "The expected colors assume a black background");
+    bool quadrants = true;
+    for (uint16_t y = 0; y < height; y++) {
+      for (uint16_t x = 0; x < width; x++) {
+        bool top = y < height/2, left = x < width/2;
+        uint16_t expected = top ? (left ? Red : Blue) : (left ? HalfGreen : Gray);
+        if (thumb[y * width + x] != expected) quadrants = false;
+      }
+    }
+    check(quadrants, "each quadrant is averaged to its color");
+  }
+};
+
+
+int main() {
+  Internal::testDecoder();
+  Internal::testWriter();
+
+  if (Internal::failures) return 1;
+  printf("ThumbnailCache: passed\n");
+  return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Arduino.h (host)
+ *    The little of the Arduino core that the host tests' sources use
+ *
+ * NOTES:
+ * o millis() and micros() read a simulated clock that only moves when a
+ *   test advances it (see HostClock) or calls delay(), so timing dependent
+ *   code runs the same way every time.
+ * o F() strings are ordinary strings. They are still passed as
+ *   const __FlashStringHelper*, so code that treats them differently from
+ *   const char* (e.g. ArduinoJson, which copies them) does so here too.
+ *
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include <string>
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+
+// ----- Time
+
+namespace HostClock {
+  // The simulated time in microseconds
+  inline uint64_t& now() { static uint64_t t = 0; return t; }
+  inline void advanceMicros(uint64_t us) { now() += us; }
+  inline void advanceMillis(uint64_t ms) { now() += ms * 1000; }
+};
+
+inline uint32_t micros() { return (uint32_t)HostClock::now(); }
+inline uint32_t millis() { return (uint32_t)(HostClock::now() / 1000); }
+inline void delay(uint32_t ms) { HostClock::advanceMillis(ms); }
+inline void yield() { }
+
+
+// ----- String
+
+class String {
+public:
+  String() { }
+  String(const char* s) : _s(s ? s : "") { }
+  String(const __FlashStringHelper* s) : _s(s ? reinterpret_cast<const char*>(s) : "") { }
+  String(const std::string& s) : _s(s) { }
+  explicit String(char c) : _s(1, c) { }
+  explicit String(unsigned char n) : _s(std::to_string(n)) { }
+  explicit String(int n) : _s(std::to_string(n)) { }
+  explicit String(unsigned int n) : _s(std::to_string(n)) { }
+  explicit String(long n) : _s(std::to_string(n)) { }
+  explicit String(unsigned long n) : _s(std::to_string(n)) { }
+  explicit String(float f, unsigned char decimals = 2) { fromDouble(f, decimals); }
+  explicit String(double f, unsigned char decimals = 2) { fromDouble(f, decimals); }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  char charAt(unsigned int i) const { return i < _s.length() ? _s[i] : '\0'; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  void reserve(unsigned int n) { _s.reserve(n); }
+
+  String& operator+=(const String& s) { _s += s._s; return *this; }
+  String& operator+=(const char* s) { if (s) _s += s; return *this; }
+  String& operator+=(const __FlashStringHelper* s) { return *this += reinterpret_cast<const char*>(s); }
+  String& operator+=(char c) { _s += c; return *this; }
+  String& operator+=(unsigned char n) { return *this += String(n); }
+  String& operator+=(int n) { return *this += String(n); }
+  String& operator+=(unsigned int n) { return *this += String(n); }
+  String& operator+=(long n) { return *this += String(n); }
+  String& operator+=(unsigned long n) { return *this += String(n); }
+  String& operator+=(float f) { return *this += String(f); }
+  String& operator+=(double f) { return *this += String(f); }
+  template<typename T> bool concat(const T& v) { *this += v; return true; }
+
+  bool operator==(const String& s) const { return _s == s._s; }
+  bool operator==(const char* s) const { return _s == (s ? s : ""); }
+  bool operator!=(const String& s) const { return !(*this == s); }
+  bool operator!=(const char* s) const { return !(*this == s); }
+  bool operator<(const String& s) const { return _s < s._s; }
+  bool equals(const String& s) const { return *this == s; }
+  bool equalsIgnoreCase(const String& s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+  bool startsWith(const String& s) const { return _s.compare(0, s._s.length(), s._s) == 0; }
+  bool endsWith(const String& s) const {
+    return _s.length() >= s._s.length() && _s.compare(_s.length() - s._s.length(), s._s.length(), s._s) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { size_t i = _s.find(c, from); return i == std::string::npos ? -1 : (int)i; }
+  int indexOf(const String& s, unsigned int from = 0) const { size_t i = _s.find(s._s, from); return i == std::string::npos ? -1 : (int)i; }
+  int lastIndexOf(char c) const { size_t i = _s.rfind(c); return i == std::string::npos ? -1 : (int)i; }
+  String substring(unsigned int from) const { return from < _s.length() ? String(_s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < to && from < _s.length() ? String(_s.substr(from, to - from)) : String();
+  }
+  long toInt() const { return atol(c_str()); }
+  float toFloat() const { return atof(c_str()); }
+  void trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n"), e = _s.find_last_not_of(" \t\r\n");
+    _s = (b == std::string::npos) ? std::string() : _s.substr(b, e - b + 1);
+  }
+  void toLowerCase() { for (char& c : _s) c = tolower(c); }
+  void toUpperCase() { for (char& c : _s) c = toupper(c); }
+
+private:
+  std::string _s;
+
+  void fromDouble(double f, unsigned char decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, f);
+    _s = buf;
+  }
+};
+
+inline String operator+(const String& a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, const char* b) { String s(a); s += b; return s; }
+inline String operator+(const char* a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, char b) { String s(a); s += b; return s; }
+inline bool operator==(const char* a, const String& b) { return b == a; }
+
+
+// ----- Stream
+
+class Stream {
+public:
+  virtual ~Stream() { }
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+#endif  // Arduino_h
@@ -0,0 +1,1220 @@
+/*
+ * ArduinoJson (host)
+ *    A stand-in for ArduinoJson 6 with just the parts the host tests use
+ *
+ * NOTES:
+ * o A document's memory is accounted for as on the ESP8266 and ESP32: each
+ *   object member and array element takes a 16 byte slot, and strings that
+ *   are copied take their length plus one. Capacities are rounded up to a
+ *   multiple of 4. Values themselves live on the host's heap; only the
+ *   accounting follows the device.
+ * o As in ArduinoJson, const char* strings (keys or values) are stored by
+ *   pointer, while F() strings, char*, String, and everything read by
+ *   deserializeJson() are copied. Copies are deduplicated. An insertion that
+ *   doesn't fit fails quietly and leaves the value null, so a filter or
+ *   document that is too small loses exactly what it would on the device.
+ * o deserializeJson() follows ArduinoJson's rules for filters (true keeps a
+ *   value and everything in it, the first element of an array filters every
+ *   element, "*" matches any key) and for memory: a key is read into the
+ *   free space even when the filter then drops it, and the result is
+ *   NoMemory when something that was asked for doesn't fit.
+ * o overflowed() reports whether any insertion has failed since the
+ *   document was last cleared.
+ *
+ */
+
+#ifndef ArduinoJson_h
+#define ArduinoJson_h
+
+#include <Arduino.h>
+#include <errno.h>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define JSON_ARRAY_SIZE(n) ((n) * 16)
+#define JSON_OBJECT_SIZE(n) ((n) * 16)
+#define JSON_STRING_SIZE(n) ((n) + 1)
+
+class JsonDocument;
+class JsonVariant;
+class JsonVariantConst;
+class JsonObject;
+class JsonObjectConst;
+class JsonArray;
+class JsonArrayConst;
+
+namespace ArduinoJsonHost {
+  static constexpr size_t SlotSize = 16;
+
+  inline size_t addPadding(size_t n) { return (n + 3) & ~(size_t)3; }
+
+  struct VariantData {
+    enum Type : uint8_t { Null, Bool, Integer, Float, String, Object, Array };
+    Type        type = Null;
+    bool        b = false;
+    int64_t     i = 0;
+    double      f = 0;
+    const char* s = nullptr;
+    std::vector<std::pair<const char*, VariantData*>> members;
+    std::vector<VariantData*> elements;
+
+    void setNull() { type = Null; members.clear(); elements.clear(); }
+  };
+
+  // A string as it was passed: stored by pointer (linked) or copied
+  struct StringRef {
+    const char* s;
+    size_t      len;
+    bool        linked;
+  };
+
+  inline StringRef ref(const char* s) { return {s ? s : "", s ? strlen(s) : 0, true}; }
+  inline StringRef ref(char* s) { return {s ? s : "", s ? strlen(s) : 0, false}; }
+  inline StringRef ref(const __FlashStringHelper* s) { return ref(const_cast<char*>(reinterpret_cast<const char*>(s))); }
+  inline StringRef ref(const String& s) { return {s.c_str(), s.length(), false}; }
+  inline StringRef ref(const std::string& s) { return {s.c_str(), s.length(), false}; }
+
+  inline bool equals(const char* key, const StringRef& r) {
+    return strlen(key) == r.len && memcmp(key, r.s, r.len) == 0;
+  }
+
+  inline const VariantData* member(const VariantData* d, const StringRef& key) {
+    if (d == nullptr || d->type != VariantData::Object) return nullptr;
+    for (const auto& m : d->members) { if (equals(m.first, key)) return m.second; }
+    return nullptr;
+  }
+
+  inline const VariantData* element(const VariantData* d, size_t i) {
+    if (d == nullptr || d->type != VariantData::Array || i >= d->elements.size()) return nullptr;
+    return d->elements[i];
+  }
+
+  inline bool asBool(const VariantData* d) {
+    if (d == nullptr) return false;
+    switch (d->type) {
+      case VariantData::Null:    return false;
+      case VariantData::Bool:    return d->b;
+      case VariantData::Integer: return d->i != 0;
+      case VariantData::Float:   return d->f != 0;
+      default:                   return true;
+    }
+  }
+
+  template<typename T>
+  T asIntegral(const VariantData* d) {
+    if (d == nullptr) return 0;
+    switch (d->type) {
+      case VariantData::Bool:    return d->b;
+      case VariantData::Integer: return (T)d->i;
+      case VariantData::Float:   return (T)d->f;
+      case VariantData::String:  return (T)strtoll(d->s, nullptr, 10);
+      default:                   return 0;
+    }
+  }
+
+  inline double asFloat(const VariantData* d) {
+    if (d == nullptr) return 0;
+    switch (d->type) {
+      case VariantData::Bool:    return d->b;
+      case VariantData::Integer: return (double)d->i;
+      case VariantData::Float:   return d->f;
+      case VariantData::String:  return strtod(d->s, nullptr);
+      default:                   return 0;
+    }
+  }
+
+  void serialize(const VariantData* d, std::string& out);
+
+  // Set by the conversions below
+  template<typename T, typename Enable = void> struct Converter;
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * DeserializationError
+ *
+ *----------------------------------------------------------------------------*/
+
+class DeserializationError {
+public:
+  enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+
+  DeserializationError() { }
+  DeserializationError(Code c) : _code(c) { }
+
+  Code code() const { return _code; }
+  explicit operator bool() const { return _code != Ok; }
+  bool operator==(Code c) const { return _code == c; }
+  bool operator!=(Code c) const { return _code != c; }
+  const char* c_str() const {
+    static const char* const Names[] = {
+      "Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory", "TooDeep"
+    };
+    return Names[_code];
+  }
+
+private:
+  Code _code = Ok;
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Read-only references
+ *
+ *----------------------------------------------------------------------------*/
+
+class JsonVariantConst {
+public:
+  JsonVariantConst() { }
+  explicit JsonVariantConst(const ArduinoJsonHost::VariantData* d) : _data(d) { }
+
+  bool isNull() const { return _data == nullptr || _data->type == ArduinoJsonHost::VariantData::Null; }
+  size_t size() const {
+    if (_data == nullptr) return 0;
+    if (_data->type == ArduinoJsonHost::VariantData::Object) return _data->members.size();
+    if (_data->type == ArduinoJsonHost::VariantData::Array) return _data->elements.size();
+    return 0;
+  }
+
+  template<typename T> T as() const { return ArduinoJsonHost::Converter<T>::from(_data); }
+  template<typename T> bool is() const { return ArduinoJsonHost::Converter<T>::check(_data); }
+  template<typename T> operator T() const { return as<T>(); }
+
+  template<typename T>
+  typename std::enable_if<!std::is_array<T>::value, T>::type operator|(const T& defaultValue) const {
+    return is<T>() ? as<T>() : defaultValue;
+  }
+  const char* operator|(const char* defaultValue) const {
+    const char* s = as<const char*>();
+    return s ? s : defaultValue;
+  }
+
+  template<typename K>
+  typename std::enable_if<!std::is_integral<K>::value, JsonVariantConst>::type operator[](const K& key) const {
+    return JsonVariantConst(ArduinoJsonHost::member(_data, ArduinoJsonHost::ref(key)));
+  }
+  template<typename I>
+  typename std::enable_if<std::is_integral<I>::value, JsonVariantConst>::type operator[](I i) const {
+    return JsonVariantConst(i < 0 ? nullptr : ArduinoJsonHost::element(_data, (size_t)i));
+  }
+  template<typename K>
+  bool containsKey(const K& key) const { return ArduinoJsonHost::member(_data, ArduinoJsonHost::ref(key)) != nullptr; }
+
+  const ArduinoJsonHost::VariantData* data() const { return _data; }
+
+protected:
+  const ArduinoJsonHost::VariantData* _data = nullptr;
+};
+
+class JsonString {
+public:
+  JsonString(const char* s) : _s(s) { }
+  const char* c_str() const { return _s; }
+  bool operator==(const char* s) const { return strcmp(_s, s) == 0; }
+private:
+  const char* _s;
+};
+
+class JsonPairConst {
+public:
+  JsonPairConst(const char* k, const ArduinoJsonHost::VariantData* v) : _key(k), _value(v) { }
+  JsonString key() const { return _key; }
+  JsonVariantConst value() const { return _value; }
+private:
+  JsonString _key;
+  JsonVariantConst _value;
+};
+
+class JsonObjectConst : public JsonVariantConst {
+public:
+  JsonObjectConst() { }
+  explicit JsonObjectConst(const ArduinoJsonHost::VariantData* d) :
+      JsonVariantConst(d && d->type == ArduinoJsonHost::VariantData::Object ? d : nullptr) { }
+
+  class iterator {
+  public:
+    iterator(const ArduinoJsonHost::VariantData* d, size_t i) : _d(d), _i(i) { }
+    JsonPairConst operator*() const { return JsonPairConst(_d->members[_i].first, _d->members[_i].second); }
+    iterator& operator++() { _i++; return *this; }
+    bool operator!=(const iterator& other) const { return _i != other._i; }
+  private:
+    const ArduinoJsonHost::VariantData* _d;
+    size_t _i;
+  };
+  iterator begin() const { return iterator(_data, 0); }
+  iterator end() const { return iterator(_data, size()); }
+};
+
+class JsonArrayConst : public JsonVariantConst {
+public:
+  JsonArrayConst() { }
+  explicit JsonArrayConst(const ArduinoJsonHost::VariantData* d) :
+      JsonVariantConst(d && d->type == ArduinoJsonHost::VariantData::Array ? d : nullptr) { }
+
+  class iterator {
+  public:
+    iterator(const ArduinoJsonHost::VariantData* d, size_t i) : _d(d), _i(i) { }
+    JsonVariantConst operator*() const { return JsonVariantConst(_d->elements[_i]); }
+    iterator& operator++() { _i++; return *this; }
+    bool operator!=(const iterator& other) const { return _i != other._i; }
+  private:
+    const ArduinoJsonHost::VariantData* _d;
+    size_t _i;
+  };
+  iterator begin() const { return iterator(_data, 0); }
+  iterator end() const { return iterator(_data, size()); }
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Conversions
+ *
+ *----------------------------------------------------------------------------*/
+
+namespace ArduinoJsonHost {
+  template<>
+  struct Converter<bool> {
+    static bool from(const VariantData* d) { return asBool(d); }
+    static bool check(const VariantData* d) { return d && d->type == VariantData::Bool; }
+  };
+
+  template<typename T>
+  struct Converter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+    static T from(const VariantData* d) { return asIntegral<T>(d); }
+    static bool check(const VariantData* d) {
+      if (d == nullptr || d->type != VariantData::Integer) return false;
+      if (std::is_unsigned<T>::value) return d->i >= 0 && (uint64_t)d->i <= (uint64_t)std::numeric_limits<T>::max();
+      return d->i >= (int64_t)std::numeric_limits<T>::min() && d->i <= (int64_t)std::numeric_limits<T>::max();
+    }
+  };
+
+  template<typename T>
+  struct Converter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static T from(const VariantData* d) { return (T)asFloat(d); }
+    static bool check(const VariantData* d) {
+      return d && (d->type == VariantData::Integer || d->type == VariantData::Float);
+    }
+  };
+
+  template<>
+  struct Converter<const char*> {
+    static const char* from(const VariantData* d) { return d && d->type == VariantData::String ? d->s : nullptr; }
+    static bool check(const VariantData* d) { return d && d->type == VariantData::String; }
+  };
+
+  template<>
+  struct Converter<::String> {
+    static ::String from(const VariantData* d) {
+      if (d == nullptr || d->type == VariantData::Null) return ::String();
+      if (d->type == VariantData::String) return ::String(d->s);
+      std::string s;
+      serialize(d, s);
+      return ::String(s);
+    }
+    static bool check(const VariantData* d) { return d && d->type == VariantData::String; }
+  };
+
+  template<>
+  struct Converter<JsonVariantConst> {
+    static JsonVariantConst from(const VariantData* d) { return JsonVariantConst(d); }
+    static bool check(const VariantData*) { return true; }
+  };
+
+  template<>
+  struct Converter<JsonObjectConst> {
+    static JsonObjectConst from(const VariantData* d) { return JsonObjectConst(d); }
+    static bool check(const VariantData* d) { return d && d->type == VariantData::Object; }
+  };
+
+  template<>
+  struct Converter<JsonArrayConst> {
+    static JsonArrayConst from(const VariantData* d) { return JsonArrayConst(d); }
+    static bool check(const VariantData* d) { return d && d->type == VariantData::Array; }
+  };
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Writable references
+ *
+ *----------------------------------------------------------------------------*/
+
+// A reference to a value in a document. A reference to a member or element
+// that doesn't exist yet creates it (and its parents) when it is written.
+class JsonVariant {
+public:
+  JsonVariant() { }
+  JsonVariant(JsonDocument* doc, ArduinoJsonHost::VariantData* d) : _doc(doc), _data(d) { }
+
+  // ----- Reading
+  operator JsonVariantConst() const { return JsonVariantConst(resolve()); }
+  bool isNull() const { return JsonVariantConst(resolve()).isNull(); }
+  size_t size() const { return JsonVariantConst(resolve()).size(); }
+  template<typename T> T as() const;
+  template<typename T> bool is() const { return JsonVariantConst(resolve()).is<T>(); }
+  template<typename T> operator T() const { return as<T>(); }
+  template<typename T>
+  typename std::enable_if<!std::is_array<T>::value, T>::type operator|(const T& defaultValue) const {
+    return JsonVariantConst(resolve()) | defaultValue;
+  }
+  const char* operator|(const char* defaultValue) const { return JsonVariantConst(resolve()) | defaultValue; }
+  template<typename K>
+  bool containsKey(const K& key) const { return JsonVariantConst(resolve()).containsKey(key); }
+
+  // ----- Children, created when written
+  template<typename K>
+  typename std::enable_if<!std::is_integral<K>::value, JsonVariant>::type operator[](const K& key) const {
+    return child(ArduinoJsonHost::ref(key));
+  }
+  template<typename I>
+  typename std::enable_if<std::is_integral<I>::value, JsonVariant>::type operator[](I i) const {
+    JsonVariant v(_doc, nullptr);
+    v._parent = std::make_shared<JsonVariant>(*this);
+    v._index = (size_t)i;
+    return v;
+  }
+
+  // ----- Writing
+  template<typename T> JsonVariant& operator=(const T& value) { set(value); return *this; }
+  JsonVariant& operator=(const JsonVariant& v) { set(JsonVariantConst(v.resolve())); return *this; }
+  JsonVariant(const JsonVariant&) = default;
+
+  template<typename T> bool set(const T& value);
+  template<typename T> T to() const;
+  template<typename K> JsonObject createNestedObject(const K& key) const;
+  JsonObject createNestedObject() const;
+  template<typename K> JsonArray createNestedArray(const K& key) const;
+  JsonArray createNestedArray() const;
+  template<typename T> bool add(const T& value) const;
+
+  ArduinoJsonHost::VariantData* resolve() const;
+  ArduinoJsonHost::VariantData* getOrCreate() const;
+  JsonDocument* document() const { return _doc; }
+
+protected:
+  JsonDocument* _doc = nullptr;
+  mutable ArduinoJsonHost::VariantData* _data = nullptr;
+  // For a member or element that is only resolved when used
+  std::shared_ptr<JsonVariant> _parent;
+  bool        _hasKey = false;
+  bool        _keyLinked = false;
+  const char* _keyPointer = nullptr;
+  std::string _keyCopy;
+  size_t      _index = 0;
+
+  // Refer to what v refers to (assignment to a JsonVariant sets the value instead)
+  void rebind(const JsonVariant& v) {
+    _doc = v._doc; _data = v._data; _parent = v._parent;
+    _hasKey = v._hasKey; _keyLinked = v._keyLinked; _keyPointer = v._keyPointer;
+    _keyCopy = v._keyCopy; _index = v._index;
+  }
+
+  JsonVariant child(const ArduinoJsonHost::StringRef& key) const {
+    JsonVariant v(_doc, nullptr);
+    v._parent = std::make_shared<JsonVariant>(*this);
+    v._hasKey = true;
+    v._keyLinked = key.linked;
+    v._keyPointer = key.s;
+    v._keyCopy.assign(key.s, key.len);
+    return v;
+  }
+  ArduinoJsonHost::StringRef key() const {
+    if (_keyLinked) return {_keyPointer, _keyCopy.length(), true};
+    return {_keyCopy.c_str(), _keyCopy.length(), false};
+  }
+};
+
+class JsonObject : public JsonVariant {
+public:
+  JsonObject() { }
+  JsonObject(JsonDocument* doc, ArduinoJsonHost::VariantData* d) :
+      JsonVariant(doc, d && d->type == ArduinoJsonHost::VariantData::Object ? d : nullptr) { }
+  JsonObject(const JsonObject&) = default;
+  JsonObject& operator=(const JsonObject& o) { rebind(o); return *this; }
+  operator JsonObjectConst() const { return JsonObjectConst(_data); }
+};
+
+class JsonArray : public JsonVariant {
+public:
+  JsonArray() { }
+  JsonArray(JsonDocument* doc, ArduinoJsonHost::VariantData* d) :
+      JsonVariant(doc, d && d->type == ArduinoJsonHost::VariantData::Array ? d : nullptr) { }
+  JsonArray(const JsonArray&) = default;
+  JsonArray& operator=(const JsonArray& a) { rebind(a); return *this; }
+  operator JsonArrayConst() const { return JsonArrayConst(_data); }
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * JsonDocument
+ *
+ *----------------------------------------------------------------------------*/
+
+class JsonDocument {
+public:
+  JsonDocument(const JsonDocument&) = delete;
+  JsonDocument& operator=(const JsonDocument&) = delete;
+  virtual ~JsonDocument() { }
+
+  size_t capacity() const { return _capacity; }
+  size_t memoryUsage() const { return _used; }
+  bool overflowed() const { return _overflowed; }
+  void clear() {
+    _root.setNull();
+    _nodes.clear();
+    _strings.clear();
+    _used = 0;
+    _overflowed = false;
+  }
+
+  // ----- As a variant
+  operator JsonVariantConst() const { return JsonVariantConst(&_root); }
+  JsonVariant root() { return JsonVariant(this, &_root); }
+  bool isNull() const { return JsonVariantConst(&_root).isNull(); }
+  size_t size() const { return JsonVariantConst(&_root).size(); }
+  template<typename T> T as() { return root().as<T>(); }
+  template<typename T> T as() const { return JsonVariantConst(&_root).as<T>(); }
+  template<typename T> bool is() const { return JsonVariantConst(&_root).is<T>(); }
+  template<typename T> T to() { clear(); return root().to<T>(); }
+  template<typename K> bool containsKey(const K& key) const { return JsonVariantConst(&_root).containsKey(key); }
+
+  template<typename K>
+  typename std::enable_if<!std::is_integral<K>::value, JsonVariant>::type operator[](const K& key) { return root()[key]; }
+  template<typename I>
+  typename std::enable_if<std::is_integral<I>::value, JsonVariant>::type operator[](I i) { return root()[i]; }
+  template<typename K>
+  typename std::enable_if<!std::is_integral<K>::value, JsonVariantConst>::type operator[](const K& key) const {
+    return JsonVariantConst(&_root)[key];
+  }
+  template<typename I>
+  typename std::enable_if<std::is_integral<I>::value, JsonVariantConst>::type operator[](I i) const {
+    return JsonVariantConst(&_root)[i];
+  }
+
+  template<typename K> JsonObject createNestedObject(const K& key) { return root().createNestedObject(key); }
+  JsonObject createNestedObject() { return root().createNestedObject(); }
+  template<typename K> JsonArray createNestedArray(const K& key) { return root().createNestedArray(key); }
+  JsonArray createNestedArray() { return root().createNestedArray(); }
+  template<typename T> bool add(const T& value) { return root().add(value); }
+
+  // ----- The pool, for the references and the deserializer
+  ArduinoJsonHost::VariantData* newNode() { _nodes.emplace_back(); return &_nodes.back(); }
+
+  size_t available() const { return _capacity - _used; }
+
+  bool allocSlot() {
+    if (available() < ArduinoJsonHost::SlotSize) { _overflowed = true; return false; }
+    _used += ArduinoJsonHost::SlotSize;
+    return true;
+  }
+
+  // Returns the stored string, or nullptr if it doesn't fit
+  const char* saveString(const ArduinoJsonHost::StringRef& r) {
+    if (r.linked) return r.s;
+    std::string s(r.s, r.len);
+    auto found = _strings.find(s);
+    if (found != _strings.end()) return found->c_str();
+    if (available() < r.len + 1) { _overflowed = true; return nullptr; }
+    _used += r.len + 1;
+    return _strings.insert(s).first->c_str();
+  }
+
+  ArduinoJsonHost::VariantData* getOrAddMember(ArduinoJsonHost::VariantData* d, const ArduinoJsonHost::StringRef& key) {
+    using ArduinoJsonHost::VariantData;
+    if (d->type == VariantData::Null) d->type = VariantData::Object;
+    if (d->type != VariantData::Object) return nullptr;
+    for (auto& m : d->members) { if (ArduinoJsonHost::equals(m.first, key)) return m.second; }
+    // As in ArduinoJson, the slot is taken first and isn't given back if the key doesn't fit
+    if (!allocSlot()) return nullptr;
+    const char* k = saveString(key);
+    if (k == nullptr) return nullptr;
+    VariantData* value = newNode();
+    d->members.emplace_back(k, value);
+    return value;
+  }
+
+  ArduinoJsonHost::VariantData* getOrAddElement(ArduinoJsonHost::VariantData* d, size_t i) {
+    using ArduinoJsonHost::VariantData;
+    if (d->type == VariantData::Null) d->type = VariantData::Array;
+    if (d->type != VariantData::Array) return nullptr;
+    while (d->elements.size() <= i) {
+      if (!allocSlot()) return nullptr;
+      d->elements.push_back(newNode());
+    }
+    return d->elements[i];
+  }
+
+protected:
+  explicit JsonDocument(size_t capacity) : _capacity(ArduinoJsonHost::addPadding(capacity)) { }
+
+private:
+  size_t _capacity;
+  size_t _used = 0;
+  bool   _overflowed = false;
+  ArduinoJsonHost::VariantData _root;
+  std::deque<ArduinoJsonHost::VariantData> _nodes;
+  std::set<std::string> _strings;
+};
+
+template<size_t N>
+class StaticJsonDocument : public JsonDocument {
+public:
+  StaticJsonDocument() : JsonDocument(N) { }
+};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+  explicit DynamicJsonDocument(size_t capacity) : JsonDocument(capacity) { }
+};
+
+
+/*------------------------------------------------------------------------------
+ *
+ * JsonVariant (continued)
+ *
+ *----------------------------------------------------------------------------*/
+
+namespace ArduinoJsonHost {
+  // Copy a value from another document (or this one) into d
+  inline bool copy(JsonDocument* doc, VariantData* d, const VariantData* src) {
+    d->setNull();
+    if (src == nullptr) return true;
+    switch (src->type) {
+      case VariantData::Null: return true;
+      case VariantData::String: {
+        const char* s = doc->saveString({src->s, strlen(src->s), false});
+        if (s == nullptr) return false;
+        d->type = VariantData::String;
+        d->s = s;
+        return true;
+      }
+      case VariantData::Object:
+        d->type = VariantData::Object;
+        for (const auto& m : src->members) {
+          VariantData* v = doc->getOrAddMember(d, {m.first, strlen(m.first), false});
+          if (v == nullptr || !copy(doc, v, m.second)) return false;
+        }
+        return true;
+      case VariantData::Array:
+        d->type = VariantData::Array;
+        for (size_t i = 0; i < src->elements.size(); i++) {
+          VariantData* v = doc->getOrAddElement(d, i);
+          if (v == nullptr || !copy(doc, v, src->elements[i])) return false;
+        }
+        return true;
+      default:
+        d->type = src->type;
+        d->b = src->b;
+        d->i = src->i;
+        d->f = src->f;
+        return true;
+    }
+  }
+
+  inline bool assign(JsonDocument*, VariantData* d, bool v) { d->setNull(); d->type = VariantData::Bool; d->b = v; return true; }
+  inline bool assign(JsonDocument*, VariantData* d, std::nullptr_t) { d->setNull(); return true; }
+
+  template<typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value, bool>::type
+  assign(JsonDocument*, VariantData* d, T v) {
+    d->setNull(); d->type = VariantData::Integer; d->i = (int64_t)v; return true;
+  }
+
+  template<typename T>
+  typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+  assign(JsonDocument*, VariantData* d, T v) {
+    d->setNull(); d->type = VariantData::Float; d->f = v; return true;
+  }
+
+  inline bool assignString(JsonDocument* doc, VariantData* d, const StringRef& r) {
+    d->setNull();
+    const char* s = doc->saveString(r);
+    if (s == nullptr) return false;
+    d->type = VariantData::String;
+    d->s = s;
+    return true;
+  }
+  inline bool assign(JsonDocument* doc, VariantData* d, const char* v) {
+    if (v == nullptr) { d->setNull(); return true; }
+    return assignString(doc, d, ref(v));
+  }
+  inline bool assign(JsonDocument* doc, VariantData* d, char* v) { return assignString(doc, d, ref(v)); }
+  inline bool assign(JsonDocument* doc, VariantData* d, const __FlashStringHelper* v) { return assignString(doc, d, ref(v)); }
+  inline bool assign(JsonDocument* doc, VariantData* d, const ::String& v) { return assignString(doc, d, ref(v)); }
+  inline bool assign(JsonDocument* doc, VariantData* d, const JsonVariantConst& v) { return copy(doc, d, v.data()); }
+  inline bool assign(JsonDocument* doc, VariantData* d, const JsonVariant& v) { return copy(doc, d, v.resolve()); }
+
+  template<>
+  struct Converter<JsonVariant> {
+    static JsonVariant from(JsonDocument* doc, VariantData* d) { return JsonVariant(doc, d); }
+  };
+  template<>
+  struct Converter<JsonObject> {
+    static JsonObject from(JsonDocument* doc, VariantData* d) { return JsonObject(doc, d); }
+  };
+  template<>
+  struct Converter<JsonArray> {
+    static JsonArray from(JsonDocument* doc, VariantData* d) { return JsonArray(doc, d); }
+  };
+
+  // as<T>() for writable references gives writable objects and arrays
+  template<typename T>
+  struct WritableAs {
+    static T get(const JsonVariant& v) { return JsonVariantConst(v.resolve()).as<T>(); }
+  };
+  template<> struct WritableAs<JsonVariant> {
+    static JsonVariant get(const JsonVariant& v) { return JsonVariant(v.document(), v.resolve()); }
+  };
+  template<> struct WritableAs<JsonObject> {
+    static JsonObject get(const JsonVariant& v) { return JsonObject(v.document(), v.resolve()); }
+  };
+  template<> struct WritableAs<JsonArray> {
+    static JsonArray get(const JsonVariant& v) { return JsonArray(v.document(), v.resolve()); }
+  };
+
+  template<typename T> struct To;
+  template<> struct To<JsonObject> {
+    static JsonObject get(JsonDocument* doc, VariantData* d) {
+      if (d == nullptr) return JsonObject();
+      d->setNull();
+      d->type = VariantData::Object;
+      return JsonObject(doc, d);
+    }
+  };
+  template<> struct To<JsonArray> {
+    static JsonArray get(JsonDocument* doc, VariantData* d) {
+      if (d == nullptr) return JsonArray();
+      d->setNull();
+      d->type = VariantData::Array;
+      return JsonArray(doc, d);
+    }
+  };
+  template<> struct To<JsonVariant> {
+    static JsonVariant get(JsonDocument* doc, VariantData* d) {
+      if (d) d->setNull();
+      return JsonVariant(doc, d);
+    }
+  };
+};
+
+inline ArduinoJsonHost::VariantData* JsonVariant::resolve() const {
+  if (_data != nullptr || !_parent) return _data;
+  const ArduinoJsonHost::VariantData* p = _parent->resolve();
+  if (p == nullptr) return nullptr;
+  const ArduinoJsonHost::VariantData* d = _hasKey ? ArduinoJsonHost::member(p, key()) : ArduinoJsonHost::element(p, _index);
+  return const_cast<ArduinoJsonHost::VariantData*>(d);
+}
+
+inline ArduinoJsonHost::VariantData* JsonVariant::getOrCreate() const {
+  if (_data != nullptr || !_parent || _doc == nullptr) return _data;
+  ArduinoJsonHost::VariantData* p = _parent->getOrCreate();
+  if (p == nullptr) return nullptr;
+  _data = _hasKey ? _doc->getOrAddMember(p, key()) : _doc->getOrAddElement(p, _index);
+  return _data;
+}
+
+template<typename T>
+T JsonVariant::as() const { return ArduinoJsonHost::WritableAs<T>::get(*this); }
+
+template<typename T>
+bool JsonVariant::set(const T& value) {
+  ArduinoJsonHost::VariantData* d = getOrCreate();
+  if (d == nullptr) return false;
+  return ArduinoJsonHost::assign(_doc, d, value);
+}
+
+template<typename T>
+T JsonVariant::to() const { return ArduinoJsonHost::To<T>::get(_doc, getOrCreate()); }
+
+template<typename K>
+JsonObject JsonVariant::createNestedObject(const K& key) const { return (*this)[key].template to<JsonObject>(); }
+
+inline JsonObject JsonVariant::createNestedObject() const {
+  ArduinoJsonHost::VariantData* d = getOrCreate();
+  if (d == nullptr) return JsonObject();
+  return JsonVariant(_doc, d)[d->type == ArduinoJsonHost::VariantData::Array ? d->elements.size() : 0]
+      .to<JsonObject>();
+}
+
+template<typename K>
+JsonArray JsonVariant::createNestedArray(const K& key) const { return (*this)[key].template to<JsonArray>(); }
+
+inline JsonArray JsonVariant::createNestedArray() const {
+  ArduinoJsonHost::VariantData* d = getOrCreate();
+  if (d == nullptr) return JsonArray();
+  return JsonVariant(_doc, d)[d->type == ArduinoJsonHost::VariantData::Array ? d->elements.size() : 0]
+      .to<JsonArray>();
+}
+
+template<typename T>
+bool JsonVariant::add(const T& value) const {
+  ArduinoJsonHost::VariantData* d = getOrCreate();
+  if (d == nullptr) return false;
+  size_t i = (d->type == ArduinoJsonHost::VariantData::Array) ? d->elements.size() : 0;
+  return JsonVariant(_doc, d)[i].set(value);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Deserialization
+ *
+ *----------------------------------------------------------------------------*/
+
+namespace DeserializationOption {
+  class Filter {
+  public:
+    explicit Filter(const JsonDocument& doc) : _data(JsonVariantConst(doc).data()) { }
+    explicit Filter(JsonVariantConst v) : _data(v.data()) { }
+    const ArduinoJsonHost::VariantData* data() const { return _data; }
+  private:
+    const ArduinoJsonHost::VariantData* _data;
+  };
+
+  class NestingLimit {
+  public:
+    explicit NestingLimit(uint8_t n = 10) : _n(n) { }
+    uint8_t value() const { return _n; }
+  private:
+    uint8_t _n;
+  };
+};
+
+namespace ArduinoJsonHost {
+  class Reader {
+  public:
+    virtual ~Reader() { }
+    // The next character, or -1 at the end of the input
+    virtual int peek() = 0;
+    virtual int read() = 0;
+  };
+
+  class MemoryReader : public Reader {
+  public:
+    MemoryReader(const char* s, size_t len) : _p(s), _end(s + len) { }
+    int peek() override { return (_p < _end && *_p) ? (uint8_t)*_p : -1; }
+    int read() override { int c = peek(); if (c != -1) _p++; return c; }
+  private:
+    const char* _p;
+    const char* _end;
+  };
+
+  class StreamReader : public Reader {
+  public:
+    explicit StreamReader(Stream& s) : _s(s) { }
+    int peek() override { return _s.peek(); }
+    int read() override { return _s.read(); }
+  private:
+    Stream& _s;
+  };
+
+  // A position in the filter
+  class FilterRef {
+  public:
+    static FilterRef allowAll() { FilterRef f(nullptr); f._all = true; return f; }
+    explicit FilterRef(const VariantData* d) : _d(d) { }
+
+    bool allow() const { return _all || asBool(_d); }
+    bool allowValue() const { return _all || (_d && _d->type == VariantData::Bool && _d->b); }
+    bool allowObject() const { return allowValue() || (_d && _d->type == VariantData::Object); }
+    bool allowArray() const { return allowValue() || (_d && _d->type == VariantData::Array); }
+
+    FilterRef member(const char* key) const {
+      if (allowValue()) return allowAll();
+      const VariantData* m = ArduinoJsonHost::member(_d, ref(key));
+      return FilterRef(m ? m : ArduinoJsonHost::member(_d, ref("*")));
+    }
+    FilterRef element() const {
+      if (allowValue()) return allowAll();
+      return FilterRef(ArduinoJsonHost::element(_d, 0));
+    }
+
+  private:
+    const VariantData* _d;
+    bool _all = false;
+  };
+
+  class Deserializer {
+  public:
+    Deserializer(JsonDocument& doc, Reader& in) : _doc(doc), _in(in) { }
+
+    DeserializationError parse(VariantData* root, FilterRef filter, uint8_t nesting) {
+      skipSpaces();
+      if (_in.peek() == -1) return DeserializationError::EmptyInput;
+      return parseVariant(root, filter, nesting);
+    }
+
+  private:
+    typedef DeserializationError Error;
+    JsonDocument& _doc;
+    Reader& _in;
+
+    void skipSpaces() { while (_in.peek() != -1 && isspace(_in.peek())) _in.read(); }
+
+    Error parseVariant(VariantData* v, FilterRef f, uint8_t nesting) {
+      skipSpaces();
+      int c = _in.peek();
+      if (c == -1) return Error::IncompleteInput;
+      if (c == '{') {
+        if (nesting == 0) return Error::TooDeep;
+        if (!f.allowObject()) return skipVariant(nesting);
+        return parseObject(v, f, nesting);
+      }
+      if (c == '[') {
+        if (nesting == 0) return Error::TooDeep;
+        if (!f.allowArray()) return skipVariant(nesting);
+        return parseArray(v, f, nesting);
+      }
+      if (!f.allowValue()) return skipVariant(nesting);
+      if (c == '"' || c == '\'') {
+        std::string s;
+        Error err = readString(s);
+        if (err) return err;
+        const char* saved = _doc.saveString({s.c_str(), s.length(), false});
+        if (saved == nullptr) return Error::NoMemory;
+        v->type = VariantData::String;
+        v->s = saved;
+        return Error::Ok;
+      }
+      return parseLiteral(v);
+    }
+
+    Error parseObject(VariantData* v, FilterRef f, uint8_t nesting) {
+      _in.read();   // {
+      v->setNull();
+      v->type = VariantData::Object;
+      skipSpaces();
+      if (_in.peek() == '}') { _in.read(); return Error::Ok; }
+      for (;;) {
+        skipSpaces();
+        std::string key;
+        Error err = readString(key);
+        if (err) return err;
+        skipSpaces();
+        int c = _in.read();
+        if (c == -1) return Error::IncompleteInput;
+        if (c != ':') return Error::InvalidInput;
+
+        FilterRef memberFilter = f.member(key.c_str());
+        if (memberFilter.allow()) {
+          VariantData* value = const_cast<VariantData*>(member(v, {key.c_str(), key.length(), false}));
+          if (value == nullptr) {
+            // The key is saved before the slot is taken
+            const char* k = _doc.saveString({key.c_str(), key.length(), false});
+            if (k == nullptr || !_doc.allocSlot()) return Error::NoMemory;
+            value = _doc.newNode();
+            v->members.emplace_back(k, value);
+          }
+          err = parseVariant(value, memberFilter, nesting - 1);
+        } else {
+          err = skipVariant(nesting - 1);
+        }
+        if (err) return err;
+
+        skipSpaces();
+        c = _in.read();
+        if (c == -1) return Error::IncompleteInput;
+        if (c == '}') return Error::Ok;
+        if (c != ',') return Error::InvalidInput;
+      }
+    }
+
+    Error parseArray(VariantData* v, FilterRef f, uint8_t nesting) {
+      _in.read();   // [
+      v->setNull();
+      v->type = VariantData::Array;
+      skipSpaces();
+      if (_in.peek() == ']') { _in.read(); return Error::Ok; }
+      FilterRef elementFilter = f.element();
+      for (;;) {
+        Error err;
+        if (elementFilter.allow()) {
+          if (!_doc.allocSlot()) return Error::NoMemory;
+          VariantData* value = _doc.newNode();
+          v->elements.push_back(value);
+          err = parseVariant(value, elementFilter, nesting - 1);
+        } else {
+          err = skipVariant(nesting - 1);
+        }
+        if (err) return err;
+
+        skipSpaces();
+        int c = _in.read();
+        if (c == -1) return Error::IncompleteInput;
+        if (c == ']') return Error::Ok;
+        if (c != ',') return Error::InvalidInput;
+      }
+    }
+
+    Error skipVariant(uint8_t nesting) {
+      skipSpaces();
+      int c = _in.peek();
+      if (c == -1) return Error::IncompleteInput;
+      if (c == '{' || c == '[') {
+        if (nesting == 0) return Error::TooDeep;
+        int close = (c == '{') ? '}' : ']';
+        _in.read();
+        skipSpaces();
+        if (_in.peek() == close) { _in.read(); return Error::Ok; }
+        for (;;) {
+          if (c == '{') {
+            skipSpaces();
+            std::string key;
+            Error err = readString(key, false);
+            if (err) return err;
+            skipSpaces();
+            if (_in.read() != ':') return Error::InvalidInput;
+          }
+          Error err = skipVariant(nesting - 1);
+          if (err) return err;
+          skipSpaces();
+          int next = _in.read();
+          if (next == -1) return Error::IncompleteInput;
+          if (next == close) return Error::Ok;
+          if (next != ',') return Error::InvalidInput;
+        }
+      }
+      if (c == '"' || c == '\'') {
+        std::string ignored;
+        return readString(ignored, false);
+      }
+      VariantData ignored;
+      return parseLiteral(&ignored);
+    }
+
+    // A string that may be kept (including any key of an object that is
+    // being parsed, even if the filter then drops it) is read into the free
+    // space of the pool, so it must fit there
+    Error readString(std::string& s, bool stored = true) {
+      int quote = _in.read();
+      if (quote == -1) return Error::IncompleteInput;
+      if (quote != '"' && quote != '\'') return Error::InvalidInput;
+      for (;;) {
+        int c = _in.read();
+        if (c == -1) return Error::IncompleteInput;
+        if (c == quote) break;
+        if (c == '\\') {
+          c = _in.read();
+          switch (c) {
+            case -1: return Error::IncompleteInput;
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u': {
+              uint32_t cp = 0;
+              for (int i = 0; i < 4; i++) {
+                int h = _in.read();
+                if (h == -1) return Error::IncompleteInput;
+                if (!isxdigit(h)) return Error::InvalidInput;
+                cp = cp * 16 + (isdigit(h) ? h - '0' : tolower(h) - 'a' + 10);
+              }
+              if (cp < 0x80) { s += (char)cp; }
+              else if (cp < 0x800) { s += (char)(0xC0 | (cp >> 6)); s += (char)(0x80 | (cp & 0x3F)); }
+              else {
+                s += (char)(0xE0 | (cp >> 12));
+                s += (char)(0x80 | ((cp >> 6) & 0x3F));
+                s += (char)(0x80 | (cp & 0x3F));
+              }
+              continue;
+            }
+            default: break;   // " \ / and anything else stand for themselves
+          }
+        }
+        s += (char)c;
+      }
+      if (stored && _doc.available() < s.length() + 1) return Error::NoMemory;
+      return Error::Ok;
+    }
+
+    Error parseLiteral(VariantData* v) {
+      std::string token;
+      while (_in.peek() != -1) {
+        int c = _in.peek();
+        if (!isalnum(c) && c != '+' && c != '-' && c != '.') break;
+        token += (char)_in.read();
+      }
+      if (token.empty()) return _in.peek() == -1 ? Error::IncompleteInput : Error::InvalidInput;
+      v->setNull();
+      if (token == "true" || token == "false") {
+        v->type = VariantData::Bool;
+        v->b = (token == "true");
+        return Error::Ok;
+      }
+      if (token == "null") return Error::Ok;
+
+      char* end;
+      if (token.find_first_of(".eE") == std::string::npos) {
+        errno = 0;
+        long long n = strtoll(token.c_str(), &end, 10);
+        if (*end == '\0' && errno == 0) {
+          v->type = VariantData::Integer;
+          v->i = n;
+          return Error::Ok;
+        }
+      }
+      double f = strtod(token.c_str(), &end);
+      if (*end != '\0') return Error::InvalidInput;
+      v->type = VariantData::Float;
+      v->f = f;
+      return Error::Ok;
+    }
+  };
+
+  inline DeserializationError deserialize(
+      JsonDocument& doc, Reader& in, FilterRef filter, DeserializationOption::NestingLimit limit)
+  {
+    doc.clear();
+    Deserializer d(doc, in);
+    return d.parse(const_cast<VariantData*>(JsonVariantConst(doc).data()), filter, limit.value());
+  }
+};
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const char* input, size_t length,
+    DeserializationOption::Filter filter,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  ArduinoJsonHost::MemoryReader in(input, length);
+  return ArduinoJsonHost::deserialize(doc, in, ArduinoJsonHost::FilterRef(filter.data()), limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const char* input, size_t length,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  ArduinoJsonHost::MemoryReader in(input, length);
+  return ArduinoJsonHost::deserialize(doc, in, ArduinoJsonHost::FilterRef::allowAll(), limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const char* input, DeserializationOption::Filter filter,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  return deserializeJson(doc, input, strlen(input), filter, limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const char* input,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  return deserializeJson(doc, input, strlen(input), limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const String& input, DeserializationOption::Filter filter,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  return deserializeJson(doc, input.c_str(), input.length(), filter, limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, const String& input,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  return deserializeJson(doc, input.c_str(), input.length(), limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, Stream& input, DeserializationOption::Filter filter,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  ArduinoJsonHost::StreamReader in(input);
+  return ArduinoJsonHost::deserialize(doc, in, ArduinoJsonHost::FilterRef(filter.data()), limit);
+}
+
+inline DeserializationError deserializeJson(
+    JsonDocument& doc, Stream& input,
+    DeserializationOption::NestingLimit limit = DeserializationOption::NestingLimit())
+{
+  ArduinoJsonHost::StreamReader in(input);
+  return ArduinoJsonHost::deserialize(doc, in, ArduinoJsonHost::FilterRef::allowAll(), limit);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Serialization
+ *
+ *----------------------------------------------------------------------------*/
+
+namespace ArduinoJsonHost {
+  inline void serializeString(const char* s, std::string& out) {
+    out += '"';
+    for (; *s; s++) {
+      switch (*s) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:   out += *s; break;
+      }
+    }
+    out += '"';
+  }
+
+  inline void serialize(const VariantData* d, std::string& out) {
+    if (d == nullptr) { out += "null"; return; }
+    char buf[32];
+    switch (d->type) {
+      case VariantData::Null:    out += "null"; break;
+      case VariantData::Bool:    out += d->b ? "true" : "false"; break;
+      case VariantData::Integer: out += std::to_string(d->i); break;
+      case VariantData::Float:   snprintf(buf, sizeof(buf), "%.9g", d->f); out += buf; break;
+      case VariantData::String:  serializeString(d->s, out); break;
+      case VariantData::Object:
+        out += '{';
+        for (size_t i = 0; i < d->members.size(); i++) {
+          if (i) out += ',';
+          serializeString(d->members[i].first, out);
+          out += ':';
+          serialize(d->members[i].second, out);
+        }
+        out += '}';
+        break;
+      case VariantData::Array:
+        out += '[';
+        for (size_t i = 0; i < d->elements.size(); i++) {
+          if (i) out += ',';
+          serialize(d->elements[i], out);
+        }
+        out += ']';
+        break;
+    }
+  }
+};
+
+inline size_t serializeJson(JsonVariantConst v, String& out) {
+  std::string s;
+  ArduinoJsonHost::serialize(v.data(), s);
+  out = String(s);
+  return s.length();
+}
+
+inline size_t serializeJson(JsonVariantConst v, std::string& out) {
+  out.clear();
+  ArduinoJsonHost::serialize(v.data(), out);
+  return out.length();
+}
+
+inline size_t serializeJson(const JsonDocument& doc, String& out) { return serializeJson(JsonVariantConst(doc), out); }
+inline size_t serializeJson(const JsonDocument& doc, std::string& out) { return serializeJson(JsonVariantConst(doc), out); }
+
+inline size_t measureJson(JsonVariantConst v) {
+  std::string s;
+  return serializeJson(v, s);
+}
+
+#endif  // ArduinoJson_h
@@ -0,0 +1,32 @@
+/*
+ * ArduinoLog (host)
+ *    A stand-in for ArduinoLog that discards everything
+ *
+ */
+
+#ifndef ArduinoLog_h
+#define ArduinoLog_h
+
+#include <Arduino.h>
+
+#define LOG_LEVEL_SILENT  0
+#define LOG_LEVEL_FATAL   1
+#define LOG_LEVEL_ERROR   2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_NOTICE  4
+#define LOG_LEVEL_TRACE   5
+#define LOG_LEVEL_VERBOSE 6
+
+class Logging {
+public:
+  template<typename F, typename... Args> void fatal(F, Args...) { }
+  template<typename F, typename... Args> void error(F, Args...) { }
+  template<typename F, typename... Args> void warning(F, Args...) { }
+  template<typename F, typename... Args> void notice(F, Args...) { }
+  template<typename F, typename... Args> void trace(F, Args...) { }
+  template<typename F, typename... Args> void verbose(F, Args...) { }
+};
+
+static Logging Log;
+
+#endif  // ArduinoLog_h
@@ -0,0 +1,19 @@
+/*
+ * BPA_PrintClient (host)
+ *    The parts of the PrintClient interface that the host tests' sources use
+ *
+ */
+
+#ifndef PrintClient_h
+#define PrintClient_h
+
+#include <Arduino.h>
+
+class PrintClient {
+public:
+  enum class State {Offline, Operational, Complete, Printing};
+
+  virtual ~PrintClient() { }
+};
+
+#endif  // PrintClient_h
@@ -0,0 +1,25 @@
+/*
+ * BPA_PrinterSettings (host)
+ *    The fields of PrinterSettings that the host tests' sources use
+ *
+ */
+
+#ifndef PrinterSettings_h
+#define PrinterSettings_h
+
+#include <Arduino.h>
+
+class PrinterSettings {
+public:
+  bool     isActive = false;
+  String   nickname;
+  String   type;
+  String   server;
+  uint16_t port = 0;
+  String   apiKey;
+  String   user;
+  String   pass;
+  bool     mock = false;
+};
+
+#endif  // PrinterSettings_h
@@ -0,0 +1,28 @@
+/*
+ * ESP_FS (host)
+ *    A stand-in for WebThing's ESP_FS over the in-memory files of FS.h
+ *
+ */
+
+#ifndef ESP_FS_h
+#define ESP_FS_h
+
+#include <FS.h>
+
+namespace ESP_FS {
+  inline bool begin() { return true; }
+  inline bool exists(const char* path) { return HostFS::files().count(path) != 0; }
+  inline bool remove(const char* path) { return HostFS::files().erase(path) != 0; }
+  inline File open(const char* path, const char* mode) {
+    auto& files = HostFS::files();
+    auto it = files.find(path);
+    if (*mode == 'r') return (it == files.end()) ? File() : File(it->second, false);
+    if (*mode == 'w' || it == files.end()) {
+      files[path] = std::make_shared<std::string>();
+      it = files.find(path);
+    }
+    return File(it->second, *mode == 'a');
+  }
+};
+
+#endif  // ESP_FS_h
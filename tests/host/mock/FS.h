@@ -0,0 +1,71 @@
+/*
+ * FS (host)
+ *    An in-memory stand-in for the Arduino FS File
+ *
+ * NOTES:
+ * o Files live in a map from path to contents that outlives every File, so
+ *   what one File writes can be read by the next (see ESP_FS.h).
+ *
+ */
+
+#ifndef FS_h
+#define FS_h
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <string>
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+namespace HostFS {
+  inline std::map<std::string, std::shared_ptr<std::string>>& files() {
+    static std::map<std::string, std::shared_ptr<std::string>> f;
+    return f;
+  }
+};
+
+class File : public Stream {
+public:
+  File() { }
+  File(std::shared_ptr<std::string> data, bool append) : _data(data), _pos(append ? data->size() : 0) { }
+
+  explicit operator bool() const { return (bool)_data; }
+  void close() { _data.reset(); }
+
+  size_t size() const { return _data ? _data->size() : 0; }
+  size_t position() const { return _pos; }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+    if (!_data) return false;
+    size_t base = (mode == SeekSet) ? 0 : (mode == SeekCur) ? _pos : _data->size();
+    if (base + pos > _data->size()) return false;
+    _pos = base + pos;
+    return true;
+  }
+
+  size_t read(uint8_t* buf, size_t len) {
+    if (!_data) return 0;
+    size_t n = std::min(len, _data->size() - _pos);
+    memcpy(buf, _data->data() + _pos, n);
+    _pos += n;
+    return n;
+  }
+  size_t write(const uint8_t* buf, size_t len) {
+    if (!_data) return 0;
+    if (_pos + len > _data->size()) _data->resize(_pos + len);
+    memcpy(&(*_data)[_pos], buf, len);
+    _pos += len;
+    return len;
+  }
+  size_t write(uint8_t b) { return write(&b, 1); }
+
+  int available() override { return _data ? (int)(_data->size() - _pos) : 0; }
+  int read() override { uint8_t b; return read(&b, 1) ? b : -1; }
+  int peek() override { return (_data && _pos < _data->size()) ? (uint8_t)(*_data)[_pos] : -1; }
+
+private:
+  std::shared_ptr<std::string> _data;
+  size_t _pos = 0;
+};
+
+#endif  // FS_h
@@ -0,0 +1,117 @@
+/*
+ * HTTPClient (host)
+ *    A stand-in for the ESP32 core's HTTPClient that answers each request
+ *    with a handler set by the test instead of going to the network
+ *
+ * NOTES:
+ * o The handler sees the host, port, URI, method, headers, and body of each
+ *   request and returns the status code and body of the response.
+ * o Without a handler, every request fails as if the host couldn't be
+ *   reached.
+ *
+ */
+
+#ifndef HTTPClient_h
+#define HTTPClient_h
+
+#include <Arduino.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+enum t_http_codes {
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_UNAUTHORIZED = 401,
+  HTTP_CODE_NOT_FOUND = 404,
+  HTTP_CODE_SERVICE_UNAVAILABLE = 503
+};
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+// The body of the current response
+class WiFiClient : public Stream {
+public:
+  int available() override { return _body.length() - _pos; }
+  int read() override { return _pos < _body.length() ? (uint8_t)_body[_pos++] : -1; }
+  int peek() override { return _pos < _body.length() ? (uint8_t)_body[_pos] : -1; }
+  void setBody(const String& body) { _body = body.c_str(); _pos = 0; }
+private:
+  std::string _body;
+  size_t _pos = 0;
+};
+
+class HTTPClient {
+public:
+  struct Request {
+    String host;
+    uint16_t port;
+    String uri;
+    String method;
+    std::vector<std::pair<String, String>> headers;
+    String body;
+
+    // The value of a header, or nullptr if it wasn't sent
+    const String* header(const char* name) const {
+      for (const auto& h : headers) { if (h.first.equalsIgnoreCase(name)) return &h.second; }
+      return nullptr;
+    }
+  };
+
+  struct Response {
+    int code;
+    String body;
+  };
+
+  using Handler = std::function<Response(const Request&)>;
+
+  // ----- For the tests
+  static Handler& handler() { static Handler h; return h; }
+  static uint32_t& requests() { static uint32_t n = 0; return n; }
+
+  bool begin(WiFiClient& client, const String& host, uint16_t port, const String& uri = "/", bool https = false) {
+    (void)https;
+    _client = &client;
+    _request = Request();
+    _request.host = host;
+    _request.port = port;
+    _request.uri = uri;
+    return true;
+  }
+  void end() { _client = nullptr; }
+
+  void setTimeout(uint16_t) { }
+  void setReuse(bool) { }
+  void useHTTP10(bool) { }
+  void addHeader(const String& name, const String& value, bool first = false, bool replace = true) {
+    (void)first; (void)replace;
+    _request.headers.emplace_back(name, value);
+  }
+
+  int GET() { return send("GET", String()); }
+  int POST(const String& payload) { return send("POST", payload); }
+
+  int getSize() { return _size; }
+  WiFiClient& getStream() { return *_client; }
+  String getString() {
+    String s;
+    for (int c = _client->read(); c != -1; c = _client->read()) s += (char)c;
+    return s;
+  }
+
+private:
+  WiFiClient* _client = nullptr;
+  Request _request;
+  int _size = -1;
+
+  int send(const char* method, const String& payload) {
+    _request.method = method;
+    _request.body = payload;
+    requests()++;
+    if (!handler()) { _client->setBody(String()); _size = -1; return HTTPC_ERROR_CONNECTION_REFUSED; }
+    Response r = handler()(_request);
+    _client->setBody(r.body);
+    _size = r.body.length();
+    return r.code;
+  }
+};
+
+#endif  // HTTPClient_h
@@ -0,0 +1,147 @@
+/*
+ * TFT_eSPI (host)
+ *    A stand-in for TFT_eSPI with just the parts the host tests use
+ *
+ */
+
+#include "TFT_eSPI.h"
+
+static constexpr uint8_t CASET = 0x2A, PASET = 0x2B, RAMWR = 0x2C;
+
+
+/*------------------------------------------------------------------------------
+ *
+ * TFT_eSPI
+ *
+ *----------------------------------------------------------------------------*/
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : _width(w), _height(h), _fb(w * h, 0) { }
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  spiWrite(CASET); spiWrite16(x0); spiWrite16(x1);
+  spiWrite(PASET); spiWrite16(y0); spiWrite16(y1);
+  spiWrite(RAMWR);
+  addr_row = addr_col = -1;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  // As in TFT_eSPI, a coordinate is only sent when it changes
+  if (addr_col != x) { spiWrite(CASET); spiWrite16(x); spiWrite16(x); addr_col = x; }
+  if (addr_row != y) { spiWrite(PASET); spiWrite16(y); spiWrite16(y); addr_row = y; }
+  spiWrite(RAMWR);
+  spiWrite16(color);
+  _fb[y * _width + x] = color;
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w < 1 || h < 1) return;
+
+  setWindow(x, y, x + w - 1, y + h - 1);
+  for (int32_t r = 0; r < h; r++) {
+    uint16_t* p = &_fb[(y + r) * _width + x];
+    for (int32_t c = 0; c < w; c++) { spiWrite16(color); *p++ = color; }
+  }
+}
+
+void TFT_eSPI::drawBitmap(
+    int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+    uint16_t fgcolor, uint16_t bgcolor)
+{
+  // TFT_eSPI's implementation: a drawPixel() for every pixel
+  startWrite();
+  int32_t byteWidth = (w + 7) / 8;
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) drawPixel(x + i, y + j, fgcolor);
+      else drawPixel(x + i, y + j, bgcolor);
+    }
+  }
+  endWrite();
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * TFT_eSprite
+ *
+ *----------------------------------------------------------------------------*/
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h) {
+  deleteSprite();
+  _iwidth = _dwidth = _bitwidth = w;
+  _dheight = h;
+  size_t bytes;
+  if (_bpp == 16) bytes = w * h * 2;
+  else if (_bpp == 8) bytes = w * h;
+  else if (_bpp == 4) { _iwidth = (w + 1) & ~1; bytes = (_iwidth * h) / 2 + 1; }
+  else { _bpp = 1; _iwidth = _bitwidth = (w + 7) & ~7; bytes = (_bitwidth * h) / 8 + 1; }
+  _img8 = (uint8_t*)calloc(bytes, 1);
+  _created = (_img8 != nullptr);
+  _vpX = _vpY = 0;
+  _vpW = w; _vpH = h;
+  return _img8;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(_img8);
+  _img8 = nullptr;
+  _created = false;
+}
+
+void TFT_eSprite::createPalette(const uint16_t colorMap[16]) {
+  memcpy(_colorMap, colorMap, sizeof(_colorMap));
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (!_created || x < 0 || y < 0 || x >= _dwidth || y >= _dheight) return;
+  if (_bpp == 16) {
+    ((uint16_t*)_img8)[x + y * _iwidth] = (color >> 8) | (color << 8);
+  } else if (_bpp == 8) {
+    _img8[x + y * _iwidth] = color;
+  } else if (_bpp == 4) {
+    uint8_t& b = _img8[(x + y * _iwidth) >> 1];
+    if ((x & 1) == 0) b = (b & 0x0F) | ((color & 0x0F) << 4);
+    else b = (b & 0xF0) | (color & 0x0F);
+  } else {
+    uint8_t& b = _img8[(x + y * _bitwidth) >> 3];
+    if (color) b |= (0x80 >> (x & 7));
+    else b &= ~(0x80 >> (x & 7));
+  }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+  // The same checks as TFT_eSprite::readPixel()
+  if (_vpOoB || !_created) return 0xFFFF;
+  x += _xDatum;
+  y += _yDatum;
+  if ((x < _vpX) || (y < _vpY) || (x >= _vpW) || (y >= _vpH)) return 0xFFFF;
+
+  if (_bpp == 16) {
+    uint16_t color = ((uint16_t*)_img8)[x + y * _iwidth];
+    return (color >> 8) | (color << 8);
+  }
+  if (_bpp == 8) {
+    uint16_t color = _img8[x + y * _iwidth];
+    if (color != 0) {
+      static const uint8_t blue[] = {0, 11, 21, 31};
+      color = (color & 0xE0) << 8 | (color & 0xC0) << 5 | (color & 0x1C) << 6 |
+              (color & 0x1C) << 3 | blue[color & 0x03];
+    }
+    return color;
+  }
+  if (_bpp == 4) {
+    if (x >= _dwidth) return 0xFFFF;
+    if ((x & 0x01) == 0) return _colorMap[_img8[(x + y * _iwidth) >> 1] >> 4];
+    return _colorMap[_img8[(x + y * _iwidth) >> 1] & 0x0F];
+  }
+  if (_rotation == 1) { int32_t t = x; x = _dwidth - y - 1; y = t; }
+  else if (_rotation == 2) { x = _dwidth - x - 1; y = _dheight - y - 1; }
+  else if (_rotation == 3) { int32_t t = x; x = y; y = _dheight - t - 1; }
+  uint16_t color = (_img8[(x + y * _bitwidth) >> 3] << (x & 0x7)) & 0x80;
+  return color ? _tft->bitmap_fg : _tft->bitmap_bg;
+}
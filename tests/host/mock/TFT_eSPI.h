@@ -0,0 +1,91 @@
+/*
+ * TFT_eSPI (host)
+ *    A stand-in for TFT_eSPI with just the parts the host tests use
+ *
+ * NOTES:
+ * o Drawing goes to a framebuffer, so the results of different ways of
+ *   drawing can be compared pixel for pixel.
+ * o Every byte TFT_eSPI would send to the display for a drawPixel() or
+ *   fillRect() is passed through spiWrite(), following TFT_eSPI's own
+ *   implementations (e.g. drawPixel() only sends a coordinate when it
+ *   changes). Timings on the host then reflect both the calls made and the
+ *   traffic they generate.
+ * o TFT_eSprite keeps its pixels in the same layout as the real one, and
+ *   readPixel() makes the same checks, so code that reads a sprite's
+ *   buffer directly can be checked and timed against it.
+ *
+ */
+
+#ifndef TFT_eSPI_h
+#define TFT_eSPI_h
+
+#include <Arduino.h>
+#include <vector>
+
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = 320, int16_t h = 240);
+  virtual ~TFT_eSPI() { }
+
+  uint32_t bitmap_fg = 0xFFFF, bitmap_bg = 0x0000;
+
+  void startWrite() { }
+  void endWrite() { }
+  void setBitmapColor(uint16_t fg, uint16_t bg) { if (fg == bg) bg = ~fg; bitmap_fg = fg; bitmap_bg = bg; }
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t fgcolor, uint16_t bgcolor);
+  void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+  // ----- For the tests
+  uint16_t pixel(int32_t x, int32_t y) const { return _fb[y * _width + x]; }
+  uint32_t bytesSent = 0;
+
+protected:
+  int16_t _width, _height;
+  std::vector<uint16_t> _fb;
+  int32_t addr_row = -1, addr_col = -1;
+  uint32_t _bus = 0;
+
+  void spiWrite(uint8_t b) { _bus = _bus * 31 + b; bytesSent++; }
+  void spiWrite16(uint16_t v) { spiWrite(v >> 8); spiWrite(v); }
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), _tft(tft) { }
+  ~TFT_eSprite() { deleteSprite(); }
+
+  void  setColorDepth(int8_t b) { _bpp = b; }
+  int8_t getColorDepth() const { return _bpp; }
+  void* createSprite(int16_t w, int16_t h);
+  void  deleteSprite();
+  void  createPalette(const uint16_t colorMap[16]);
+  uint16_t getPaletteColor(uint8_t index) const { return _colorMap[index & 0x0F]; }
+  void* getPointer() { return _img8; }
+  int16_t width() const { return _dwidth; }
+  int16_t height() const { return _dheight; }
+  uint8_t getRotation() const { return _rotation; }
+  void  setBitmapColor(uint16_t fg, uint16_t bg) { _tft->setBitmapColor(fg, bg); }
+
+  // 16-bit color, 4-bit palette index, or 0/non-zero for 1-bit sprites
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+
+private:
+  TFT_eSPI* _tft;
+  int8_t   _bpp = 16;
+  bool     _created = false;
+  uint8_t* _img8 = nullptr;
+  int16_t  _iwidth = 0, _dwidth = 0, _bitwidth = 0, _dheight = 0;
+  int32_t  _xDatum = 0, _yDatum = 0;
+  int32_t  _vpX = 0, _vpY = 0, _vpW = 0, _vpH = 0;
+  bool     _vpOoB = false;
+  uint8_t  _rotation = 0;
+  uint16_t _colorMap[16] = {0};
+};
+
+#endif  // TFT_eSPI_h
@@ -0,0 +1,43 @@
+/*
+ * TimeLib (host)
+ *    The parts of the Time library that the host tests' sources use
+ *
+ * NOTES:
+ * o now() follows the simulated clock of Arduino.h from whatever time was
+ *   last given to setTime(). Times are UTC.
+ *
+ */
+
+#ifndef TimeLib_h
+#define TimeLib_h
+
+#include <Arduino.h>
+#include <time.h>
+
+namespace HostTime {
+  // The value of now() when millis() is 0
+  inline time_t& base() { static time_t t = 0; return t; }
+
+  inline struct tm parts(time_t t) { struct tm tm; gmtime_r(&t, &tm); return tm; }
+};
+
+inline time_t now() { return HostTime::base() + millis() / 1000; }
+inline void setTime(time_t t) { HostTime::base() = t - millis() / 1000; }
+
+inline int hour(time_t t) { return HostTime::parts(t).tm_hour; }
+inline int hourFormat12(time_t t) { int h = hour(t) % 12; return h ? h : 12; }
+inline bool isAM(time_t t) { return hour(t) < 12; }
+inline bool isPM(time_t t) { return !isAM(t); }
+inline int minute(time_t t) { return HostTime::parts(t).tm_min; }
+inline int second(time_t t) { return HostTime::parts(t).tm_sec; }
+inline int weekday(time_t t) { return HostTime::parts(t).tm_wday + 1; }   // Sunday is 1
+inline int day(time_t t) { return HostTime::parts(t).tm_mday; }
+inline int month(time_t t) { return HostTime::parts(t).tm_mon + 1; }
+inline int year(time_t t) { return HostTime::parts(t).tm_year + 1900; }
+
+inline const char* dayShortStr(uint8_t day) {
+  static const char* const Names[] = {"Err", "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  return Names[day < 8 ? day : 0];
+}
+
+#endif  // TimeLib_h
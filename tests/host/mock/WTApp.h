@@ -0,0 +1,23 @@
+/*
+ * WTApp (host)
+ *    The parts of WebThing's app singleton that the host tests' sources use
+ *
+ * NOTES:
+ * o Tests that build sources which refer to wtApp define it themselves.
+ *
+ */
+
+#ifndef WTApp_h
+#define WTApp_h
+
+#include <Arduino.h>
+#include <WTAppSettings.h>
+
+class WTApp {
+public:
+  WTAppSettings* settings = nullptr;
+};
+
+extern WTApp* wtApp;
+
+#endif  // WTApp_h
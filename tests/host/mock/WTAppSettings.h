@@ -0,0 +1,23 @@
+/*
+ * WTAppSettings (host)
+ *    The parts of WebThing's app settings that the host tests' sources use
+ *
+ */
+
+#ifndef WTAppSettings_h
+#define WTAppSettings_h
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+class WTAppSettings {
+public:
+  virtual ~WTAppSettings() { }
+  virtual void fromJSON(const JsonDocument& doc) { (void)doc; }
+
+  struct {
+    bool use24Hour = false;
+  } uiOptions;
+};
+
+#endif  // WTAppSettings_h
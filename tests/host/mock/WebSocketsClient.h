@@ -0,0 +1,73 @@
+/*
+ * WebSocketsClient (host)
+ *    A stand-in for the WebSockets library's client. Nothing goes to the
+ *    network: the test delivers events and messages to the client's
+ *    callback with receive() and reads what it sent from sent.
+ *
+ */
+
+#ifndef WebSocketsClient_h
+#define WebSocketsClient_h
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG
+} WStype_t;
+
+class WebSocketsClient {
+public:
+  typedef std::function<void(WStype_t type, uint8_t* payload, size_t length)> WebSocketClientEvent;
+
+  ~WebSocketsClient() { if (latest() == this) latest() = nullptr; }
+
+  void begin(const String& host, uint16_t port, const String& url = "/", const String& protocol = "arduino") {
+    (void)protocol;
+    this->host = host;
+    this->port = port;
+    this->url = url;
+    running = true;
+    latest() = this;
+  }
+  void onEvent(WebSocketClientEvent cb) { _cb = cb; }
+  void setExtraHeaders(const char* extraHeaders = nullptr) { this->extraHeaders = extraHeaders ? extraHeaders : ""; }
+  void setReconnectInterval(unsigned long) { }
+  void loop() { }
+  void disconnect() { running = false; }
+  bool isConnected() { return running; }
+
+  bool sendTXT(const String& payload) { sent.push_back(payload); return true; }
+  bool sendTXT(const char* payload) { sent.push_back(String(payload)); return true; }
+
+  // ----- For the tests
+  static WebSocketsClient*& latest() { static WebSocketsClient* c = nullptr; return c; }
+
+  void receive(WStype_t type, const char* text = "") {
+    std::vector<uint8_t> payload(text, text + strlen(text) + 1);
+    if (_cb) _cb(type, payload.data(), payload.size() - 1);
+  }
+
+  String host;
+  uint16_t port = 0;
+  String url;
+  String extraHeaders;
+  bool running = false;
+  std::vector<String> sent;
+
+private:
+  WebSocketClientEvent _cb;
+};
+
+#endif  // WebSocketsClient_h
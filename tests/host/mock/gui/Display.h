@@ -0,0 +1,33 @@
+/*
+ * Display (host)
+ *    The compile time parts of WebThing's gui/Display.h
+ *
+ * NOTES:
+ * o The panel size defaults to 320x240. Define MM_HOST_PANEL_WIDTH and
+ *   MM_HOST_PANEL_HEIGHT to build for another.
+ *
+ */
+
+#ifndef Display_h
+#define Display_h
+
+#include <Arduino.h>
+
+#if !defined(MM_HOST_PANEL_WIDTH)
+  #define MM_HOST_PANEL_WIDTH 320
+  #define MM_HOST_PANEL_HEIGHT 240
+#endif
+
+class HostDisplay {
+public:
+  static constexpr uint16_t Width = MM_HOST_PANEL_WIDTH;
+  static constexpr uint16_t Height = MM_HOST_PANEL_HEIGHT;
+  static constexpr uint16_t XCenter = Width/2;
+  static constexpr uint16_t YCenter = Height/2;
+
+  enum FontID { M9, MB9, MO9, SB9, S12, SB12, SB18, SB24, D20, D72, D100, SBO24 };
+};
+
+static HostDisplay Display;
+
+#endif  // Display_h
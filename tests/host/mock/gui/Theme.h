@@ -0,0 +1,17 @@
+/*
+ * Theme (host)
+ *    The colors of WebThing's gui/Theme.h that the host tests' sources use
+ *
+ */
+
+#ifndef Theme_h
+#define Theme_h
+
+#include <Arduino.h>
+
+namespace Theme {
+  static constexpr uint16_t Color_Background = 0x0000;
+  static constexpr uint16_t Color_NormalText = 0xFFFF;
+};
+
+#endif  // Theme_h
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""
+moonraker_stub: A local stand-in for a Moonraker (Klipper) server
+
+Serves just enough of Moonraker's websocket API (/websocket) for MultiMon
+to monitor it: printer.objects.subscribe, followed by notify_status_update
+messages that carry only the fields that changed. It simulates a print that
+starts shortly after launch and finishes after --duration seconds, then
+repeats. With --klippy-restart, Klipper is "restarted" periodically, which
+drops the subscription until notify_klippy_ready is sent.
+
+The status notifications sent over the socket and their bytes are counted
+and reported periodically.
+
+Usage:
+  moonraker_stub.py [--port 7125] [--duration 120] [--idle 10] [--api-key KEY]
+
+Configure a MultiMon printer of type Moonraker with this machine's address,
+the chosen port, and the API key if one was given.
+"""
+
+import argparse
+import base64
+import hashlib
+import json
+import random
+import socketserver
+import struct
+import threading
+import time
+from http.server import BaseHTTPRequestHandler
+
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+NOTIFY_INTERVAL = 0.25   # Moonraker batches status updates at about this rate
+FILENAME = "stub_part.gcode"
+
+
+class Simulation:
+    """A print job that cycles between idle and printing"""
+
+    def __init__(self, duration, idle, klippy_restart):
+        self.duration = duration
+        self.idle = idle
+        self.klippy_restart = klippy_restart
+        self.start = time.time()
+        self.lock = threading.Lock()
+        self.stats = {"connections": 0, "subscriptions": 0, "notifications": 0, "notifyBytes": 0}
+
+    def klippy_ready(self):
+        if not self.klippy_restart:
+            return True
+        # Klipper is down for 5 seconds out of every klippy_restart
+        return (time.time() - self.start) % self.klippy_restart >= 5
+
+    def phase(self):
+        cycle = self.idle + self.duration
+        elapsed = time.time() - self.start
+        t = elapsed % cycle
+        if t < self.idle:
+            return ("complete" if elapsed >= cycle else "standby"), None
+        return "printing", (t - self.idle) / self.duration
+
+    def status(self):
+        """The full value of every field MultiMon subscribes to"""
+        state, progress = self.phase()
+        printing = state == "printing"
+        return {
+            "print_stats": {
+                "state": state,
+                "filename": FILENAME if state != "standby" else "",
+                "print_duration": round(progress * self.duration, 1) if printing else 0.0,
+            },
+            "display_status": {"progress": round(progress, 3) if printing else 0.0},
+            "heater_bed": {"temperature": round(60 + random.uniform(-0.3, 0.3), 2),
+                           "target": 60.0 if printing else 0.0},
+            "extruder": {"temperature": round(215 + random.uniform(-0.6, 0.6), 2),
+                         "target": 215.0 if printing else 0.0},
+        }
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+
+def changed_fields(previous, current):
+    """The fields of current whose values differ from those in previous"""
+    diff = {}
+    for name, fields in current.items():
+        changed = {k: v for k, v in fields.items() if previous.get(name, {}).get(k) != v}
+        if changed:
+            diff[name] = changed
+    return diff
+
+
+class Handler(BaseHTTPRequestHandler):
+    sim = None
+    api_key = None
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def send_json(self, obj, code=200):
+        body = json.dumps(obj).encode()
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def do_GET(self):
+        path = self.path.split("?")[0]
+        if self.api_key and self.headers.get("X-Api-Key") != self.api_key:
+            self.send_json({"error": {"code": 401, "message": "Unauthorized"}}, 401)
+        elif path == "/websocket" and self.headers.get("Upgrade", "").lower() == "websocket":
+            self.serve_websocket()
+        elif path == "/server/info":
+            state = "ready" if self.sim.klippy_ready() else "shutdown"
+            self.send_json({"result": {"klippy_connected": True, "klippy_state": state,
+                                       "moonraker_version": "stub"}})
+        else:
+            self.send_json({"error": {"code": 404, "message": "Not Found"}}, 404)
+
+    # ----- Websocket API
+
+    def ws_send(self, obj):
+        payload = json.dumps(obj).encode()
+        header = bytearray([0x81])
+        if len(payload) < 126:
+            header.append(len(payload))
+        elif len(payload) < 65536:
+            header.append(126)
+            header += struct.pack(">H", len(payload))
+        else:
+            header.append(127)
+            header += struct.pack(">Q", len(payload))
+        self.connection.sendall(bytes(header) + payload)
+        return len(header) + len(payload)
+
+    def ws_receive(self):
+        """Return the next text message, None on close"""
+        head = self.rfile.read(2)
+        if len(head) < 2:
+            return None
+        opcode = head[0] & 0x0F
+        length = head[1] & 0x7F
+        if length == 126:
+            length = struct.unpack(">H", self.rfile.read(2))[0]
+        elif length == 127:
+            length = struct.unpack(">Q", self.rfile.read(8))[0]
+        mask = self.rfile.read(4) if head[1] & 0x80 else b"\0\0\0\0"
+        data = bytes(b ^ mask[i % 4] for i, b in enumerate(self.rfile.read(length)))
+        if opcode == 0x8:
+            return None
+        return data.decode(errors="replace") if opcode == 0x1 else ""
+
+    def serve_websocket(self):
+        key = self.headers.get("Sec-WebSocket-Key", "")
+        accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode()).digest()).decode()
+        self.send_response(101)
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept)
+        self.end_headers()
+        self.sim.count("connections")
+        print("ws: client connected")
+
+        # Shared with the reader thread. last is what the client was last sent.
+        state = {"alive": True, "subscribed": False, "last": None}
+        send_lock = threading.Lock()
+
+        def send(obj):
+            with send_lock:
+                return self.ws_send(obj)
+
+        def reader():
+            while state["alive"]:
+                try:
+                    msg = self.ws_receive()
+                except OSError:
+                    msg = None
+                if msg is None:
+                    state["alive"] = False
+                    break
+                try:
+                    request = json.loads(msg) if msg else {}
+                except ValueError:
+                    continue
+                if request.get("method") != "printer.objects.subscribe":
+                    send({"jsonrpc": "2.0", "id": request.get("id"),
+                          "error": {"code": -32601, "message": "Method not found"}})
+                    continue
+                if not self.sim.klippy_ready():
+                    send({"jsonrpc": "2.0", "id": request.get("id"),
+                          "error": {"code": 503, "message": "Klippy Disconnected"}})
+                    continue
+                objects = request.get("params", {}).get("objects", {})
+                full = self.sim.status()
+                status = {name: {k: v for k, v in full[name].items() if not fields or k in fields}
+                          for name, fields in objects.items() if name in full}
+                state["last"] = full
+                state["subscribed"] = True
+                self.sim.count("subscriptions")
+                sent = send({"jsonrpc": "2.0", "id": request.get("id"),
+                             "result": {"eventtime": time.time(), "status": status}})
+                print("ws: subscribed to %s (%d bytes)" % (", ".join(status), sent))
+
+        threading.Thread(target=reader, daemon=True).start()
+        ready = self.sim.klippy_ready()
+        try:
+            while state["alive"]:
+                now_ready = self.sim.klippy_ready()
+                if now_ready != ready:
+                    ready = now_ready
+                    state["subscribed"] = False
+                    method = "notify_klippy_ready" if ready else "notify_klippy_shutdown"
+                    print("ws:", method)
+                    send({"jsonrpc": "2.0", "method": method})
+                if state["subscribed"]:
+                    current = self.sim.status()
+                    diff = changed_fields(state["last"], current)
+                    state["last"] = current
+                    if diff:
+                        sent = send({"jsonrpc": "2.0", "method": "notify_status_update",
+                                     "params": [diff, time.time()]})
+                        self.sim.count("notifications")
+                        self.sim.count("notifyBytes", sent)
+                time.sleep(NOTIFY_INTERVAL)
+        except OSError:
+            pass
+        state["alive"] = False
+        self.close_connection = True
+        print("ws: client disconnected")
+
+
+class Server(socketserver.ThreadingMixIn, socketserver.TCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def report(sim, interval):
+    while True:
+        time.sleep(interval)
+        state, progress = sim.phase()
+        pct = "" if progress is None else " %.0f%%" % (progress * 100)
+        print("[%s%s] %s" % (state, pct, json.dumps(sim.stats)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local stand-in for a Moonraker server")
+    parser.add_argument("--port", type=int, default=7125)
+    parser.add_argument("--duration", type=int, default=120, help="length of the simulated print (s)")
+    parser.add_argument("--idle", type=int, default=10, help="idle time between prints (s)")
+    parser.add_argument("--api-key", help="require this X-Api-Key on every request")
+    parser.add_argument("--klippy-restart", type=int, default=0,
+                        help="restart Klipper every N seconds (0 to never restart)")
+    parser.add_argument("--report", type=int, default=30, help="seconds between traffic reports")
+    args = parser.parse_args()
+
+    Handler.sim = Simulation(args.duration, args.idle, args.klippy_restart)
+    Handler.api_key = args.api_key
+    threading.Thread(target=report, args=(Handler.sim, args.report), daemon=True).start()
+    with Server(("", args.port), Handler) as server:
+        print("Moonraker stub listening on port %d" % args.port)
+        server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""
+octoprint_stub: A local stand-in for an OctoPrint server
+
+Serves just enough of OctoPrint's REST API for MultiMon to poll it, plus
+the push API (/sockjs/websocket) used when "Use OctoPrint push updates"
+is enabled. It simulates a print that starts shortly after launch and
+finishes after --duration seconds, then repeats.
+
+Every HTTP request and the bytes sent over HTTP and the push socket are
+counted and reported periodically. That makes it easy to compare the
+traffic with push updates enabled and disabled.
+
+Usage:
+  octoprint_stub.py [--port 5000] [--duration 120] [--idle 10]
+
+Configure a MultiMon printer of type OctoPrint with this machine's address,
+the chosen port, and any API key.
+"""
+
+import argparse
+import base64
+import hashlib
+import json
+import socketserver
+import struct
+import threading
+import time
+from http.server import BaseHTTPRequestHandler
+
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+BASE_PUSH_INTERVAL = 0.5   # OctoPrint's base rate for "current" messages
+
+
+class Simulation:
+    """A print job that cycles between idle and printing"""
+
+    def __init__(self, duration, idle):
+        self.duration = duration
+        self.idle = idle
+        self.start = time.time()
+        self.lock = threading.Lock()
+        self.listeners = []
+        self.last_state = None
+        self.stats = {"requests": 0, "httpBytes": 0, "pushMessages": 0, "pushBytes": 0}
+
+    def phase(self):
+        cycle = self.idle + self.duration
+        t = (time.time() - self.start) % cycle
+        if t < self.idle:
+            return "Operational", None
+        return "Printing", 100.0 * (t - self.idle) / self.duration
+
+    def current(self):
+        state, pct = self.phase()
+        printing = state == "Printing"
+        elapsed = int(pct * self.duration / 100) if printing else None
+        left = self.duration - elapsed if printing else None
+        return {
+            "state": {
+                "text": state,
+                "flags": {"operational": True, "printing": printing, "paused": False,
+                          "ready": not printing, "error": False, "closedOrError": False}
+            },
+            "job": {"file": {"name": "stub_part.gcode" if printing else None},
+                    "estimatedPrintTime": self.duration},
+            "progress": {"completion": pct, "printTime": elapsed, "printTimeLeft": left},
+            "temps": [{"time": int(time.time()),
+                       "bed": {"actual": 60.1, "target": 60.0},
+                       "tool0": {"actual": 215.3, "target": 215.0}}],
+            "logs": ["Send: M105", "Recv: ok T:215.3 /215.0 B:60.1 /60.0"] * 10,
+            "messages": ["ok T:215.3 /215.0 B:60.1 /60.0"] * 10,
+        }
+
+    def check_transitions(self):
+        state, _ = self.phase()
+        with self.lock:
+            previous, self.last_state = self.last_state, state
+        if previous is None or previous == state:
+            return None
+        return "PrintStarted" if state == "Printing" else "PrintDone"
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+
+class Handler(BaseHTTPRequestHandler):
+    sim = None
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def send_json(self, obj, code=200):
+        body = json.dumps(obj).encode()
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+        self.sim.count("requests")
+        self.sim.count("httpBytes", len(body))
+
+    def do_POST(self):
+        length = int(self.headers.get("Content-Length", 0))
+        self.rfile.read(length)
+        if self.path.startswith("/api/login"):
+            self.send_json({"name": "multimon", "session": "stub-session", "active": True})
+        else:
+            self.send_json({"error": "not found"}, 404)
+
+    def do_GET(self):
+        path = self.path.split("?")[0]
+        if path == "/sockjs/websocket" and self.headers.get("Upgrade", "").lower() == "websocket":
+            self.serve_push()
+            return
+
+        cur = self.sim.current()
+        if path == "/api/version":
+            self.send_json({"api": "0.1", "server": "1.9.0", "text": "OctoPrint (stub)"})
+        elif path == "/api/job":
+            self.send_json({"job": cur["job"], "progress": cur["progress"], "state": cur["state"]["text"]})
+        elif path == "/api/printer":
+            self.send_json({"state": cur["state"],
+                            "temperature": {"bed": cur["temps"][0]["bed"], "tool0": cur["temps"][0]["tool0"]}})
+        elif path == "/api/connection":
+            self.send_json({"current": {"state": cur["state"]["text"], "port": "/dev/ttyUSB0"}})
+        else:
+            self.send_json({"error": "not found"}, 404)
+
+    # ----- Push API
+
+    def ws_send(self, obj):
+        payload = json.dumps(obj).encode()
+        header = bytearray([0x81])
+        if len(payload) < 126:
+            header.append(len(payload))
+        elif len(payload) < 65536:
+            header.append(126)
+            header += struct.pack(">H", len(payload))
+        else:
+            header.append(127)
+            header += struct.pack(">Q", len(payload))
+        self.connection.sendall(bytes(header) + payload)
+        self.sim.count("pushMessages")
+        self.sim.count("pushBytes", len(header) + len(payload))
+
+    def ws_receive(self):
+        """Return the next text message, None on close. Non-blocking reads time out."""
+        head = self.rfile.read(2)
+        if len(head) < 2:
+            return None
+        opcode = head[0] & 0x0F
+        length = head[1] & 0x7F
+        if length == 126:
+            length = struct.unpack(">H", self.rfile.read(2))[0]
+        elif length == 127:
+            length = struct.unpack(">Q", self.rfile.read(8))[0]
+        mask = self.rfile.read(4) if head[1] & 0x80 else b"\0\0\0\0"
+        data = bytes(b ^ mask[i % 4] for i, b in enumerate(self.rfile.read(length)))
+        if opcode == 0x8:
+            return None
+        return data.decode(errors="replace") if opcode == 0x1 else ""
+
+    def serve_push(self):
+        key = self.headers.get("Sec-WebSocket-Key", "")
+        accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode()).digest()).decode()
+        self.send_response(101)
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept)
+        self.end_headers()
+        self.sim.count("requests")
+
+        state = {"auth": False, "throttle": 1, "alive": True}
+
+        def reader():
+            while state["alive"]:
+                try:
+                    msg = self.ws_receive()
+                except OSError:
+                    msg = None
+                if msg is None:
+                    state["alive"] = False
+                    break
+                try:
+                    obj = json.loads(msg) if msg else {}
+                except ValueError:
+                    continue
+                if "auth" in obj:
+                    state["auth"] = True
+                    print("push: client authenticated as", obj["auth"].split(":")[0])
+                if "throttle" in obj:
+                    state["throttle"] = max(1, int(obj["throttle"]))
+                    print("push: throttle set to", state["throttle"])
+
+        threading.Thread(target=reader, daemon=True).start()
+        try:
+            self.ws_send({"connected": {"version": "1.9.0", "apikey": None, "plugin_hash": "stub"}})
+            next_current = 0
+            while state["alive"]:
+                if state["auth"]:
+                    event = self.sim.check_transitions()
+                    if event:
+                        print("push: event", event)
+                        self.ws_send({"event": {"type": event, "payload": {"name": "stub_part.gcode"}}})
+                    if time.time() >= next_current:
+                        self.ws_send({"current": self.sim.current()})
+                        next_current = time.time() + BASE_PUSH_INTERVAL * state["throttle"]
+                time.sleep(0.05)
+        except OSError:
+            pass
+        state["alive"] = False
+        self.close_connection = True
+        print("push: client disconnected")
+
+
+class Server(socketserver.ThreadingMixIn, socketserver.TCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def report(sim, interval):
+    while True:
+        time.sleep(interval)
+        state, pct = sim.phase()
+        progress = "" if pct is None else " %.0f%%" % pct
+        print("[%s%s] %s" % (state, progress, json.dumps(sim.stats)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local stand-in for an OctoPrint server")
+    parser.add_argument("--port", type=int, default=5000)
+    parser.add_argument("--duration", type=int, default=120, help="length of the simulated print (s)")
+    parser.add_argument("--idle", type=int, default=10, help="idle time between prints (s)")
+    parser.add_argument("--report", type=int, default=30, help="seconds between traffic reports")
+    args = parser.parse_args()
+
+    Handler.sim = Simulation(args.duration, args.idle)
+    threading.Thread(target=report, args=(Handler.sim, args.report), daemon=True).start()
+    with Server(("", args.port), Handler) as server:
+        print("OctoPrint stub listening on port %d" % args.port)
+        server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
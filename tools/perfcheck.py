@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+perfcheck: Run MultiMon's on-device benchmark suite and check for regressions
+
+The device runs the suite when it receives /perf?run=N and returns the
+timing for each case as JSON. This script saves those results to a file
+and compares the mean time of each case against the stored baselines.
+It exits with a non-zero status if any case is slower than its baseline
+by more than the threshold.
+
+Usage:
+  perfcheck.py HOST [--iterations N] [--user U --password P]
+               [--baselines FILE] [--out FILE] [--update]
+"""
+
+import argparse
+import base64
+import json
+import os
+import sys
+import urllib.request
+
+DEFAULT_BASELINES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "perf_baselines.json")
+
+
+def fetch_results(host, iterations, user, password):
+    url = "http://%s/perf?run=%d" % (host, iterations)
+    request = urllib.request.Request(url)
+    if user:
+        token = base64.b64encode(("%s:%s" % (user, password)).encode()).decode()
+        request.add_header("Authorization", "Basic " + token)
+    # Running the suite redraws the display and polls every printer, so allow
+    # considerably more time than a typical page load
+    with urllib.request.urlopen(request, timeout=60 + 15 * iterations) as response:
+        return json.load(response)
+
+
+def compare(results, baselines):
+    threshold = baselines.get("thresholdPct", 15)
+    regressions = []
+    print("%-18s %10s %10s %8s" % ("case", "baseline", "mean", "delta"))
+    for name, stat in sorted(results.get("cases", {}).items()):
+        base = baselines.get("cases", {}).get(name)
+        mean = stat["mean"]
+        if not base:
+            print("%-18s %10s %10d %8s" % (name, "-", mean, "new"))
+            continue
+        delta = 100.0 * (mean - base) / base
+        flag = ""
+        if delta > threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print("%-18s %10d %10d %+7.1f%%%s" % (name, base, mean, delta, flag))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="MultiMon benchmark regression check")
+    parser.add_argument("host", help="hostname or IP address of the MultiMon device")
+    parser.add_argument("--iterations", type=int, default=5)
+    parser.add_argument("--user", default="")
+    parser.add_argument("--password", default="")
+    parser.add_argument("--baselines", default=DEFAULT_BASELINES)
+    parser.add_argument("--out", default="perf_results.json")
+    parser.add_argument("--update", action="store_true",
+                        help="store the results as the new baselines rather than checking them")
+    args = parser.parse_args()
+
+    results = fetch_results(args.host, args.iterations, args.user, args.password)
+    with open(args.out, "w") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+
+    run = results.get("run", {})
+    if not run.get("mockOnly", False):
+        print("WARNING: the pollCycle case includes real (non-mock) printers")
+
+    with open(args.baselines) as f:
+        baselines = json.load(f)
+
+    if args.update:
+        baselines["cases"] = {name: stat["mean"] for name, stat in results.get("cases", {}).items()}
+        with open(args.baselines, "w") as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("Baselines updated in %s" % args.baselines)
+        return 0
+
+    regressions = compare(results, baselines)
+    if regressions:
+        print("FAILED: %d case(s) exceeded the %s%% threshold: %s" %
+              (len(regressions), baselines.get("thresholdPct", 15), ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
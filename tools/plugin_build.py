@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+plugin_build: Check MultiMon's plugin descriptors and prepare them for upload
+
+Every plugin directory under data/plugins is parsed and checked against the
+rules in doc/PluginGuide.md: the required files are present and valid JSON,
+screen items have the required fields and valid justification, font, color
+and type values, formats match their types, items fit on the display, and
+the settings and form refer to the same fields. Problems that would stop a
+plugin from loading are errors; anything merely suspicious is a warning.
+
+With --out, a copy of the data directory is written with each plugin's
+JSON minified and normalized: colors are written as 0xRRGGBB, types in
+upper case, and optional screen fields that hold their default values are
+dropped. The device parses these with its usual JSON loader, but has fewer
+bytes to read from flash and parse for each plugin at boot. Upload the copy
+in place of data/ (for example, by pointing mklittlefs at it).
+
+Usage:
+  plugin_build.py [--data data] [--out DIR] [--width 320 --height 240]
+
+Exits with a non-zero status if there are any errors.
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import sys
+
+DESCRIPTORS = ["plugin.json", "settings.json", "form.json", "screen.json"]
+# A plugin may ship sample.json as a template for settings.json instead
+SETTINGS_TEMPLATE = "sample.json"
+
+JUSTIFICATIONS = {"TL", "TC", "TR", "ML", "MC", "MR", "BL", "BC", "BR"}
+FONT = re.compile(r"^(\d|M(B|O|BO)?9|S(B|O|BO)?(9|12|18|24)|D(20|72|100))$")
+COLOR = re.compile(r"^(0x|#)?([0-9A-Fa-f]{6})$")
+KEY = re.compile(r"^\$([SPWE])\.")
+PRINTER_KEY = re.compile(r"^\$P\.(next|[1-4]\.(name|pct|next|remaining|status))$")
+CONVERSION = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l)?([diuxXfFeEgGs%])")
+
+# The conversions each value type may use, in order where it matters
+TYPE_CONVERSIONS = {
+    "INT": re.compile(r"^[diuxX]$"),
+    "FLOAT": re.compile(r"^[fFeEgG]$"),
+    "STRING": re.compile(r"^s$"),
+    "BOOL": re.compile(r"^[dis]$"),
+    "CLOCK": re.compile(r"^[di]{2,3}$"),
+    "STATUS": re.compile(r"^s[di]$"),
+}
+
+# Optional screen item fields and their defaults (see doc/PluginGuide.md)
+ITEM_DEFAULTS = {"xOff": 0, "yOff": 0, "justify": "TL", "font": "2"}
+
+
+class Report:
+    def __init__(self):
+        self.errors = 0
+        self.warnings = 0
+
+    def error(self, where, msg):
+        self.errors += 1
+        print("error: %s: %s" % (where, msg))
+
+    def warn(self, where, msg):
+        self.warnings += 1
+        print("warning: %s: %s" % (where, msg))
+
+
+def load(path, report):
+    try:
+        with open(path) as f:
+            return json.load(f)
+    except ValueError as e:
+        report.error(path, "invalid JSON: %s" % e)
+    except OSError as e:
+        report.error(path, str(e))
+    return None
+
+
+def check_plugin(plugin, path, report):
+    for field in ("type", "name"):
+        if not isinstance(plugin.get(field), str) or not plugin[field]:
+            report.error(path, "missing \"%s\"" % field)
+    namespace = plugin.get("namespace")
+    if namespace is not None and not re.match(r"^[A-Za-z0-9]+$", str(namespace)):
+        report.error(path, "namespace \"%s\" must be letters and digits" % namespace)
+
+
+def check_item(item, where, namespaces, size, report):
+    for field in ("x", "y", "w", "h"):
+        if not isinstance(item.get(field), int):
+            report.error(where, "\"%s\" is required and must be an integer" % field)
+            return
+    if "color" not in item:
+        report.error(where, "\"color\" is required")
+    elif not COLOR.match(str(item["color"])):
+        report.error(where, "color \"%s\" is not a 24-bit hex color" % item["color"])
+    if "justify" in item and item["justify"] not in JUSTIFICATIONS:
+        report.error(where, "unknown justification \"%s\"" % item["justify"])
+    if "font" in item and not FONT.match(str(item["font"])):
+        report.error(where, "unknown font \"%s\"" % item["font"])
+
+    width, height = size
+    if item["x"] < 0 or item["y"] < 0 or item["x"] + item["w"] > width or item["y"] + item["h"] > height:
+        report.warn(where, "extends beyond the %dx%d display" % size)
+
+    fmt = item.get("format")
+    value_type = str(item.get("type", "")).upper()
+    key = item.get("key")
+    if fmt is None:
+        if "strokeWidth" not in item:
+            report.warn(where, "has neither a format nor a border, so nothing is drawn")
+        return
+    conversions = "".join(c for c in CONVERSION.findall(fmt) if c != "%")
+
+    if key is None:
+        if conversions:
+            report.error(where, "format \"%s\" expects a value but there is no key" % fmt)
+        return
+    if value_type not in TYPE_CONVERSIONS:
+        report.error(where, "unknown type \"%s\"" % item.get("type"))
+        return
+    if fmt.startswith("#"):
+        if fmt != "#progress":
+            report.error(where, "unknown display element \"%s\"" % fmt)
+        elif value_type != "STATUS":
+            report.error(where, "#progress needs a STATUS value")
+    elif not TYPE_CONVERSIONS[value_type].match(conversions):
+        report.error(where, "format \"%s\" doesn't match type %s" % (fmt, value_type))
+
+    match = KEY.match(key)
+    if match and match.group(1) == "P" and not PRINTER_KEY.match(key):
+        report.warn(where, "unknown printer key \"%s\"" % key)
+    elif match and match.group(1) == "E":
+        namespace = key.split(".")[1] if key.count(".") >= 2 else ""
+        if namespace not in namespaces:
+            report.warn(where, "no plugin publishes the namespace of \"%s\"" % key)
+    elif not match and key.startswith("$"):
+        report.error(where, "unknown namespace in key \"%s\"" % key)
+
+
+def check_screen(screen, path, namespaces, size, report):
+    if not isinstance(screen.get("items"), list) or not screen["items"]:
+        report.error(path, "\"items\" must be a non-empty array")
+        return
+    if "bkg" in screen and not COLOR.match(str(screen["bkg"])):
+        report.error(path, "bkg \"%s\" is not a 24-bit hex color" % screen["bkg"])
+    for i, item in enumerate(screen["items"]):
+        where = "%s: item %d" % (path, i)
+        if not isinstance(item, dict):
+            report.error(where, "must be an object")
+            continue
+        check_item(item, where, namespaces, size, report)
+
+
+def check_form(form, settings, path, report):
+    schema = form.get("schema")
+    if not isinstance(schema, dict) or not isinstance(form.get("form"), list):
+        report.error(path, "must have a \"schema\" object and a \"form\" array")
+        return
+    for entry in form["form"]:
+        if isinstance(entry, str):
+            fields = [entry]
+        else:
+            # Fieldsets list their fields as items
+            fields = [entry["key"]] if "key" in entry else []
+            fields += [e for e in entry.get("items", []) if isinstance(e, str)]
+        for field in fields:
+            if field not in schema:
+                report.error(path, "form refers to \"%s\", which isn't in the schema" % field)
+    if settings is not None:
+        for field in settings:
+            if field != "version" and field not in schema:
+                report.warn(path, "setting \"%s\" can't be edited; it isn't in the schema" % field)
+
+
+def normalize_color(value):
+    return "0x" + COLOR.match(str(value)).group(2).upper()
+
+
+def compact_screen(screen):
+    screen = dict(screen)
+    if "bkg" in screen:
+        screen["bkg"] = normalize_color(screen["bkg"])
+    items = []
+    for item in screen["items"]:
+        item = {k: v for k, v in item.items() if ITEM_DEFAULTS.get(k, None) != v}
+        item["color"] = normalize_color(item["color"])
+        if "type" in item:
+            item["type"] = str(item["type"]).upper()
+        items.append(item)
+    screen["items"] = items
+    return screen
+
+
+def write_compact(obj, path):
+    with open(path, "w") as f:
+        json.dump(obj, f, separators=(",", ":"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check and minify MultiMon plugin descriptors")
+    parser.add_argument("--data", default=os.path.relpath(os.path.join(os.path.dirname(__file__), "..", "data")))
+    parser.add_argument("--out", help="write a copy of the data directory with compacted plugins here")
+    parser.add_argument("--width", type=int, default=320)
+    parser.add_argument("--height", type=int, default=240)
+    args = parser.parse_args()
+
+    report = Report()
+    plugins_dir = os.path.join(args.data, "plugins")
+    dirs = sorted(d for d in os.listdir(plugins_dir) if os.path.isdir(os.path.join(plugins_dir, d)))
+
+    # Load everything first; screens may refer to any plugin's namespace
+    plugins = {}
+    for name in dirs:
+        base = os.path.join(plugins_dir, name)
+        files = {}
+        for descriptor in DESCRIPTORS + [SETTINGS_TEMPLATE]:
+            path = os.path.join(base, descriptor)
+            if os.path.exists(path):
+                files[descriptor] = load(path, report)
+        if "settings.json" not in files and SETTINGS_TEMPLATE not in files:
+            report.error(base, "has neither settings.json nor %s" % SETTINGS_TEMPLATE)
+        for descriptor in ("plugin.json", "form.json", "screen.json"):
+            if descriptor not in files:
+                report.error(base, "missing %s" % descriptor)
+        plugins[name] = files
+    namespaces = {f["plugin.json"].get("namespace") for f in plugins.values() if f.get("plugin.json")}
+
+    for name, files in plugins.items():
+        base = os.path.join(plugins_dir, name)
+        if files.get("plugin.json") is not None:
+            check_plugin(files["plugin.json"], os.path.join(base, "plugin.json"), report)
+        if files.get("screen.json") is not None:
+            check_screen(files["screen.json"], os.path.join(base, "screen.json"), namespaces,
+                         (args.width, args.height), report)
+        settings = files.get("settings.json") or files.get(SETTINGS_TEMPLATE)
+        if files.get("form.json") is not None:
+            check_form(files["form.json"], settings, os.path.join(base, "form.json"), report)
+
+    print("%d plugins: %d errors, %d warnings" % (len(plugins), report.errors, report.warnings))
+    if report.errors:
+        return 1
+    if not args.out:
+        return 0
+
+    if os.path.exists(args.out):
+        shutil.rmtree(args.out)
+    shutil.copytree(args.data, args.out)
+    before = after = 0
+    for name, files in plugins.items():
+        for descriptor, obj in files.items():
+            path = os.path.join(args.out, "plugins", name, descriptor)
+            before += os.path.getsize(path)
+            write_compact(compact_screen(obj) if descriptor == "screen.json" else obj, path)
+            after += os.path.getsize(path)
+    print("Wrote %s: plugin descriptors reduced from %d to %d bytes" % (args.out, before, after))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+rle_bitmap: Compress MultiMon's monochrome bitmaps for RLEBitmap::draw()
+
+The source images in tools/images are 1-bit headers written by
+lcd-image-converter (monochrome, 8-bit blocks, split to rows). Each is
+converted into a header of the same name in src/screens/images holding a
+run-length encoded copy of the image, which is drawn by RLEBitmap::draw()
+as a series of filled spans rather than one pixel at a time.
+
+The encoding is a series of row groups. A group starts with the number of
+identical rows it covers (1-255), followed by the lengths of the runs that
+make up one of those rows. Runs alternate between clear and set pixels,
+starting with clear, and add up to the image's width. A run longer than 255
+is written as 255, 0 (an empty run of the other value), and the remainder.
+
+With --bench, nothing is written. Instead, the cost of drawing each image
+with TFT_eSPI's drawBitmap() (a drawPixel() per pixel) is compared with
+drawing its spans, counting the bytes each sends to the display and
+estimating the time at the given SPI clock. This is a model, not a
+measurement. tests/host/RLEBitmapBench runs the real RLEBitmap::draw()
+against drawBitmap() on a stand-in display and times them.
+
+Usage:
+  rle_bitmap.py [--src tools/images] [--out src/screens/images] [--bench [--spi-mhz 40]]
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+HERE = os.path.dirname(__file__)
+
+# Bytes sent to the display, following TFT_eSPI's implementations. Commands
+# are one byte and coordinates two.
+DRAW_PIXEL_BYTES = 1 + 4 + 1 + 2    # Column address (the row is cached), write, pixel
+SET_WINDOW_BYTES = 1 + 4 + 1 + 4 + 1
+PIXEL_BYTES = 2
+
+
+class Bitmap:
+    def __init__(self, path):
+        text = open(path, encoding="utf-8").read()
+        self.path = path
+        self.credit = re.findall(r"^//\s*(.*\S)", text[:text.index("/*")], re.M)
+        self.width = int(re.search(r"#define\s+\w+_Width\s*\((\d+)\)", text).group(1))
+        self.height = int(re.search(r"#define\s+\w+_Height\s*\((\d+)\)", text).group(1))
+        self.prefix = re.search(r"#define\s+(\w+)_Width", text).group(1)
+        self.name = re.search(r"uint8_t\s+(\w+)\s*\[", text).group(1)
+        body = re.sub(r"//[^\n]*", "", text[text.index("PROGMEM"):])
+        self.data = [int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", body)]
+        stride = (self.width + 7) // 8
+        if len(self.data) != stride * self.height:
+            raise ValueError("%s: expected %d bytes, found %d" % (path, stride * self.height, len(self.data)))
+        self.rows = [[(self.data[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(self.width)]
+                     for y in range(self.height)]
+
+
+def runs(row):
+    """The lengths of the alternating runs in row, starting with clear pixels"""
+    result, bit, count = [], 0, 0
+    for pixel in row:
+        if pixel != bit:
+            result.append(count)
+            bit, count = pixel, 0
+        count += 1
+    result.append(count)
+    return result
+
+
+def encode(bitmap):
+    out, spans = [], []
+    y = 0
+    while y < bitmap.height:
+        n = 1
+        while y + n < bitmap.height and n < 255 and bitmap.rows[y + n] == bitmap.rows[y]:
+            n += 1
+        out.append(n)
+        x = 0
+        for length in runs(bitmap.rows[y]):
+            if length:
+                spans.append((x, y, length, n))
+            x += length
+            while length > 255:
+                out += [255, 0]
+                length -= 255
+            out.append(length)
+        y += n
+    return out, spans
+
+
+def decode(encoded, width, height):
+    """Expand the encoding back into rows, to check it"""
+    rows, i = [], 0
+    while len(rows) < height:
+        n = encoded[i]
+        i += 1
+        row, bit = [], 0
+        while len(row) < width:
+            row += [bit] * encoded[i]
+            i += 1
+            bit ^= 1
+        rows += [row] * n
+    return rows
+
+
+def write_header(bitmap, encoded, path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    with open(path, "w") as f:
+        f.write("/*\n * %s\n" % name)
+        f.write(" *    Generated by tools/rle_bitmap.py from tools/images/%s. Don't edit.\n" % os.path.basename(bitmap.path))
+        for line in bitmap.credit:
+            f.write(" *    %s\n" % line)
+        f.write(" *\n * NOTES:\n")
+        f.write(" * o %dx%d pixels, run-length encoded from %d to %d bytes. Draw it\n"
+                % (bitmap.width, bitmap.height, len(bitmap.data), len(encoded)))
+        f.write(" *   with RLEBitmap::draw().\n *\n */\n\n")
+        f.write("#ifndef %s_h\n#define %s_h\n\n" % (name, name))
+        f.write("#define %s_Width  (%d)\n" % (bitmap.prefix, bitmap.width))
+        f.write("#define %s_Height (%d)\n\n" % (bitmap.prefix, bitmap.height))
+        f.write("static const uint8_t %s_RLE[%d] PROGMEM = {\n" % (bitmap.name, len(encoded)))
+        for i in range(0, len(encoded), 16):
+            f.write("  " + ", ".join("%3d" % b for b in encoded[i:i + 16]) + ",\n")
+        f.write("};\n\n#endif  // %s_h\n" % name)
+
+
+def bench(bitmap, spans, spi_mhz):
+    pixels = bitmap.width * bitmap.height
+    before = pixels * DRAW_PIXEL_BYTES
+    after = sum(SET_WINDOW_BYTES + w * h * PIXEL_BYTES for _, _, w, h in spans)
+    ms = lambda nbytes: nbytes * 8 / (spi_mhz * 1000.0)
+    print("%-16s drawBitmap: %6d calls %7d bytes %6.1f ms | spans: %5d calls %7d bytes %6.1f ms | %.1fx"
+          % (bitmap.name, pixels, before, ms(before), len(spans), after, ms(after), before / after))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run-length encode MultiMon's monochrome bitmaps")
+    parser.add_argument("--src", default=os.path.relpath(os.path.join(HERE, "images")))
+    parser.add_argument("--out", default=os.path.relpath(os.path.join(HERE, "..", "src", "screens", "images")))
+    parser.add_argument("--bench", action="store_true", help="compare drawing costs instead of writing headers")
+    parser.add_argument("--spi-mhz", type=float, default=40)
+    args = parser.parse_args()
+
+    total_before = total_after = 0
+    for path in sorted(glob.glob(os.path.join(args.src, "*.h"))):
+        bitmap = Bitmap(path)
+        encoded, spans = encode(bitmap)
+        if decode(encoded, bitmap.width, bitmap.height) != bitmap.rows:
+            print("error: %s doesn't survive a round trip" % path)
+            return 1
+        if args.bench:
+            bench(bitmap, spans, args.spi_mhz)
+            continue
+        out = os.path.join(args.out, os.path.basename(path))
+        write_header(bitmap, encoded, out)
+        total_before += len(bitmap.data)
+        total_after += len(encoded)
+        print("%s: %d -> %d bytes" % (out, len(bitmap.data), len(encoded)))
+    if not args.bench:
+        print("Total: %d -> %d bytes" % (total_before, total_after))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
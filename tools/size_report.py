@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+size_report: Show where the flash goes in a MultiMon firmware build
+
+Reads the ELF file of a build and reports the flash it uses (the sections
+that are loaded from flash: code, read-only data, and initialized data)
+against the size of the app partition, followed by the largest symbols.
+Given the linker map as well, it also totals the flash used by each module
+(each of the sketch's source files, each library, the core, and the SDK).
+
+To get the files with arduino-cli:
+  arduino-cli compile --fqbn esp32:esp32:esp32 --output-dir build \\
+      --build-property "compiler.c.elf.extra_flags=-Wl,-Map,build/MultiMon.map" .
+and use the nm that comes with the board's toolchain (e.g.
+xtensa-esp32-elf-nm). With the Arduino IDE, turn on verbose output while
+compiling to find the build directory.
+
+--save writes the module totals as JSON. --compare reads totals saved
+earlier (e.g. from a build with a different profile in MMFeatures.h) and
+shows the modules whose size changed the most.
+
+Usage:
+  size_report.py ELF [--map MAP] [--nm NM] [--partition esp32-default | --budget BYTES]
+                 [--top 20] [--by-library] [--save FILE] [--compare FILE]
+
+Exits with a non-zero status if the firmware doesn't fit the partition.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+
+# The size of the app partition for common partition schemes
+PARTITIONS = {
+    "esp32-default": 0x140000,      # Default 4MB with spiffs (1.2MB APP/1.5MB SPIFFS)
+    "esp32-min-spiffs": 0x1E0000,   # Minimal SPIFFS (1.9MB APP with OTA/190KB SPIFFS)
+    "esp32-no-ota": 0x200000,       # No OTA (2MB APP/2MB SPIFFS)
+    "esp32-huge-app": 0x300000,     # Huge APP (3MB No OTA/1MB SPIFFS)
+    "esp8266-4m2m": 1044464,        # 4MB (FS:2MB OTA:~1019KB)
+    "esp8266-4m1m": 1044464,        # 4MB (FS:1MB OTA:~1019KB)
+}
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+# nm symbol types whose contents are in flash
+FLASH_TYPES = set("tTrRdDvVwW")
+
+
+def flash_sections(path):
+    """Returns {name: size} for the ELF's sections that take space in flash"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+    is64 = data[4] == 2
+    order = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(order + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", data, 0x3A)
+        fmt = order + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(order + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", data, 0x2E)
+        fmt = order + "IIIIIIIIII"
+
+    headers = [struct.unpack_from(fmt, data, shoff + i * shentsize) for i in range(shnum)]
+    strtab = headers[shstrndx][4]
+
+    def name(offset):
+        end = data.index(b"\0", strtab + offset)
+        return data[strtab + offset:end].decode()
+
+    sections = {}
+    for h in headers:
+        sh_name, sh_type, sh_flags, sh_addr, _, sh_size = h[:6]
+        if sh_flags & SHF_ALLOC and sh_type != SHT_NOBITS and sh_size and sh_addr:
+            sections[name(sh_name)] = sh_size
+    return sections
+
+
+def symbols(elf, nm):
+    out = subprocess.run([nm, "--size-sort", "-S", "-C", "--radix=d", elf],
+                         check=True, capture_output=True, text=True).stdout
+    result = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in FLASH_TYPES:
+            result.append((int(parts[1]), parts[3]))
+    return sorted(result, reverse=True)
+
+
+def module_name(obj, by_library):
+    """A readable name for an object file listed in the map"""
+    obj = obj.replace("\\", "/")
+    archive = re.match(r"(.*/)?([^/]+\.a)\((.+)\)$", obj)
+    if archive:
+        lib, member = archive.group(2), archive.group(3)
+        if lib == "core.a":
+            return "core" if by_library else "core/" + member
+        return lib if by_library else "%s(%s)" % (lib, member)
+    obj = "/" + obj
+    if "/sketch/" in obj:
+        return "sketch" if by_library else obj.split("/sketch/", 1)[1]
+    if "/libraries/" in obj:
+        rest = obj.split("/libraries/", 1)[1]
+        return rest.split("/", 1)[0] if by_library else rest
+    return os.path.basename(obj)
+
+
+def modules(map_path, sections, by_library):
+    """Totals the input sections placed in flash by the object they came from"""
+    totals = {}
+    output = None
+    pending = None    # An input section whose name was too long for its line
+    line_re = re.compile(r"^\s+(\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+    with open(map_path, errors="replace") as f:
+        in_map = False
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Linker script and memory map"):
+                in_map = True
+                continue
+            if not in_map:
+                continue
+            if line and not line[0].isspace():
+                output = line.split()[0]
+                continue
+            if pending and line.startswith(" " * 16):
+                line = " " + pending + line
+            pending = None
+            m = line_re.match(line)
+            if not m:
+                stripped = line.strip()
+                if stripped.startswith(".") and " " not in stripped:
+                    pending = stripped
+                continue
+            size = int(m.group(3), 16)
+            obj = m.group(4).strip()
+            if output not in sections or size == 0 or obj.startswith("*") or "=" in obj:
+                continue
+            name = module_name(obj, by_library)
+            totals[name] = totals.get(name, 0) + size
+    return totals
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report the flash used by a MultiMon build")
+    parser.add_argument("elf")
+    parser.add_argument("--map", help="the linker map, for per-module totals")
+    parser.add_argument("--nm", default="nm", help="the toolchain's nm (e.g. xtensa-esp32-elf-nm)")
+    parser.add_argument("--partition", choices=sorted(PARTITIONS), default="esp32-default")
+    parser.add_argument("--budget", type=int, help="the app partition's size in bytes")
+    parser.add_argument("--top", type=int, default=20, help="number of symbols and modules to list")
+    parser.add_argument("--by-library", action="store_true", help="total modules by library")
+    parser.add_argument("--save", help="write the module totals to this JSON file")
+    parser.add_argument("--compare", help="compare the module totals with those saved in this file")
+    args = parser.parse_args()
+
+    sections = flash_sections(args.elf)
+    used = sum(sections.values())
+    budget = args.budget or PARTITIONS[args.partition]
+    print("Flash: %d of %d bytes (%.1f%%), %d bytes %s" % (
+        used, budget, 100.0 * used / budget, abs(budget - used), "free" if used <= budget else "OVER"))
+    for name, size in sorted(sections.items(), key=lambda s: -s[1]):
+        print("  %-24s %9d" % (name, size))
+
+    try:
+        syms = symbols(args.elf, args.nm)
+        print("\nLargest symbols:")
+        for size, name in syms[:args.top]:
+            print("  %9d  %s" % (size, name[:100]))
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("\nUnable to list symbols with %s: %s" % (args.nm, e))
+
+    if args.map:
+        totals = modules(args.map, sections, args.by_library)
+        print("\nLargest modules (%d bytes in all):" % sum(totals.values()))
+        for name, size in sorted(totals.items(), key=lambda t: -t[1])[:args.top]:
+            print("  %9d  %s" % (size, name))
+        if args.save:
+            with open(args.save, "w") as f:
+                json.dump({"flash": used, "modules": totals}, f, indent=1, sort_keys=True)
+        if args.compare:
+            with open(args.compare) as f:
+                before = json.load(f)
+            print("\nChange in flash: %+d bytes" % (used - before["flash"]))
+            names = set(totals) | set(before["modules"])
+            deltas = [(totals.get(n, 0) - before["modules"].get(n, 0), n) for n in names]
+            for delta, name in sorted((d for d in deltas if d[0]), key=lambda d: -abs(d[0]))[:args.top]:
+                print("  %+9d  %s" % (delta, name))
+    elif args.save or args.compare:
+        print("\n--save and --compare need --map")
+
+    return 0 if used <= budget else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())